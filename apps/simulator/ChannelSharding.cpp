@@ -0,0 +1,645 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "ChannelSharding.h"
+
+#include <DRAMSys/controller/McConfig.h>
+#include <DRAMSys/simulation/AddressDecoder.h>
+#include <DRAMSys/simulation/SimConfig.h>
+#include <DRAMSys/statistics/Group.h>
+#include <DRAMSys/statistics/PrettyFormat.h>
+#include <DRAMSys/statistics/Stat.h>
+#include <DRAMSys/statistics/StatProvider.h>
+
+#include <DRAMUtils/util/json.h>
+
+#include <fmt/base.h>
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+using namespace DRAMSys::Config;
+using namespace DRAMSys::Statistics;
+
+namespace ChannelSharding
+{
+
+namespace
+{
+
+constexpr std::string_view CONFIG_FILE = "config.json";
+constexpr std::string_view STATS_FILE = "stats.json";
+constexpr std::string_view LOG_FILE = "log.txt";
+constexpr std::string_view CONTROLLER_GROUP = "controller";
+
+struct Shard
+{
+    unsigned channel;
+    std::filesystem::path directory;
+    nlohmann::json stats;
+    double duration = 0;
+};
+
+nlohmann::json formatHistogram(Histogram const& histogram)
+{
+    // The empty trailing buckets are omitted
+    auto const& buckets = histogram.getBuckets();
+    auto last = std::find_if(buckets.crbegin(), buckets.crend(), [](uint64_t bucket)
+                             { return bucket != 0; });
+
+    nlohmann::json j;
+    j["unit"] = histogram.getUnit();
+    j["buckets"] = std::vector<uint64_t>(buckets.cbegin(), last.base());
+    j["sum"] = histogram.getSum();
+    j["min"] = histogram.getRawMin();
+    j["max"] = histogram.getRawMax();
+    return j;
+}
+
+Histogram parseHistogram(nlohmann::json const& j)
+{
+    return {j["unit"].get<double>(),
+            j["buckets"].get<std::vector<uint64_t>>(),
+            j["sum"].get<uint64_t>(),
+            j["min"].get<uint64_t>(),
+            j["max"].get<uint64_t>()};
+}
+
+nlohmann::json formatGroup(Group const& group)
+{
+    nlohmann::json j;
+    j["name"] = group.name;
+    j["stats"] = nlohmann::json::array();
+    j["groups"] = nlohmann::json::array();
+
+    for (auto const& stat : group.stats)
+    {
+        nlohmann::json s;
+        s["name"] = stat->name;
+        s["description"] = stat->description;
+        s["quantity"] = static_cast<int>(stat->quantity);
+
+        if (auto* scalar = dynamic_cast<ScalarStat*>(stat.get()))
+        {
+            s["vector"] = false;
+            s["values"] = nlohmann::json::array({scalar->value});
+        }
+        else if (auto* vector = dynamic_cast<VectorStat*>(stat.get()))
+        {
+            s["vector"] = true;
+            s["values"] = vector->values;
+        }
+        else if (auto* histogram = dynamic_cast<HistogramStat*>(stat.get()))
+        {
+            s["vector"] = false;
+            s["histograms"] = nlohmann::json::array({formatHistogram(histogram->histogram)});
+        }
+        else if (auto* histograms = dynamic_cast<HistogramVectorStat*>(stat.get()))
+        {
+            s["vector"] = true;
+            s["unit"] = histograms->unit;
+            s["histograms"] = nlohmann::json::array();
+            for (auto const& h : histograms->histograms)
+                s["histograms"].push_back(formatHistogram(h));
+        }
+
+        j["stats"].push_back(std::move(s));
+    }
+
+    for (auto const* subGroup : group.subGroups)
+        j["groups"].push_back(formatGroup(*subGroup));
+
+    return j;
+}
+
+// Same traversal as PrettyFormat::collectStats, so the merged statistics are printed in the
+// same order as the statistics of a single simulation.
+nlohmann::json collectStats(sc_core::sc_object* object)
+{
+    auto* provider = dynamic_cast<StatProvider*>(object);
+    provider->updateStats();
+    nlohmann::json j = formatGroup(provider->getStatGroup());
+
+    for (auto* child : object->get_child_objects())
+    {
+        if (dynamic_cast<StatProvider*>(child) != nullptr)
+            j["groups"].push_back(collectStats(child));
+    }
+
+    return j;
+}
+
+std::optional<unsigned> getControllerChannel(std::string const& groupName)
+{
+    if (groupName.size() <= CONTROLLER_GROUP.size() ||
+        groupName.compare(0, CONTROLLER_GROUP.size(), CONTROLLER_GROUP) != 0)
+        return std::nullopt;
+
+    std::string index = groupName.substr(CONTROLLER_GROUP.size());
+    if (!std::all_of(index.begin(), index.end(), [](char c) { return std::isdigit(c) != 0; }))
+        return std::nullopt;
+
+    return static_cast<unsigned>(std::stoul(index));
+}
+
+bool dependsOnDuration(Quantity quantity)
+{
+    return quantity == Quantity::Bandwidth || quantity == Quantity::Percentage;
+}
+
+// Rates of a shard refer to its own duration and are rescaled to the merged duration
+nlohmann::json scaleGroup(nlohmann::json group, double factor)
+{
+    for (auto& stat : group["stats"])
+    {
+        if (dependsOnDuration(static_cast<Quantity>(stat["quantity"].get<int>())))
+        {
+            for (auto& value : stat["values"])
+                value = value.get<double>() * factor;
+        }
+    }
+
+    for (auto& subGroup : group["groups"])
+        subGroup = scaleGroup(subGroup, factor);
+
+    return group;
+}
+
+/**
+ * The groups of a controller are taken from the shard that simulated its channel. All other
+ * statistics are accumulated over the shards: counts and energies are summed up, rates are summed
+ * up weighted by the duration of the shards and times are maximized. Histograms are merged
+ * bucket-wise. The statistics of the root group describe the simulation run itself and are
+ * maximized.
+ */
+nlohmann::json mergeGroups(std::vector<nlohmann::json const*> const& groups,
+                           std::vector<Shard> const& shards,
+                           double duration,
+                           bool root)
+{
+    auto const& name = (*groups.front())["name"].get_ref<std::string const&>();
+
+    if (auto channel = getControllerChannel(name))
+    {
+        // Channels without requests have not been simulated by their own shard, they are idle
+        // in every other shard.
+        std::size_t owner = 0;
+        for (std::size_t i = 0; i < shards.size(); i++)
+        {
+            if (shards[i].channel == *channel)
+                owner = i;
+        }
+
+        return scaleGroup(*groups[owner], shards[owner].duration / duration);
+    }
+
+    nlohmann::json merged = *groups.front();
+
+    for (std::size_t s = 0; s < merged["stats"].size(); s++)
+    {
+        auto& stat = merged["stats"][s];
+        auto quantity = static_cast<Quantity>(stat["quantity"].get<int>());
+
+        if (stat.contains("histograms"))
+        {
+            std::vector<Histogram> histograms;
+            for (auto const* group : groups)
+            {
+                auto const& shardHistograms = (*group)["stats"][s]["histograms"];
+                for (std::size_t h = 0; h < shardHistograms.size(); h++)
+                {
+                    Histogram histogram = parseHistogram(shardHistograms[h]);
+                    if (h < histograms.size())
+                        histograms[h].merge(histogram);
+                    else
+                        histograms.push_back(std::move(histogram));
+                }
+            }
+
+            stat["histograms"] = nlohmann::json::array();
+            for (auto const& histogram : histograms)
+                stat["histograms"].push_back(formatHistogram(histogram));
+
+            continue;
+        }
+
+        std::vector<double> values;
+
+        for (std::size_t i = 0; i < groups.size(); i++)
+        {
+            auto const& shardValues = (*groups[i])["stats"][s]["values"];
+            values.resize(std::max(values.size(), shardValues.size()), 0);
+
+            for (std::size_t v = 0; v < shardValues.size(); v++)
+            {
+                auto value = shardValues[v].get<double>();
+
+                if (root || quantity == Quantity::Time)
+                    values[v] = std::max(values[v], value);
+                else if (dependsOnDuration(quantity))
+                    values[v] += value * shards[i].duration / duration;
+                else
+                    values[v] += value;
+            }
+        }
+
+        stat["values"] = values;
+    }
+
+    for (std::size_t g = 0; g < merged["groups"].size(); g++)
+    {
+        std::vector<nlohmann::json const*> subGroups;
+        for (auto const* group : groups)
+            subGroups.push_back(&(*group)["groups"][g]);
+
+        merged["groups"][g] = mergeGroups(subGroups, shards, duration, false);
+    }
+
+    return merged;
+}
+
+Group& buildGroup(nlohmann::json const& j,
+                  Group* parent,
+                  std::vector<std::unique_ptr<Group>>& groups)
+{
+    auto& group =
+        *groups.emplace_back(std::make_unique<Group>(j["name"].get<std::string>(), parent));
+
+    for (auto const& stat : j["stats"])
+    {
+        auto quantity = static_cast<Quantity>(stat["quantity"].get<int>());
+
+        if (stat.contains("histograms"))
+        {
+            if (stat["vector"].get<bool>())
+            {
+                auto& histograms =
+                    group.addStat<HistogramVectorStat>(stat["name"].get<std::string>(),
+                                                       stat["description"].get<std::string>(),
+                                                       quantity,
+                                                       stat["unit"].get<double>());
+                for (auto const& histogram : stat["histograms"])
+                    histograms.histograms.push_back(parseHistogram(histogram));
+            }
+            else
+            {
+                auto histogram = parseHistogram(stat["histograms"][0]);
+                auto& single = group.addStat<HistogramStat>(stat["name"].get<std::string>(),
+                                                            stat["description"].get<std::string>(),
+                                                            quantity,
+                                                            histogram.getUnit());
+                single.histogram = std::move(histogram);
+            }
+        }
+        else if (stat["vector"].get<bool>())
+        {
+            auto& vector = group.addStat<VectorStat>(
+                stat["name"].get<std::string>(), stat["description"].get<std::string>(), quantity);
+            vector.values = stat["values"].get<std::vector<double>>();
+        }
+        else
+        {
+            auto& scalar = group.addStat<ScalarStat>(
+                stat["name"].get<std::string>(), stat["description"].get<std::string>(), quantity);
+            scalar = stat["values"][0].get<double>();
+        }
+    }
+
+    for (auto const& subGroup : j["groups"])
+        buildGroup(subGroup, &group, groups);
+
+    return group;
+}
+
+std::vector<uint64_t> splitTrace(std::filesystem::path const& trace,
+                                 std::vector<std::filesystem::path> const& shardTraces,
+                                 DRAMSys::AddressDecoder const& addressDecoder,
+                                 uint64_t addressOffset)
+{
+    std::ifstream input(trace);
+    if (!input.is_open())
+        SC_REPORT_FATAL("ChannelSharding", ("Could not open trace " + trace.string()).c_str());
+
+    std::vector<std::ofstream> outputs;
+    for (auto const& shardTrace : shardTraces)
+        outputs.emplace_back(shardTrace);
+
+    std::vector<uint64_t> numberOfLines(shardTraces.size(), 0);
+    uint64_t lineNumber = 0;
+    std::string line;
+
+    while (std::getline(input, line))
+    {
+        lineNumber++;
+
+        // Empty lines and comments are skipped like in the StlPlayer
+        if (line.size() <= 1 || line[0] == '#')
+            continue;
+
+        // Timestamp, optional data length, command and address
+        std::istringstream iss(line);
+        std::string element;
+        iss >> element >> element;
+        if (!element.empty() && element[0] == '(')
+            iss >> element;
+        iss >> element;
+
+        unsigned channel = 0;
+        try
+        {
+            static constexpr unsigned HEX = 16;
+            uint64_t address = std::stoull(element, nullptr, HEX);
+            channel = addressDecoder.decodeChannel(address - addressOffset);
+        }
+        catch (...)
+        {
+            SC_REPORT_FATAL(
+                "ChannelSharding",
+                ("Malformed trace file line " + std::to_string(lineNumber) + ".").c_str());
+        }
+
+        if (channel >= outputs.size())
+            SC_REPORT_FATAL("ChannelSharding",
+                            ("Channel out of range in trace file line " +
+                             std::to_string(lineNumber) + ".")
+                                .c_str());
+
+        outputs[channel] << line << '\n';
+        numberOfLines[channel]++;
+    }
+
+    return numberOfLines;
+}
+
+/**
+ * Simulates the shard in a child process of the executable, its standard output and error are
+ * written into the log file of the shard. Returns a description of the failure, if any.
+ */
+std::optional<std::string> simulateShard(std::string const& executable, Shard const& shard)
+{
+#ifdef _WIN32
+    (void)executable;
+    (void)shard;
+    return "channel sharding is only supported on POSIX systems";
+#else
+    std::vector<std::string> arguments = {executable,
+                                          (shard.directory / CONFIG_FILE).string(),
+                                          "--shard-directory",
+                                          shard.directory.string()};
+    std::vector<char*> argv;
+    for (auto& argument : arguments)
+        argv.push_back(argument.data());
+    argv.push_back(nullptr);
+
+    std::string const log = (shard.directory / LOG_FILE).string();
+    posix_spawn_file_actions_t fileActions;
+    posix_spawn_file_actions_init(&fileActions);
+    posix_spawn_file_actions_addopen(
+        &fileActions, STDOUT_FILENO, log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    posix_spawn_file_actions_adddup2(&fileActions, STDOUT_FILENO, STDERR_FILENO);
+
+    pid_t pid = 0;
+    int error =
+        posix_spawnp(&pid, executable.c_str(), &fileActions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&fileActions);
+    if (error != 0)
+        return "cannot start " + executable + ": " + std::system_category().message(error);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) == -1)
+    {
+        if (errno != EINTR)
+            return "cannot wait for the process: " + std::system_category().message(errno);
+    }
+
+    if (WIFSIGNALED(status))
+        return fmt::format("terminated by signal {}", WTERMSIG(status));
+    if (WEXITSTATUS(status) != 0)
+        return fmt::format("exit code {}", WEXITSTATUS(status));
+    return std::nullopt;
+#endif
+}
+
+} // namespace
+
+int run(Configuration const& configuration,
+        std::filesystem::path const& baseConfig,
+        std::string const& executable,
+        unsigned jobs)
+{
+#ifdef _WIN32
+    SC_REPORT_FATAL("ChannelSharding", "Channel sharding is only supported on POSIX systems");
+#endif
+
+    if (!configuration.tracesetup.has_value() || configuration.tracesetup->size() != 1)
+        SC_REPORT_FATAL("ChannelSharding", "Channel sharding requires exactly one trace player");
+
+    auto traceName = std::visit(
+        [](auto const& config) -> std::optional<std::string>
+        {
+            using T = std::decay_t<decltype(config)>;
+            if constexpr (std::is_same_v<T, TracePlayer>)
+                return config.name;
+            else
+                return std::nullopt;
+        },
+        configuration.tracesetup->front().getVariant());
+
+    if (!traceName.has_value())
+        SC_REPORT_FATAL("ChannelSharding", "Channel sharding requires exactly one trace player");
+
+    if (configuration.mcconfig.Arbiter.value_or(DRAMSys::McConfig::DEFAULT_ARBITER) !=
+        ArbiterType::Simple)
+        SC_REPORT_FATAL("ChannelSharding", "Channel sharding requires the simple arbiter");
+
+    // Relative timestamps depend on the issue time of the previous request of all channels
+    std::filesystem::path tracePath = baseConfig.parent_path() / *traceName;
+    if (tracePath.extension() != ".stl")
+        SC_REPORT_FATAL("ChannelSharding", "Channel sharding requires an absolute .stl trace");
+
+    unsigned numberOfChannels =
+        std::visit([](auto const& memSpec) -> unsigned
+                   { return memSpec.memarchitecturespec.nbrOfChannels; },
+                   configuration.memspec.getVariant());
+
+    DRAMSys::SimConfig simConfig(configuration.simconfig);
+    DRAMSys::AddressDecoder addressDecoder(configuration.addressmapping);
+
+    std::string simulationName = simConfig.simulationName;
+    if (!configuration.simulationid.empty())
+        simulationName = configuration.simulationid + '_' + simulationName;
+
+    std::filesystem::path shardRoot =
+        std::filesystem::absolute("DRAMSys_" + simulationName + "_shards");
+
+    std::vector<std::filesystem::path> shardTraces;
+    for (unsigned channel = 0; channel < numberOfChannels; channel++)
+    {
+        std::filesystem::path directory = shardRoot / ("ch" + std::to_string(channel));
+        std::filesystem::create_directories(directory);
+        shardTraces.push_back(directory / tracePath.filename());
+    }
+
+    auto numberOfLines =
+        splitTrace(tracePath, shardTraces, addressDecoder, simConfig.addressOffset);
+
+    // Only channels with requests are simulated
+    std::vector<Shard> shards;
+    for (unsigned channel = 0; channel < numberOfChannels; channel++)
+    {
+        if (numberOfLines[channel] == 0)
+            continue;
+
+        Shard& shard = shards.emplace_back();
+        shard.channel = channel;
+        shard.directory = shardTraces[channel].parent_path();
+
+        std::string const key(Configuration::KEY);
+        json_t shardConfig;
+        shardConfig[key] = configuration;
+        shardConfig[key]["tracesetup"][0]["name"] = shardTraces[channel].string();
+        shardConfig[key]["simconfig"]["SimulationProgressBar"] = false;
+
+        std::ofstream(shard.directory / CONFIG_FILE) << shardConfig.dump(4);
+    }
+
+    if (shards.empty())
+        SC_REPORT_FATAL("ChannelSharding", ("Empty trace " + tracePath.string()).c_str());
+
+    if (jobs == 0)
+        jobs = std::max(1U, std::thread::hardware_concurrency());
+    jobs = std::min(jobs, static_cast<unsigned>(shards.size()));
+
+    fmt::println("Simulating {} channel shards with {} processes in {}",
+                 shards.size(),
+                 jobs,
+                 shardRoot.string());
+
+    std::vector<std::optional<std::string>> failures(shards.size());
+    std::atomic<std::size_t> nextShard{0};
+    auto simulateShards = [&]()
+    {
+        for (std::size_t i = nextShard++; i < shards.size(); i = nextShard++)
+            failures[i] = simulateShard(executable, shards[i]);
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < jobs; i++)
+        workers.emplace_back(simulateShards);
+    for (auto& worker : workers)
+        worker.join();
+
+    bool failed = false;
+    for (std::size_t i = 0; i < shards.size(); i++)
+    {
+        if (failures[i].has_value())
+        {
+            std::cerr << fmt::format("Shard of channel {} failed ({}), see {}\n",
+                                     shards[i].channel,
+                                     *failures[i],
+                                     (shards[i].directory / LOG_FILE).string());
+            failed = true;
+        }
+    }
+
+    if (failed)
+        return EXIT_FAILURE;
+
+    double duration = 0;
+    for (auto& shard : shards)
+    {
+        shard.stats = nlohmann::json::parse(std::ifstream(shard.directory / STATS_FILE));
+
+        for (auto const& stat : shard.stats["stats"])
+        {
+            if (stat["name"] == "SimulationTime")
+                shard.duration = stat["values"][0].get<double>();
+        }
+
+        duration = std::max(duration, shard.duration);
+    }
+
+    std::vector<nlohmann::json const*> groups;
+    for (auto const& shard : shards)
+        groups.push_back(&shard.stats);
+
+    std::vector<std::unique_ptr<Group>> mergedGroups;
+    Group& root = buildGroup(mergeGroups(groups, shards, duration, true), nullptr, mergedGroups);
+    PrettyFormat::printGroup(root, std::cout);
+
+    // Every shard records all channels, but only the database of its own channel has content
+    if (simConfig.databaseRecording)
+    {
+        for (auto const& shard : shards)
+        {
+            std::string database =
+                "DRAMSys_" + simulationName + "_ch" + std::to_string(shard.channel) + ".tdb";
+            std::filesystem::remove(database);
+            std::filesystem::rename(shard.directory / database, database);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void writeStats(sc_core::sc_object* object)
+{
+    std::ofstream(std::string(STATS_FILE)) << collectStats(object).dump();
+}
+
+} // namespace ChannelSharding
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#pragma once
+
+#include <DRAMSys/configuration/json/DRAMSysConfiguration.h>
+
+#include <filesystem>
+#include <string>
+#include <systemc>
+
+namespace ChannelSharding
+{
+
+/**
+ * Replays the trace of the configuration with one process per channel. The trace is split by
+ * channel, every shard is simulated by a separate DRAMSys process and the statistics and trace
+ * databases of the shards are merged afterwards. Requires a single trace player and the simple
+ * arbiter, as only then the channels are simulated independently of each other.
+ *
+ * Returns the exit code of the simulator.
+ */
+int run(DRAMSys::Config::Configuration const& configuration,
+        std::filesystem::path const& baseConfig,
+        std::string const& executable,
+        unsigned jobs);
+
+/**
+ * Writes the statistics of a shard into its working directory, where they are collected by the
+ * parent process.
+ */
+void writeStats(sc_core::sc_object* object);
+
+} // namespace ChannelSharding
@@ -37,9 +37,11 @@
 
 #include "util.h"
 
+#include <DRAMSys/common/CompressedFile.h>
 #include <DRAMSys/configuration/memspec/MemSpec.h>
 #include <DRAMSys/initiators/generator/TrafficGenerator.h>
 #include <DRAMSys/initiators/hammer/RowHammer.h>
+#include <DRAMSys/initiators/player/BtlPlayer.h>
 #include <DRAMSys/initiators/player/StlPlayer.h>
 #include <DRAMSys/initiators/request/RequestIssuer.h>
 #include <DRAMSys/simulation/SimConfig.h>
@@ -90,7 +92,13 @@ Simulator::Simulator(sc_core::sc_module_name const& name,
         transactionsFinished++;
 
         if (dramSys->getSimConfig().simulationProgressBar)
+        {
+            // Trace players only estimate their number of requests until the end of the trace
+            if (transactionsFinished % TOTAL_TRANSACTIONS_UPDATE_INTERVAL == 0)
+                updateTotalTransactions();
+
             loadBar(transactionsFinished, totalTransactions);
+        }
     };
 
     if (!this->configuration.tracesetup.has_value())
@@ -102,11 +110,18 @@ Simulator::Simulator(sc_core::sc_module_name const& name,
     for (const auto& initiatorConfig : *this->configuration.tracesetup)
     {
         auto initiator = instantiateInitiator(initiatorConfig);
-        totalTransactions += initiator->totalRequests();
-
         initiator->iSocket.bind(dramSys->tSocket);
         initiators.push_back(std::move(initiator));
     }
+
+    updateTotalTransactions();
+}
+
+void Simulator::updateTotalTransactions()
+{
+    totalTransactions = 0;
+    for (const auto& initiator : initiators)
+        totalTransactions += initiator->totalRequests();
 }
 
 std::unique_ptr<RequestIssuer>
@@ -137,9 +152,41 @@ Simulator::instantiateInitiator(const ::DRAMSys::Config::Initiator& initiator)
             {
                 std::filesystem::path tracePath = baseConfig.parent_path() / config.name;
 
+                if (tracePath.extension() == ".btl")
+                {
+                    auto player = std::make_unique<BtlPlayer>(config, tracePath, storageEnabled);
+
+                    return std::make_unique<RequestIssuer>(tracePath.stem().string().c_str(),
+                                                           std::move(player),
+                                                           memoryManager,
+                                                           interfaceClk,
+                                                           std::nullopt,
+                                                           std::nullopt,
+                                                           finishTransaction,
+                                                           terminateInitiator);
+                }
+
+                if (config.startRequest.has_value() || config.startCycle.has_value())
+                    SC_REPORT_FATAL("Simulator",
+                                    "startRequest and startCycle require a binary trace (.btl)");
+
                 std::optional<StlPlayer::TraceType> traceType;
 
-                auto extension = tracePath.extension();
+                // Compressed traces are named like trace.stl.gz
+                std::filesystem::path traceName = tracePath;
+                if (auto format = DRAMSys::CompressedFile::getFormat(tracePath))
+                {
+                    if (!DRAMSys::CompressedFile::isSupported(*format))
+                    {
+                        std::string report = "DRAMSys was built without support for " +
+                                             tracePath.extension().string() + " traces.";
+                        SC_REPORT_FATAL("Simulator", report.c_str());
+                    }
+
+                    traceName = tracePath.stem();
+                }
+
+                auto extension = traceName.extension();
                 if (extension == ".stl")
                     traceType = StlPlayer::TraceType::Absolute;
                 else if (extension == ".rstl")
@@ -154,7 +201,7 @@ Simulator::instantiateInitiator(const ::DRAMSys::Config::Initiator& initiator)
                 auto player = std::make_unique<StlPlayer>(
                     config, tracePath.c_str(), *traceType, storageEnabled);
 
-                return std::make_unique<RequestIssuer>(tracePath.stem().string().c_str(),
+                return std::make_unique<RequestIssuer>(traceName.stem().string().c_str(),
                                                        std::move(player),
                                                        memoryManager,
                                                        interfaceClk,
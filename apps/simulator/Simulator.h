@@ -57,6 +57,9 @@ public:
 private:
     std::unique_ptr<DRAMSys::Initiators::RequestIssuer>
     instantiateInitiator(const DRAMSys::Config::Initiator& initiator);
+    void updateTotalTransactions();
+
+    static constexpr uint64_t TOTAL_TRANSACTIONS_UPDATE_INTERVAL = 10000;
 
     bool storageEnabled;
     DRAMSys::MemoryManager memoryManager;
@@ -33,25 +33,55 @@
  *    Derek Christ
  */
 
+#include "ChannelSharding.h"
 #include "Simulator.h"
 
 #include <DRAMSys/configuration/json/DRAMSysConfiguration.h>
 
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
 
 int sc_main(int argc, char* argv[])
 {
     std::filesystem::path resourceDirectory = DRAMSYS_RESOURCE_DIR;
     std::filesystem::path baseConfig = resourceDirectory / "ddr4-example.json";
-    if (argc >= 2)
+    bool baseConfigSet = false;
+
+    // --channel-shards <jobs>: replay the trace with one process per channel (0: all cores)
+    // --shard-directory <dir>: simulate a shard that has been created by --channel-shards
+    std::optional<unsigned> channelShards;
+    std::optional<std::filesystem::path> shardDirectory;
+
+    for (int i = 1; i < argc; i++)
     {
-        baseConfig = argv[1];
+        std::string_view argument = argv[i];
+
+        if (argument == "--channel-shards" && i + 1 < argc)
+            channelShards = std::stoul(argv[++i]);
+        else if (argument == "--shard-directory" && i + 1 < argc)
+            shardDirectory = argv[++i];
+        else if (!baseConfigSet)
+        {
+            baseConfig = argument;
+            baseConfigSet = true;
+        }
     }
 
     DRAMSys::Config::Configuration configuration = DRAMSys::Config::from_path(baseConfig.c_str());
 
+    if (channelShards.has_value())
+        return ChannelSharding::run(configuration, baseConfig, argv[0], *channelShards);
+
+    if (shardDirectory.has_value())
+        std::filesystem::current_path(*shardDirectory);
+
     Simulator simulator("Simulator", configuration, baseConfig);
     simulator.run();
 
+    if (shardDirectory.has_value())
+        ChannelSharding::writeStats(&simulator);
+
     return 0;
 }
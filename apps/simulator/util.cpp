@@ -42,7 +42,8 @@
 
 void loadBar(uint64_t x, uint64_t n, unsigned int w, unsigned int granularity)
 {
-    if ((n < 100) || ((x != n) && (x % (n / 100 * granularity) != 0)))
+    // The total may only be an estimate, which must not be exceeded on the bar
+    if ((n < 100) || (x > n) || ((x != n) && (x % (n / 100 * granularity) != 0)))
         return;
 
     float ratio = x / (float)n;
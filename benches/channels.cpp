@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifdef USE_DRAMPOWER
+
+#include <DRAMSys/DRAMSys.h>
+#include <DRAMSys/common/MemoryManager.h>
+#include <DRAMSys/configuration/json/DRAMSysConfiguration.h>
+#include <DRAMSys/configuration/memspec/MemSpec.h>
+#include <DRAMSys/initiators/generator/TrafficGenerator.h>
+#include <DRAMSys/initiators/request/RequestIssuer.h>
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <sysc/kernel/sc_simcontext.h>
+
+namespace Channels
+{
+
+using namespace DRAMSys::Initiators;
+
+static DRAMSys::Config::Configuration createConfiguration(unsigned channels,
+                                                          unsigned workerThreads)
+{
+    auto config = DRAMSys::Config::from_path("configs/ddr4-example.json");
+
+    // Every channel is a copy of the 4 GiB DDR4 channel of the example
+    auto memSpec = nlohmann::json::parse(
+        std::ifstream("configs/memspec/JEDEC_4Gb_DDR4-1866_8bit_A.json"));
+    memSpec["memspec"]["memarchitecturespec"]["nbrOfChannels"] = channels;
+    config.memspec = memSpec.at("memspec").get<DRAMUtils::MemSpec::MemSpecVariant>();
+
+    nlohmann::json channelBits = nlohmann::json::array();
+    for (unsigned bit = 32; (1U << (bit - 32)) < channels; bit++)
+        channelBits.push_back(bit);
+
+    if (!channelBits.empty())
+        config.addressmapping.CHANNEL_BIT =
+            channelBits.get<std::vector<DRAMSys::Config::AddressMapping::BitEntry>>();
+
+    config.simconfig.DatabaseRecording = false;
+    config.simconfig.PowerAnalysis = true;
+    config.simconfig.EnableWindowing = false;
+    config.simconfig.SimulationProgressBar = false;
+    config.simconfig.WorkerThreads = workerThreads;
+
+    return config;
+}
+
+static void channel_scaling(benchmark::State& state)
+{
+    auto channels = static_cast<unsigned>(state.range(0));
+    auto workerThreads = static_cast<unsigned>(state.range(1));
+    auto* rdbuf = std::cout.rdbuf(nullptr);
+
+    DRAMSys::Config::Configuration config = createConfiguration(channels, workerThreads);
+
+    for (auto _ : state)
+    {
+        sc_core::sc_curr_simcontext = nullptr;
+
+        DRAMSys::MemoryManager memoryManager(false);
+        auto dramsys = DRAMSys::DRAMSys("dramsys", config);
+
+        // The number of requests per channel is kept constant
+        DRAMSys::Config::TrafficGenerator generator_config{
+            1000,
+            "generator",
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            64,
+            std::nullopt,
+            10000ULL * channels,
+            0.85,
+            DRAMSys::Config::AddressDistribution::Random,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt};
+
+        auto generator = std::make_unique<TrafficGenerator>(generator_config, dramsys.memorySize());
+
+        sc_core::sc_time interfaceClk = dramsys.getMemSpec().tCK;
+        auto issuer = RequestIssuer(
+            "issuer",
+            std::move(generator),
+            memoryManager,
+            interfaceClk,
+            std::nullopt,
+            std::nullopt,
+            []() {},
+            []() { sc_core::sc_stop(); });
+
+        issuer.iSocket.bind(dramsys.tSocket);
+        sc_core::sc_start();
+    }
+
+    std::cout.rdbuf(rdbuf);
+    state.SetItemsProcessed(state.iterations() * 10000 * channels);
+}
+
+static void channel_scaling_arguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"channels", "threads"});
+
+    // Sequential processing compared to one worker thread per channel
+    for (int64_t channels = 1; channels <= 32; channels *= 2)
+    {
+        benchmark->Args({channels, 0});
+        benchmark->Args({channels, channels});
+    }
+}
+
+BENCHMARK(channel_scaling)->Apply(channel_scaling_arguments)->Unit(benchmark::kMillisecond);
+
+} // namespace Channels
+
+#endif // USE_DRAMPOWER
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <DRAMSys/DRAMSys.h>
+#include <DRAMSys/common/MemoryManager.h>
+#include <DRAMSys/configuration/json/DRAMSysConfiguration.h>
+#include <DRAMSys/configuration/memspec/MemSpec.h>
+#include <DRAMSys/initiators/generator/TrafficGenerator.h>
+#include <DRAMSys/initiators/request/RequestIssuer.h>
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+#include <sysc/kernel/sc_simcontext.h>
+
+#include <cmath>
+#include <iostream>
+
+namespace Controller
+{
+
+using namespace DRAMSys::Initiators;
+
+static constexpr unsigned NUMBER_OF_BANK_GROUPS = 4;
+static constexpr uint64_t NUMBER_OF_REQUESTS = 20000;
+
+static nlohmann::json bitRange(unsigned& nextBit, unsigned numberOfBits)
+{
+    nlohmann::json bits = nlohmann::json::array();
+    for (unsigned i = 0; i < numberOfBits; i++)
+        bits.push_back(nextBit++);
+
+    return bits;
+}
+
+// Derives a DDR4 configuration with the given number of banks per channel from the DDR4 example.
+static DRAMSys::Config::Configuration ddr4Configuration(unsigned banksPerChannel)
+{
+    nlohmann::json config = DRAMSys::Config::from_path("configs/ddr4-example.json");
+    config.erase("tracesetup");
+
+    config["simconfig"]["DatabaseRecording"] = false;
+    config["simconfig"]["EnableWindowing"] = false;
+    config["simconfig"]["SimulationProgressBar"] = false;
+
+    auto& memArchitecture = config["memspec"]["memarchitecturespec"];
+    memArchitecture["nbrOfBanks"] = banksPerChannel;
+    memArchitecture["nbrOfBankGroups"] = NUMBER_OF_BANK_GROUPS;
+
+    auto bankBits = static_cast<unsigned>(std::log2(banksPerChannel / NUMBER_OF_BANK_GROUPS));
+    auto bankGroupBits = static_cast<unsigned>(std::log2(NUMBER_OF_BANK_GROUPS));
+    auto columnBits = static_cast<unsigned>(std::log2(memArchitecture["nbrOfColumns"].get<unsigned>()));
+    auto rowBits = static_cast<unsigned>(std::log2(memArchitecture["nbrOfRows"].get<unsigned>()));
+
+    unsigned nextBit = 0;
+    nlohmann::json addressMapping;
+    addressMapping["BYTE_BIT"] = bitRange(nextBit, 3);
+    addressMapping["COLUMN_BIT"] = bitRange(nextBit, columnBits);
+    addressMapping["BANKGROUP_BIT"] = bitRange(nextBit, bankGroupBits);
+    if (bankBits > 0)
+        addressMapping["BANK_BIT"] = bitRange(nextBit, bankBits);
+    addressMapping["ROW_BIT"] = bitRange(nextBit, rowBits);
+    config["addressmapping"] = addressMapping;
+
+    return config.get<DRAMSys::Config::Configuration>();
+}
+
+static void controller_banks_per_channel(benchmark::State& state)
+{
+    auto* rdbuf = std::cout.rdbuf(nullptr);
+    auto dramsys_config = ddr4Configuration(static_cast<unsigned>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        sc_core::sc_curr_simcontext = nullptr;
+
+        DRAMSys::MemoryManager memoryManager(false);
+
+        auto dramsys = DRAMSys::DRAMSys("dramsys", dramsys_config);
+
+        DRAMSys::Config::TrafficGenerator generator_config{
+            1000,
+            "generator",
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            64,
+            std::nullopt,
+            NUMBER_OF_REQUESTS,
+            0.85,
+            DRAMSys::Config::AddressDistribution::Random,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt};
+
+        auto generator = std::make_unique<TrafficGenerator>(generator_config, dramsys.memorySize());
+
+        sc_core::sc_time interfaceClk = dramsys.getMemSpec().tCK;
+        auto issuer = RequestIssuer(
+            "issuer",
+            std::move(generator),
+            memoryManager,
+            interfaceClk,
+            std::nullopt,
+            std::nullopt,
+            []() {},
+            []() { sc_core::sc_stop(); });
+
+        issuer.iSocket.bind(dramsys.tSocket);
+        sc_core::sc_start();
+    }
+
+    state.counters["Requests"] = benchmark::Counter(static_cast<double>(NUMBER_OF_REQUESTS),
+                                                    benchmark::Counter::kIsIterationInvariantRate);
+
+    std::cout.rdbuf(rdbuf);
+}
+
+BENCHMARK(controller_banks_per_channel)
+    ->RangeMultiplier(2)
+    ->Range(8, 128)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace Controller
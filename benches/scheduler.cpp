@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <DRAMSys/common/dramExtensions.h>
+#include <DRAMSys/configuration/json/DRAMSysConfiguration.h>
+#include <DRAMSys/configuration/memspec/MemSpecDDR4.h>
+#include <DRAMSys/controller/BankMachine.h>
+#include <DRAMSys/controller/McConfig.h>
+#include <DRAMSys/controller/scheduler/SchedulerFifo.h>
+#include <DRAMSys/controller/scheduler/SchedulerFrFcfs.h>
+#include <DRAMSys/controller/scheduler/SchedulerFrFcfsGrp.h>
+#include <DRAMSys/controller/scheduler/SchedulerGrpFrFcfs.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <variant>
+#include <vector>
+
+namespace Scheduler
+{
+
+static constexpr unsigned NUMBER_OF_ROWS = 16;
+static constexpr unsigned NUMBER_OF_RANDOM_ROWS = 4096;
+
+// Keeps a single bank of the scheduler filled with the given number of requests. Every iteration
+// selects the next request, removes it and stores it again with a new random row.
+template <typename SchedulerType> static void scheduler_store_remove_select(benchmark::State& state)
+{
+    const auto bufferSize = static_cast<unsigned>(state.range(0));
+
+    auto config = DRAMSys::Config::from_path("configs/ddr4-example.json");
+    const DRAMSys::MemSpecDDR4 memSpec(
+        std::get<DRAMUtils::MemSpec::MemSpecDDR4>(config.memspec.getVariant()));
+
+    DRAMSys::McConfig mcConfig(config.mcconfig, memSpec);
+    mcConfig.schedulerBuffer = DRAMSys::Config::SchedulerBufferType::Shared;
+    mcConfig.requestBufferSize = bufferSize;
+
+    SchedulerType scheduler(mcConfig, memSpec);
+    DRAMSys::BankMachineOpen bankMachine(mcConfig, memSpec, scheduler, DRAMSys::Bank(0));
+
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<std::size_t> rowDistribution(0, NUMBER_OF_ROWS - 1);
+    std::vector<DRAMSys::Row> randomRows(NUMBER_OF_RANDOM_ROWS);
+    for (auto& row : randomRows)
+        row = DRAMSys::Row(rowDistribution(generator));
+
+    auto setRow = [&memSpec](tlm::tlm_generic_payload& payload, DRAMSys::Row row)
+    {
+        DRAMSys::ControllerExtension::setAutoExtension(payload,
+                                                       0,
+                                                       DRAMSys::Rank(0),
+                                                       DRAMSys::Stack(0),
+                                                       DRAMSys::BankGroup(0),
+                                                       DRAMSys::Bank(0),
+                                                       row,
+                                                       DRAMSys::Column(0),
+                                                       memSpec.defaultBurstLength);
+    };
+
+    std::vector<tlm::tlm_generic_payload> payloads(bufferSize);
+    for (std::size_t i = 0; i < payloads.size(); i++)
+    {
+        payloads[i].set_command(tlm::TLM_READ_COMMAND);
+        setRow(payloads[i], randomRows[i % NUMBER_OF_RANDOM_ROWS]);
+        scheduler.storeRequest(payloads[i]);
+    }
+
+    // Open the row of the oldest request, so that the schedulers search for row hits
+    bankMachine.evaluate();
+    bankMachine.update(DRAMSys::Command::ACT);
+
+    std::size_t nextRow = 0;
+    for (auto _ : state)
+    {
+        tlm::tlm_generic_payload* payload = scheduler.getNextRequest(bankMachine);
+        scheduler.removeRequest(*payload);
+
+        setRow(*payload, randomRows[nextRow]);
+        nextRow = (nextRow + 1) % NUMBER_OF_RANDOM_ROWS;
+
+        scheduler.storeRequest(*payload);
+        benchmark::DoNotOptimize(payload);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(scheduler_store_remove_select, DRAMSys::SchedulerFifo)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(scheduler_store_remove_select, DRAMSys::SchedulerFrFcfs)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(scheduler_store_remove_select, DRAMSys::SchedulerFrFcfsGrp)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+BENCHMARK_TEMPLATE(scheduler_store_remove_select, DRAMSys::SchedulerGrpFrFcfs)
+    ->RangeMultiplier(2)
+    ->Range(16, 512);
+
+} // namespace Scheduler
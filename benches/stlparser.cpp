@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <DRAMSys/initiators/player/StlTraceParser.h>
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace DRAMSys::Initiators;
+
+static std::filesystem::path writeTrace(uint64_t numberOfLines, bool withData)
+{
+    std::filesystem::path trace =
+        std::filesystem::temp_directory_path() / "benches_stlparser.stl";
+
+    std::ofstream file(trace);
+    for (uint64_t line = 0; line < numberOfLines; line++)
+    {
+        file << line << ":\t" << (line % 2 == 0 ? "read" : "write") << "\t0x" << std::hex
+             << line * 64 << std::dec;
+
+        if (withData && line % 2 != 0)
+            file << "\t0x" << std::string(128, 'a');
+
+        file << "\n";
+    }
+
+    return trace;
+}
+
+static void stlparser_parse(benchmark::State& state)
+{
+    bool withData = state.range(0) != 0;
+    constexpr uint64_t numberOfLines = 1'000'000;
+    auto trace = writeTrace(numberOfLines, withData);
+
+    for (auto _ : state)
+    {
+        StlTraceParser parser(trace, withData);
+
+        uint64_t lines = 0;
+        while (const StlTraceParser::Block* block = parser.nextBlock())
+            lines += block->size;
+
+        benchmark::DoNotOptimize(lines);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(std::filesystem::file_size(trace)));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numberOfLines));
+    std::filesystem::remove(trace);
+}
+
+BENCHMARK(stlparser_parse)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <DRAMSys/initiators/generator/TrafficGenerator.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace DRAMSys::Initiators;
+
+static void trafficgenerator_generate(benchmark::State& state)
+{
+    auto addressDistribution = static_cast<DRAMSys::Config::AddressDistribution>(state.range(0));
+    constexpr uint64_t numberOfRequests = 10'000'000;
+    constexpr uint64_t memorySize = uint64_t{1} << 32U;
+
+    DRAMSys::Config::TrafficGenerator config{1000,
+                                             "generator",
+                                             std::nullopt,
+                                             std::nullopt,
+                                             std::nullopt,
+                                             std::nullopt,
+                                             64,
+                                             std::nullopt,
+                                             numberOfRequests,
+                                             0.85,
+                                             addressDistribution,
+                                             std::nullopt,
+                                             std::nullopt,
+                                             std::nullopt};
+
+    for (auto _ : state)
+    {
+        TrafficGenerator generator(config, memorySize);
+
+        uint64_t addresses = 0;
+        for (Request request = generator.nextRequest();
+             request.command != Request::Command::Stop;
+             request = generator.nextRequest())
+            addresses += request.address;
+
+        benchmark::DoNotOptimize(addresses);
+    }
+
+    // Reported as generated requests per second
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numberOfRequests));
+}
+
+BENCHMARK(trafficgenerator_generate)
+    ->Arg(static_cast<int64_t>(DRAMSys::Config::AddressDistribution::Random))
+    ->Arg(static_cast<int64_t>(DRAMSys::Config::AddressDistribution::Sequential))
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,76 @@
+# Copyright (c) 2026, RPTU Kaiserslautern-Landau
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived from
+#    this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+# TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+# OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+# PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Authors:
+#    Derek Christ
+
+
+# Copies a recorded trace database and replaces the Phases view of the copy by a table with the
+# schema of the reference databases, since sqldiff can only compare tables.
+#
+# Usage: cmake -DSQLITE3=<sqlite3> -DINPUT=<database> -DOUTPUT=<copy> -P materialize_phases.cmake
+
+file(REMOVE ${OUTPUT})
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E copy ${INPUT} ${OUTPUT}
+    RESULT_VARIABLE copy_result
+)
+if(copy_result)
+    message(FATAL_ERROR "Failed to copy ${INPUT}")
+endif()
+
+set(MATERIALIZE_PHASES_SQL "
+    CREATE TABLE PhasesTable(
+            ID INTEGER PRIMARY KEY,
+            PhaseName TEXT,
+            PhaseBegin INTEGER,
+            PhaseEnd INTEGER,
+            DataStrobeBegin INTEGER,
+            DataStrobeEnd INTEGER,
+            Rank INTEGER,
+            BankGroup INTEGER,
+            Bank INTEGER,
+            Row INTEGER,
+            Column INTEGER,
+            BurstLength INTEGER,
+            Transact INTEGER
+    );
+    INSERT INTO PhasesTable SELECT * FROM Phases;
+    DROP VIEW Phases;
+    ALTER TABLE PhasesTable RENAME TO Phases;
+")
+
+execute_process(
+    COMMAND ${SQLITE3} ${OUTPUT} ${MATERIALIZE_PHASES_SQL}
+    RESULT_VARIABLE sqlite_result
+)
+if(sqlite_result)
+    message(FATAL_ERROR "Failed to materialize the Phases view of ${OUTPUT}")
+endif()
@@ -38,6 +38,17 @@ if(NOT SqlDiff)
     return()
 endif()
 
+find_program(Sqlite3 sqlite3)
+
+if(NOT Sqlite3)
+    message(WARNING "Regression tests require sqlite3 to be installed")
+    return()
+endif()
+
+set(MATERIALIZE_PHASES_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/materialize_phases.cmake)
+
+# Phases is compared through a materialized copy of the compatibility view, so that the
+# reference databases of the old schema stay valid.
 set(TABLES_TO_COMPARE
     Phases
     Transactions
@@ -95,14 +106,27 @@ function(test_standard test_name base_config reference output_filename)
     )
     set_tests_properties(Regression${test_name}.SqlDiff PROPERTIES FIXTURES_REQUIRED Regression${test_name}.CreateDatabase)
 
+    # sqldiff cannot compare views, the Phases view is materialized into a copy of the database
+    add_test(
+        NAME Regression${test_name}.MaterializePhases
+        WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/${test_name}
+        COMMAND ${CMAKE_COMMAND}
+            -DSQLITE3=${Sqlite3}
+            -DINPUT=${output_filename}
+            -DOUTPUT=compare_${output_filename}
+            -P ${MATERIALIZE_PHASES_SCRIPT}
+    )
+    set_tests_properties(Regression${test_name}.MaterializePhases PROPERTIES FIXTURES_REQUIRED Regression${test_name}.CreateDatabase)
+    set_tests_properties(Regression${test_name}.MaterializePhases PROPERTIES FIXTURES_SETUP Regression${test_name}.MaterializePhases)
+
     # Tests to diff individual tables
     foreach(table IN LISTS TABLES_TO_COMPARE)
         add_test(
             NAME Regression${test_name}.SqlDiff.${table}
             WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/${test_name}
-            COMMAND sqldiff --table ${table} expected/${reference} ${output_filename}
+            COMMAND sqldiff --table ${table} expected/${reference} compare_${output_filename}
         )
-        set_tests_properties(Regression${test_name}.SqlDiff.${table} PROPERTIES FIXTURES_REQUIRED Regression${test_name}.CreateDatabase)
+        set_tests_properties(Regression${test_name}.SqlDiff.${table} PROPERTIES FIXTURES_REQUIRED Regression${test_name}.MaterializePhases)
 
         # Only pass test if output is empty
         set_tests_properties(Regression${test_name}.SqlDiff.${table} PROPERTIES PASS_REGULAR_EXPRESSION "^$")
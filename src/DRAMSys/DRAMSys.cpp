@@ -45,6 +45,7 @@
 #include "DRAMSys/common/DramATRecorder.h"
 #include "DRAMSys/common/StandardMapping.h"
 #include "DRAMSys/common/TlmATRecorder.h"
+#include "DRAMSys/common/WorkerPool.h"
 #include "DRAMSys/common/utils.h"
 #include "DRAMSys/configuration/json/MemSpec.h"
 #include "DRAMSys/controller/Controller.h"
@@ -86,8 +87,12 @@
 #include <fmt/base.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cstdlib>
+#include <exception>
 #include <memory>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -145,14 +150,22 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
                                              *memSpec,
                                              *simConfig,
                                              *addressDecoder,
-                                             &tlmRecorders[i]));
+                                             tlmRecorders[i].get()));
+
+            // Channels that are not recorded are connected directly
+            if (!tlmRecorders[i])
+            {
+                tlmATRecorders.emplace_back(nullptr);
+                dramATRecorders.emplace_back(nullptr);
+                continue;
+            }
 
             // Not recording bandwidth between Arbiter - Controller
             tlmATRecorders.emplace_back(
                 std::make_unique<TlmATRecorder>(("TlmATRecorder" + std::to_string(i)).c_str(),
                                                 *simConfig,
                                                 *memSpec,
-                                                tlmRecorders[i],
+                                                *tlmRecorders[i],
                                                 false));
 
             // Recording bandwidth between Controller - DRAM
@@ -160,7 +173,7 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
                 std::make_unique<DramATRecorder>(("DramATRecorder" + std::to_string(i)).c_str(),
                                                  *simConfig,
                                                  *memSpec,
-                                                 tlmRecorders[i],
+                                                 *tlmRecorders[i],
                                                  true));
         }
     }
@@ -193,22 +206,32 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
     tSocket.bind(arbiter->tSocket);
     for (unsigned i = 0; i < memSpec->numberOfChannels; i++)
     {
-        if (simConfig->databaseRecording)
+        TlmATRecorder* tlmATRecorder =
+            simConfig->databaseRecording ? tlmATRecorders[i].get() : nullptr;
+        DramATRecorder* dramATRecorder =
+            simConfig->databaseRecording ? dramATRecorders[i].get() : nullptr;
+
+        if (tlmATRecorder != nullptr)
         {
-            arbiter->iSocket.bind(tlmATRecorders[i]->tSocket);
-            tlmATRecorders[i]->iSocket.bind(controllers[i]->tSocket);
+            arbiter->iSocket.bind(tlmATRecorder->tSocket);
+            tlmATRecorder->iSocket.bind(controllers[i]->tSocket);
         }
         else
         {
             arbiter->iSocket.bind(controllers[i]->tSocket);
         }
 
-        auto traceCallback = [this, i](tlm::tlm_generic_payload const& trans,
-                                       tlm::tlm_phase const& phase,
-                                       sc_core::sc_time const& delay)
+        auto traceCallback = [this, i, dramATRecorder](tlm::tlm_generic_payload const& trans,
+                                                       tlm::tlm_phase const& phase,
+                                                       sc_core::sc_time const& delay)
         {
-            if (simConfig->databaseRecording)
-                dramATRecorders[i]->record(trans, phase, delay);
+            if (dramATRecorder != nullptr)
+            {
+                if (recordingTrigger && recordingTrigger(trans, phase, delay))
+                    tlmRecorders[i]->trigger("user callback");
+
+                dramATRecorder->record(trans, phase, delay);
+            }
 
 #ifdef USE_DRAMPOWER
             if (simConfig->powerAnalysis)
@@ -216,7 +239,7 @@ DRAMSys::DRAMSys(const sc_core::sc_module_name& name, const Config::Configuratio
 #endif
         };
 
-        if (simConfig->databaseRecording || simConfig->powerAnalysis)
+        if (dramATRecorder != nullptr || simConfig->powerAnalysis)
         {
             controllers[i]->registerTraceCallback(traceCallback);
         }
@@ -233,15 +256,51 @@ DRAMSys::~DRAMSys() = default;
 
 void DRAMSys::setupTlmRecorders(const std::string& traceName, const Config::Configuration& config)
 {
-    // Create TLM Recorders, one per channel.
-    // Reserve is required because the recorders use double buffers that are accessed with pointers.
-    // Without a reserve, the vector reallocates storage before inserting a second
-    // element and the pointers are not valid anymore.
-    tlmRecorders.reserve(memSpec->numberOfChannels);
+    stats.recordingBlockedTime = &stats.addStat<Statistics::ScalarStat>(
+        "RecordingBlockedTime",
+        "Wall-clock time the simulation waited for the database writer",
+        Statistics::Quantity::Time);
+    stats.recordingStalls = &stats.addStat<Statistics::ScalarStat>(
+        "RecordingStalls",
+        "Number of times the simulation found the database writer queue full",
+        Statistics::Quantity::Count);
+
+    for (unsigned int channel : simConfig->recordingChannels)
+    {
+        if (channel >= memSpec->numberOfChannels)
+            SC_REPORT_FATAL("DRAMSys",
+                            ("RecordingChannels contains the invalid channel " +
+                             std::to_string(channel))
+                                .c_str());
+    }
+
+    const auto& recordingChannels = simConfig->recordingChannels;
+    auto isChannelRecorded = [&recordingChannels](std::size_t channel)
+    {
+        return recordingChannels.empty() ||
+               std::find(recordingChannels.cbegin(), recordingChannels.cend(), channel) !=
+                   recordingChannels.cend();
+    };
+
+    std::size_t numberOfRecordedChannels = 0;
+    for (std::size_t i = 0; i < memSpec->numberOfChannels; i++)
+        numberOfRecordedChannels += isChannelRecorded(i) ? 1 : 0;
+
+    recordingWriter =
+        std::make_unique<WorkerPool>(simConfig->recordingWriterThreads, numberOfRecordedChannels);
+
+    // Create TLM Recorders, one per recorded channel
+    tlmRecorders.resize(memSpec->numberOfChannels);
+    std::size_t writerLane = 0;
     for (std::size_t i = 0; i < memSpec->numberOfChannels; i++)
     {
+        if (!isChannelRecorded(i))
+            continue;
+
+        std::string extension =
+            simConfig->recordingFormat == Config::RecordingFormatType::Columnar ? ".ctr" : ".tdb";
         std::string dbName =
-            std::string("DRAMSys") + "_" + traceName + "_ch" + std::to_string(i) + ".tdb";
+            std::string("DRAMSys") + "_" + traceName + "_ch" + std::to_string(i) + extension;
         std::string recorderName = "tlmRecorder" + std::to_string(i);
 
         nlohmann::json mcconfig;
@@ -249,17 +308,39 @@ void DRAMSys::setupTlmRecorders(const std::string& traceName, const Config::Conf
         mcconfig[Config::McConfig::KEY] = config.mcconfig;
         memspec[Config::MemSpecConstants::KEY] = config.memspec;
 
-        tlmRecorders.emplace_back(recorderName,
-                                  *simConfig,
-                                  *mcConfig,
-                                  *memSpec,
-                                  dbName,
-                                  mcconfig.dump(),
-                                  memspec.dump(),
-                                  simConfig->simulationName);
+        tlmRecorders[i] = std::make_unique<TlmRecorder>(recorderName,
+                                                        *simConfig,
+                                                        *mcConfig,
+                                                        *memSpec,
+                                                        dbName,
+                                                        mcconfig.dump(),
+                                                        memspec.dump(),
+                                                        simConfig->simulationName,
+                                                        *recordingWriter,
+                                                        writerLane++);
     }
 }
 
+void DRAMSys::updateStats()
+{
+    if (!simConfig->databaseRecording)
+        return;
+
+    double blockedTime = 0;
+    uint64_t stalls = 0;
+    for (const auto& tlmRecorder : tlmRecorders)
+    {
+        if (!tlmRecorder)
+            continue;
+
+        blockedTime += tlmRecorder->getBlockedTime().count();
+        stalls += tlmRecorder->getNumberOfStalls();
+    }
+
+    *stats.recordingBlockedTime = blockedTime;
+    *stats.recordingStalls = static_cast<double>(stalls);
+}
+
 bool DRAMSys::idle() const
 {
     return std::all_of(controllers.cbegin(),
@@ -280,6 +361,14 @@ void DRAMSys::registerIdleCallback(const std::function<void()>& idleCallback)
     }
 }
 
+void DRAMSys::registerRecordingTrigger(
+    const std::function<bool(tlm::tlm_generic_payload const&,
+                             tlm::tlm_phase const&,
+                             sc_core::sc_time const&)>& recordingTrigger)
+{
+    this->recordingTrigger = recordingTrigger;
+}
+
 void DRAMSys::end_of_simulation()
 {
 #ifdef USE_DRAMPOWER
@@ -293,7 +382,50 @@ void DRAMSys::end_of_simulation()
     if (simConfig->databaseRecording)
     {
         for (auto& tlmRecorder : tlmRecorders)
-            tlmRecorder.finalize();
+        {
+            if (tlmRecorder)
+                tlmRecorder->finishRecording();
+        }
+
+        // Building the indexes and closing the databases is independent for every channel. Errors
+        // are reported on the simulation thread once all threads have finished.
+        std::vector<std::thread> finalizeThreads;
+        std::vector<std::string> finalizeErrors(tlmRecorders.size());
+        finalizeThreads.reserve(tlmRecorders.size());
+        for (std::size_t i = 0; i < tlmRecorders.size(); i++)
+        {
+            if (!tlmRecorders[i])
+                continue;
+
+            finalizeThreads.emplace_back(
+                [&tlmRecorder = *tlmRecorders[i], &error = finalizeErrors[i]]()
+                {
+                    try
+                    {
+                        tlmRecorder.finalize();
+                    }
+                    catch (const std::exception& e)
+                    {
+                        error = e.what();
+                    }
+                    catch (...)
+                    {
+                        error = "Unknown error";
+                    }
+                });
+        }
+
+        for (auto& thread : finalizeThreads)
+            thread.join();
+
+        for (std::size_t i = 0; i < finalizeErrors.size(); i++)
+        {
+            if (!finalizeErrors[i].empty())
+                SC_REPORT_FATAL("DRAMSys",
+                                ("Finalizing the recording of channel " + std::to_string(i) +
+                                 " failed: " + finalizeErrors[i])
+                                    .c_str());
+        }
     }
 }
 
@@ -335,6 +467,11 @@ void DRAMSys::createDRAMPowers(const DRAMUtils::MemSpec::MemSpecVariant& memSpec
     drampowerSimConfig.toggleRateDefinition =
         simConfig->storageEnabled ? std::nullopt : simConfig->togglingRate;
 
+    // The commands of every channel are processed on a worker thread, if requested
+    if (simConfig->workerThreads > 0)
+        workerPool = std::make_unique<WorkerPool>(simConfig->workerThreads,
+                                                  memSpec->numberOfChannels);
+
     // DRAMPowerAdapter generator
     auto generator = [this, &memSpecVar, &drampowerSimConfig] (std::size_t channel, TlmRecorder* recorder) -> std::unique_ptr<DRAMPowerAdapter> {
         std::unique_ptr<DRAMPowerAdapter> adapter = std::visit(
@@ -344,7 +481,7 @@ void DRAMSys::createDRAMPowers(const DRAMUtils::MemSpec::MemSpecVariant& memSpec
                 using Impl = typename StandardMapping::Mapping<T>::PowerType;
                 return std::make_unique<DRAMPowerAdapter>(
                     ("drampoweradapter" + std::to_string(channel)).c_str(), Impl(var, drampowerSimConfig),
-                    *simConfig, *memSpec, recorder
+                    *simConfig, *memSpec, recorder, workerPool.get(), channel
                 );
             }
             SC_REPORT_FATAL("DRAMSys", "Standard does not support the power analysis");
@@ -357,7 +494,7 @@ void DRAMSys::createDRAMPowers(const DRAMUtils::MemSpec::MemSpecVariant& memSpec
     DRAMPowerAdapter *lastDRAMPower = nullptr;
     for (std::size_t i = 0; i < memSpec->numberOfChannels; ++i)
     {
-        auto* recorder = simConfig->databaseRecording ? &tlmRecorders[i] : nullptr;
+        auto* recorder = simConfig->databaseRecording ? tlmRecorders[i].get() : nullptr;
         if (auto drampower = generator(i, recorder)) {
             lastDRAMPower = drampower.get();
             DRAMPowers.emplace_back(std::move(drampower));
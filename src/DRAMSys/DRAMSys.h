@@ -70,6 +70,7 @@ class MemSpec;
 class SimConfig;
 class TlmATRecorder;
 class TlmRecorder;
+class WorkerPool;
 
 class DRAMSys : public sc_core::sc_module, public Statistics::StatProvider
 {
@@ -105,6 +106,15 @@ public:
      */
     void registerIdleCallback(const std::function<void()>& idleCallback);
 
+    /**
+     * Registers a user-defined trigger of the flight recorder. It is evaluated for every command
+     * that is issued in a recorded channel and fires if it returns true.
+     */
+    void registerRecordingTrigger(
+        const std::function<bool(tlm::tlm_generic_payload const&,
+                                 tlm::tlm_phase const&,
+                                 sc_core::sc_time const&)>& recordingTrigger);
+
     /**
      * Serializes the current state of DRAMSys and all submodules for saving it into a checkpoint.
      */
@@ -115,6 +125,7 @@ public:
      */
     void deserialize(std::filesystem::path const& checkpointPath);
 
+    void updateStats() override;
     [[nodiscard]] Statistics::Group const& getStatGroup() const override { return stats; }
 
 private:
@@ -149,13 +160,26 @@ private:
     std::unique_ptr<Dram> dram;
 
 #ifdef USE_DRAMPOWER
+    // Optional worker threads for the per-channel power analysis.
+    // Declared before the adapters as it has to outlive them.
+    std::unique_ptr<WorkerPool> workerPool;
+
     std::vector<std::unique_ptr<DRAMPowerAdapter>> DRAMPowers;
     std::vector<DRAMPowerAdapter *> DRAMPowerMappings;
 #endif
 
-    // Transaction Recorders (one per channel).
+    // Transaction Recorders (one per channel, nullptr for channels that are not recorded).
     // They generate the output databases.
-    std::vector<TlmRecorder> tlmRecorders;
+    std::vector<std::unique_ptr<TlmRecorder>> tlmRecorders;
+
+    // Background threads that commit the recorded transactions, one lane per recorder.
+    // Declared after the recorders as it has to be joined before they are destroyed.
+    std::unique_ptr<WorkerPool> recordingWriter;
+
+    std::function<bool(tlm::tlm_generic_payload const&,
+                       tlm::tlm_phase const&,
+                       sc_core::sc_time const&)>
+        recordingTrigger;
 
     std::vector<std::unique_ptr<TlmATRecorder>> tlmATRecorders;
     std::vector<std::unique_ptr<DramATRecorder>> dramATRecorders;
@@ -164,6 +188,10 @@ private:
     {
     public:
         Stats(DRAMSys &dramsys) : Statistics::Group(dramsys.basename()) {}
+
+        // Only present if database recording is enabled
+        Statistics::ScalarStat* recordingBlockedTime = nullptr;
+        Statistics::ScalarStat* recordingStalls = nullptr;
     } stats;
 };
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef BINARYTRACE_H
+#define BINARYTRACE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Binary trace format (.btl), a compact alternative to the STL traces (.stl, .rstl).
+ *
+ * File layout:
+ *   header:  magic (8 bytes), version (u32), flags (u32)
+ *   records: one fixed-width record per request
+ *   data:    the data of every record with the HAS_DATA flag as size (u32) followed by the bytes
+ *   index:   one IndexEntry per block of RECORDS_PER_BLOCK records
+ *   trailer: number of records (u64), data offset (u64), index offset (u64), magic (8 bytes)
+ *
+ * A record consists of the cycle delta (u64), the address (u64), the data length (u32, 0 if the
+ * default data length of the player is used), the command (u8), the record flags (u8) and two
+ * padding bytes. The cycle of a request is the sum of the deltas of all records up to and
+ * including its own. For absolute traces the delta is the difference to the cycle of the
+ * previous request, for relative traces it is the relative delay itself. All fields are stored
+ * in little-endian byte order.
+ *
+ * The index stores the cycle before and the data offset at the first record of every block, so
+ * that a reader can start at any request or cycle by only scanning the records of one block.
+ */
+namespace DRAMSys::BinaryTrace
+{
+
+constexpr std::array<char, 8> MAGIC = {'D', 'R', 'A', 'M', 'S', 'B', 'T', 'L'};
+constexpr uint32_t VERSION = 1;
+
+constexpr std::size_t HEADER_SIZE = MAGIC.size() + 2 * sizeof(uint32_t);
+constexpr std::size_t RECORD_SIZE = 2 * sizeof(uint64_t) + sizeof(uint32_t) + 4;
+constexpr std::size_t INDEX_ENTRY_SIZE = 2 * sizeof(uint64_t);
+constexpr std::size_t TRAILER_SIZE = 3 * sizeof(uint64_t) + MAGIC.size();
+
+constexpr uint64_t RECORDS_PER_BLOCK = 4096;
+
+// File flags
+constexpr uint32_t RELATIVE = 1U << 0U;
+
+// Record flags
+constexpr uint8_t HAS_DATA = 1U << 0U;
+
+enum class Command : uint8_t
+{
+    Read,
+    Write,
+    END_ENUM
+};
+
+struct Record
+{
+    // Absolute cycle for absolute traces, sum of all delays for relative traces
+    uint64_t cycle = 0;
+    uint64_t delta = 0;
+    Command command = Command::Read;
+    uint64_t address = 0;
+
+    // 0 if the default data length is used
+    uint32_t length = 0;
+
+    // Points into the trace, nullptr if the record has no data
+    const uint8_t* data = nullptr;
+    uint32_t dataSize = 0;
+};
+
+struct IndexEntry
+{
+    // Sum of the deltas of all previous records
+    uint64_t cycle = 0;
+
+    // Offset of the data of the first record relative to the start of the data section
+    uint64_t dataOffset = 0;
+};
+
+} // namespace DRAMSys::BinaryTrace
+
+#endif // BINARYTRACE_H
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "BinaryTraceReader.h"
+
+#include "DRAMSys/common/ColumnarTrace.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace DRAMSys::BinaryTrace;
+using DRAMSys::ColumnarTrace::ColumnDecoder;
+
+namespace DRAMSys
+{
+
+namespace
+{
+
+template <typename T> T load(const uint8_t* position)
+{
+    T value = 0;
+    for (std::size_t byte = 0; byte < sizeof(T); byte++)
+        value |= static_cast<T>(static_cast<T>(position[byte]) << (8 * byte));
+    return value;
+}
+
+} // namespace
+
+BinaryTraceReader::BinaryTraceReader(const std::string& fileName) :
+    fileName(fileName),
+    file(fileName),
+    data(file.data()),
+    size(file.size())
+{
+    if (size < HEADER_SIZE + TRAILER_SIZE ||
+        !std::equal(MAGIC.begin(), MAGIC.end(), reinterpret_cast<const char*>(data)))
+        throw std::runtime_error(fileName + " is not a binary trace");
+
+    ColumnDecoder header(data + MAGIC.size(), data + HEADER_SIZE);
+    uint32_t version = header.getFixed32();
+    if (version != VERSION)
+        throw std::runtime_error(fileName + " has unsupported version " + std::to_string(version));
+
+    relative = (header.getFixed32() & RELATIVE) != 0;
+
+    readTrailer();
+}
+
+void BinaryTraceReader::readTrailer()
+{
+    ColumnDecoder trailer(data + size - TRAILER_SIZE, data + size);
+    numberOfRecords = trailer.getFixed64();
+    dataSectionOffset = trailer.getFixed64();
+    indexOffset = trailer.getFixed64();
+
+    uint64_t numberOfBlocks = (numberOfRecords + RECORDS_PER_BLOCK - 1) / RECORDS_PER_BLOCK;
+    uint64_t maxRecords = (size - HEADER_SIZE - TRAILER_SIZE) / RECORD_SIZE;
+
+    if (!std::equal(MAGIC.begin(),
+                    MAGIC.end(),
+                    reinterpret_cast<const char*>(data + size - MAGIC.size())) ||
+        numberOfRecords > maxRecords ||
+        dataSectionOffset != HEADER_SIZE + numberOfRecords * RECORD_SIZE ||
+        indexOffset < dataSectionOffset ||
+        indexOffset + numberOfBlocks * INDEX_ENTRY_SIZE + TRAILER_SIZE != size)
+        throw std::runtime_error(fileName +
+                                 " has no valid trailer, the conversion may be incomplete");
+
+    ColumnDecoder decoder(data + indexOffset, data + size - TRAILER_SIZE);
+    index.reserve(numberOfBlocks);
+    for (uint64_t block = 0; block < numberOfBlocks; block++)
+    {
+        IndexEntry entry;
+        entry.cycle = decoder.getFixed64();
+        entry.dataOffset = decoder.getFixed64();
+
+        if (decoder.hasFailed() || entry.dataOffset > indexOffset - dataSectionOffset)
+            throw std::runtime_error(fileName + " has a malformed index");
+
+        index.push_back(entry);
+    }
+}
+
+bool BinaryTraceReader::next(Record& record)
+{
+    if (position == numberOfRecords)
+        return false;
+
+    const uint8_t* entry = data + HEADER_SIZE + position * RECORD_SIZE;
+    record.delta = load<uint64_t>(entry);
+    record.address = load<uint64_t>(entry + sizeof(uint64_t));
+    record.length = load<uint32_t>(entry + 2 * sizeof(uint64_t));
+
+    uint8_t command = entry[2 * sizeof(uint64_t) + sizeof(uint32_t)];
+    uint8_t flags = entry[2 * sizeof(uint64_t) + sizeof(uint32_t) + 1];
+    if (command >= static_cast<uint8_t>(Command::END_ENUM))
+        throw std::runtime_error(fileName + " has a malformed record " +
+                                 std::to_string(position));
+
+    record.command = static_cast<Command>(command);
+
+    cycle += record.delta;
+    record.cycle = cycle;
+
+    record.data = nullptr;
+    record.dataSize = 0;
+    if ((flags & HAS_DATA) != 0)
+    {
+        uint64_t dataSectionSize = indexOffset - dataSectionOffset;
+        if (dataSectionSize - dataOffset < sizeof(uint32_t))
+            throw std::runtime_error(fileName + " has malformed data for record " +
+                                     std::to_string(position));
+
+        const uint8_t* dataEntry = data + dataSectionOffset + dataOffset;
+        record.dataSize = load<uint32_t>(dataEntry);
+        if (dataSectionSize - dataOffset - sizeof(uint32_t) < record.dataSize)
+            throw std::runtime_error(fileName + " has malformed data for record " +
+                                     std::to_string(position));
+
+        record.data = dataEntry + sizeof(uint32_t);
+        dataOffset += sizeof(uint32_t) + record.dataSize;
+    }
+
+    position++;
+    return true;
+}
+
+void BinaryTraceReader::seekToBlock(uint64_t block)
+{
+    position = block * RECORDS_PER_BLOCK;
+    cycle = index[block].cycle;
+    dataOffset = index[block].dataOffset;
+}
+
+void BinaryTraceReader::seekToRecord(uint64_t record)
+{
+    if (record >= numberOfRecords)
+    {
+        position = numberOfRecords;
+        return;
+    }
+
+    seekToBlock(record / RECORDS_PER_BLOCK);
+
+    Record skipped;
+    while (position < record)
+        next(skipped);
+}
+
+void BinaryTraceReader::seekToCycle(uint64_t targetCycle)
+{
+    if (index.empty())
+        return;
+
+    // The last block that starts before the cycle contains the first record at or after it,
+    // unless all of its records are before the cycle and the search continues in the next one
+    auto block = std::lower_bound(index.begin(),
+                                  index.end(),
+                                  targetCycle,
+                                  [](const IndexEntry& entry, uint64_t value)
+                                  { return entry.cycle < value; });
+    if (block != index.begin())
+        block--;
+
+    seekToBlock(static_cast<uint64_t>(block - index.begin()));
+
+    Record record;
+    while (true)
+    {
+        uint64_t current = position;
+        uint64_t previousCycle = cycle;
+        uint64_t previousDataOffset = dataOffset;
+
+        if (!next(record))
+            return;
+
+        if (record.cycle >= targetCycle)
+        {
+            position = current;
+            cycle = previousCycle;
+            dataOffset = previousDataOffset;
+            return;
+        }
+    }
+}
+
+} // namespace DRAMSys
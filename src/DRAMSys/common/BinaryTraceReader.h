@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef BINARYTRACEREADER_H
+#define BINARYTRACEREADER_H
+
+#include "DRAMSys/common/BinaryTrace.h"
+#include "DRAMSys/common/MappedFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Memory-mapped reader for binary traces (.btl), see BinaryTrace.h for the file layout.
+ *
+ * The records are read sequentially starting from the current position, which can be moved to
+ * any request or cycle with the help of the index. Throws std::runtime_error if the file cannot
+ * be opened or is malformed.
+ */
+class BinaryTraceReader
+{
+public:
+    explicit BinaryTraceReader(const std::string& fileName);
+    BinaryTraceReader(const BinaryTraceReader&) = delete;
+    BinaryTraceReader(BinaryTraceReader&&) = delete;
+    BinaryTraceReader& operator=(const BinaryTraceReader&) = delete;
+    BinaryTraceReader& operator=(BinaryTraceReader&&) = delete;
+    ~BinaryTraceReader() = default;
+
+    [[nodiscard]] uint64_t getNumberOfRecords() const { return numberOfRecords; }
+    [[nodiscard]] bool isRelative() const { return relative; }
+
+    // Index of the record that is returned by the next call of next()
+    [[nodiscard]] uint64_t getPosition() const { return position; }
+
+    /**
+     * Reads the record at the current position and advances the position. Returns false at the
+     * end of the trace.
+     */
+    bool next(BinaryTrace::Record& record);
+
+    void seekToRecord(uint64_t record);
+
+    /**
+     * Moves the position to the first record with a cycle of at least the given cycle. The
+     * cycles of the records have to be non-decreasing, which holds for all relative traces and
+     * for absolute traces in chronological order.
+     */
+    void seekToCycle(uint64_t targetCycle);
+
+private:
+    void readTrailer();
+    void seekToBlock(uint64_t block);
+
+    std::string fileName;
+    MappedFile file;
+    const uint8_t* data;
+    std::size_t size;
+
+    bool relative = false;
+    uint64_t numberOfRecords = 0;
+    uint64_t dataSectionOffset = 0;
+    uint64_t indexOffset = 0;
+    std::vector<BinaryTrace::IndexEntry> index;
+
+    uint64_t position = 0;
+    uint64_t cycle = 0;
+    uint64_t dataOffset = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // BINARYTRACEREADER_H
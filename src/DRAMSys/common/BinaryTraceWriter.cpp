@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "BinaryTraceWriter.h"
+
+#include "DRAMSys/common/ColumnarTrace.h"
+
+#include <cstdio>
+#include <stdexcept>
+
+using namespace DRAMSys::BinaryTrace;
+using DRAMSys::ColumnarTrace::putFixed32;
+using DRAMSys::ColumnarTrace::putFixed64;
+
+namespace DRAMSys
+{
+
+namespace
+{
+
+constexpr std::size_t FLUSH_THRESHOLD = 1U << 20U;
+
+} // namespace
+
+BinaryTraceWriter::BinaryTraceWriter(const std::string& fileName, bool relative) :
+    fileName(fileName),
+    dataFileName(fileName + ".data"),
+    relative(relative),
+    file(fileName, std::ios::binary | std::ios::trunc),
+    dataFile(dataFileName, std::ios::binary | std::ios::trunc)
+{
+    if (!file || !dataFile)
+        throw std::runtime_error("Cannot open " + fileName + " for writing");
+
+    buffer.insert(buffer.end(), MAGIC.begin(), MAGIC.end());
+    putFixed32(buffer, VERSION);
+    putFixed32(buffer, relative ? RELATIVE : 0);
+}
+
+BinaryTraceWriter::~BinaryTraceWriter()
+{
+    try
+    {
+        close();
+    }
+    catch (const std::runtime_error&)
+    {
+        // Destructors must not throw, an incomplete trace is rejected by the reader
+    }
+}
+
+void BinaryTraceWriter::append(uint64_t cycle,
+                               Command command,
+                               uint64_t address,
+                               uint32_t length,
+                               const uint8_t* data,
+                               uint32_t dataSize)
+{
+    if (numberOfRecords % RECORDS_PER_BLOCK == 0)
+        index.push_back({cycleSum, dataOffset});
+
+    // Unsigned wrap-around keeps the deltas exact for unordered absolute traces
+    uint64_t delta = relative ? cycle : cycle - previousCycle;
+    previousCycle = cycle;
+    cycleSum += delta;
+
+    putFixed64(buffer, delta);
+    putFixed64(buffer, address);
+    putFixed32(buffer, length);
+    buffer.push_back(static_cast<uint8_t>(command));
+    buffer.push_back(dataSize != 0 ? HAS_DATA : 0);
+    buffer.push_back(0);
+    buffer.push_back(0);
+
+    if (dataSize != 0)
+    {
+        putFixed32(dataBuffer, dataSize);
+        dataBuffer.insert(dataBuffer.end(), data, data + dataSize);
+        dataOffset += sizeof(uint32_t) + dataSize;
+    }
+
+    numberOfRecords++;
+
+    if (buffer.size() >= FLUSH_THRESHOLD || dataBuffer.size() >= FLUSH_THRESHOLD)
+        flush();
+}
+
+void BinaryTraceWriter::flush()
+{
+    file.write(reinterpret_cast<const char*>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size()));
+    dataFile.write(reinterpret_cast<const char*>(dataBuffer.data()),
+                   static_cast<std::streamsize>(dataBuffer.size()));
+    buffer.clear();
+    dataBuffer.clear();
+
+    if (!file || !dataFile)
+        throw std::runtime_error("Cannot write to " + fileName);
+}
+
+void BinaryTraceWriter::close()
+{
+    if (closed)
+        return;
+
+    closed = true;
+    flush();
+    dataFile.close();
+
+    uint64_t dataSectionOffset = HEADER_SIZE + numberOfRecords * RECORD_SIZE;
+    if (dataOffset != 0)
+    {
+        std::ifstream data(dataFileName, std::ios::binary);
+        file << data.rdbuf();
+    }
+    std::remove(dataFileName.c_str());
+
+    for (const IndexEntry& entry : index)
+    {
+        putFixed64(buffer, entry.cycle);
+        putFixed64(buffer, entry.dataOffset);
+    }
+
+    putFixed64(buffer, numberOfRecords);
+    putFixed64(buffer, dataSectionOffset);
+    putFixed64(buffer, dataSectionOffset + dataOffset);
+    buffer.insert(buffer.end(), MAGIC.begin(), MAGIC.end());
+
+    file.write(reinterpret_cast<const char*>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+    file.close();
+
+    if (!file)
+        throw std::runtime_error("Cannot write to " + fileName);
+}
+
+} // namespace DRAMSys
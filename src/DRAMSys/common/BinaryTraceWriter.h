@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef BINARYTRACEWRITER_H
+#define BINARYTRACEWRITER_H
+
+#include "DRAMSys/common/BinaryTrace.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Writes a binary trace (.btl), see BinaryTrace.h for the file layout.
+ *
+ * The records are streamed into the trace, the data is collected in a temporary file next to it
+ * and appended together with the index when the trace is closed. Throws std::runtime_error if
+ * a file cannot be written.
+ */
+class BinaryTraceWriter
+{
+public:
+    BinaryTraceWriter(const std::string& fileName, bool relative);
+    BinaryTraceWriter(const BinaryTraceWriter&) = delete;
+    BinaryTraceWriter(BinaryTraceWriter&&) = delete;
+    BinaryTraceWriter& operator=(const BinaryTraceWriter&) = delete;
+    BinaryTraceWriter& operator=(BinaryTraceWriter&&) = delete;
+    ~BinaryTraceWriter();
+
+    /**
+     * Appends a request. For absolute traces the cycle is the absolute cycle of the request,
+     * for relative traces its delay. A length of 0 selects the default data length of the
+     * player. The data is only stored if dataSize is not 0.
+     */
+    void append(uint64_t cycle,
+                BinaryTrace::Command command,
+                uint64_t address,
+                uint32_t length,
+                const uint8_t* data = nullptr,
+                uint32_t dataSize = 0);
+
+    /**
+     * Writes the data, the index and the trailer. No requests may be appended afterwards.
+     */
+    void close();
+
+private:
+    void flush();
+
+    std::string fileName;
+    std::string dataFileName;
+    bool relative;
+
+    std::ofstream file;
+    std::ofstream dataFile;
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> dataBuffer;
+
+    uint64_t numberOfRecords = 0;
+    uint64_t previousCycle = 0;
+    uint64_t cycleSum = 0;
+    uint64_t dataOffset = 0;
+    std::vector<BinaryTrace::IndexEntry> index;
+    bool closed = false;
+};
+
+} // namespace DRAMSys
+
+#endif // BINARYTRACEWRITER_H
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef COLUMNARTRACE_H
+#define COLUMNARTRACE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * Columnar trace format (.ctr), an append-only alternative to the SQLite trace databases.
+ *
+ * File layout:
+ *   header:  magic (8 bytes), version (u32)
+ *   chunks:  for every column its size as varint, followed by the encoded columns
+ *   footer:  one ChunkInfo entry per chunk
+ *   trailer: footer offset (u64), number of chunks (u32), magic (8 bytes)
+ *
+ * Every chunk holds up to a fixed number of rows of one table. Timestamps are stored as zigzag
+ * varints of the difference to the previous row of the same column, all other integers as
+ * varints. The footer contains the time range that is covered by every chunk, so that readers
+ * only have to decode the chunks that overlap a requested time range. Fixed-size fields are
+ * stored in little-endian byte order.
+ */
+namespace DRAMSys::ColumnarTrace
+{
+
+constexpr std::array<char, 8> MAGIC = {'D', 'R', 'A', 'M', 'S', 'C', 'T', 'R'};
+constexpr uint32_t VERSION = 1;
+
+constexpr std::size_t HEADER_SIZE = MAGIC.size() + sizeof(uint32_t);
+constexpr std::size_t TRAILER_SIZE = sizeof(uint64_t) + sizeof(uint32_t) + MAGIC.size();
+constexpr std::size_t CHUNK_INFO_SIZE = 1 + sizeof(uint32_t) + 4 * sizeof(uint64_t);
+
+enum class Table : uint8_t
+{
+    Metadata,
+    Transactions,
+    Phases,
+    Power,
+    BufferDepth,
+    Bandwidth,
+    DebugMessages,
+    END_ENUM
+};
+
+constexpr std::array<std::size_t, static_cast<std::size_t>(Table::END_ENUM)> NUMBER_OF_COLUMNS = {
+    1,  // Metadata: all fields of TraceMetadata in a single row
+    9,  // Transactions
+    12, // Phases
+    2,  // Power
+    3,  // BufferDepth
+    2,  // Bandwidth
+    2   // DebugMessages
+};
+
+struct ChunkInfo
+{
+    Table table = Table::END_ENUM;
+    uint32_t numberOfRows = 0;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+
+    // Covered time range in simulation time units, inclusive
+    uint64_t minTime = 0;
+    uint64_t maxTime = 0;
+};
+
+struct TransactionRecord
+{
+    uint64_t id = 0;
+    uint64_t address = 0;
+    uint32_t dataLength = 0;
+    uint32_t thread = 0;
+    uint32_t channel = 0;
+    uint64_t timeOfGeneration = 0;
+    char command = 'X';
+
+    // Time span of all phases of the transaction
+    uint64_t rangeBegin = 0;
+    uint64_t rangeEnd = 0;
+};
+
+struct PhaseRecord
+{
+    uint64_t transaction = 0;
+    uint8_t phaseNameId = 0;
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    uint64_t dataStrobeBegin = 0;
+    uint64_t dataStrobeEnd = 0;
+    uint32_t rank = 0;
+    uint32_t bankGroup = 0;
+    uint32_t bank = 0;
+    uint32_t row = 0;
+    uint32_t column = 0;
+    uint32_t burstLength = 0;
+};
+
+struct PowerRecord
+{
+    double time = 0.0;
+    double averagePower = 0.0;
+};
+
+struct BufferDepthRecord
+{
+    double time = 0.0;
+    uint32_t bufferNumber = 0;
+    double averageBufferDepth = 0.0;
+};
+
+struct BandwidthRecord
+{
+    double time = 0.0;
+    double averageBandwidth = 0.0;
+};
+
+struct DebugMessageRecord
+{
+    uint64_t time = 0;
+    std::string message;
+};
+
+inline void putVarint(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+inline void putZigZag(std::vector<uint8_t>& buffer, int64_t value)
+{
+    putVarint(buffer,
+              (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+inline void putFixed64(std::vector<uint8_t>& buffer, uint64_t value)
+{
+    for (unsigned byte = 0; byte < sizeof(value); byte++)
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+}
+
+inline void putFixed32(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    for (unsigned byte = 0; byte < sizeof(value); byte++)
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+}
+
+inline void putDouble(std::vector<uint8_t>& buffer, double value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    putFixed64(buffer, bits);
+}
+
+inline void putString(std::vector<uint8_t>& buffer, const std::string& value)
+{
+    putVarint(buffer, value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+/**
+ * Timestamps that are either zero or close to a base timestamp of the same row, e.g., the data
+ * strobe of a phase, are stored as 0 or as the zigzag encoded offset to the base plus one.
+ */
+inline void putOptionalOffset(std::vector<uint8_t>& buffer, uint64_t value, uint64_t base)
+{
+    if (value == 0)
+    {
+        putVarint(buffer, 0);
+        return;
+    }
+
+    auto offset = static_cast<int64_t>(value - base);
+    putVarint(buffer,
+              ((static_cast<uint64_t>(offset) << 1) ^ static_cast<uint64_t>(offset >> 63)) + 1);
+}
+
+/**
+ * Encodes a column of timestamps as differences to the previous value.
+ */
+class DeltaEncoder
+{
+public:
+    void put(std::vector<uint8_t>& buffer, uint64_t value)
+    {
+        putZigZag(buffer, static_cast<int64_t>(value - previous));
+        previous = value;
+    }
+
+    void reset() { previous = 0; }
+
+private:
+    uint64_t previous = 0;
+};
+
+/**
+ * Sequential decoder for one encoded column. Reading past the end of the column or a malformed
+ * varint marks the decoder as failed and yields zeros.
+ */
+class ColumnDecoder
+{
+public:
+    ColumnDecoder(const uint8_t* begin, const uint8_t* end) : position(begin), end(end) {}
+
+    uint64_t getVarint()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            if (position == end)
+                break;
+
+            uint8_t byte = *position++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+
+        failed = true;
+        return 0;
+    }
+
+    int64_t getZigZag()
+    {
+        uint64_t value = getVarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    uint64_t getDelta()
+    {
+        previous += static_cast<uint64_t>(getZigZag());
+        return previous;
+    }
+
+    uint64_t getOptionalOffset(uint64_t base)
+    {
+        uint64_t value = getVarint();
+        if (value == 0)
+            return 0;
+
+        value -= 1;
+        return base + static_cast<uint64_t>(static_cast<int64_t>(value >> 1) ^
+                                            -static_cast<int64_t>(value & 1));
+    }
+
+    uint64_t getFixed64() { return getFixed(sizeof(uint64_t)); }
+
+    uint32_t getFixed32() { return static_cast<uint32_t>(getFixed(sizeof(uint32_t))); }
+
+    double getDouble()
+    {
+        uint64_t bits = getFixed64();
+        double value = 0.0;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    uint8_t getByte()
+    {
+        if (position == end)
+        {
+            failed = true;
+            return 0;
+        }
+        return *position++;
+    }
+
+    std::string getString()
+    {
+        uint64_t length = getVarint();
+        if (length > static_cast<uint64_t>(end - position))
+        {
+            failed = true;
+            position = end;
+            return {};
+        }
+
+        std::string value(reinterpret_cast<const char*>(position), length);
+        position += length;
+        return value;
+    }
+
+    [[nodiscard]] bool hasFailed() const { return failed; }
+    [[nodiscard]] const uint8_t* getPosition() const { return position; }
+
+private:
+    uint64_t getFixed(std::size_t numberOfBytes)
+    {
+        if (static_cast<std::size_t>(end - position) < numberOfBytes)
+        {
+            failed = true;
+            position = end;
+            return 0;
+        }
+
+        uint64_t value = 0;
+        for (std::size_t byte = 0; byte < numberOfBytes; byte++)
+            value |= static_cast<uint64_t>(position[byte]) << (8 * byte);
+        position += numberOfBytes;
+        return value;
+    }
+
+    const uint8_t* position;
+    const uint8_t* end;
+    uint64_t previous = 0;
+    bool failed = false;
+};
+
+} // namespace DRAMSys::ColumnarTrace
+
+#endif // COLUMNARTRACE_H
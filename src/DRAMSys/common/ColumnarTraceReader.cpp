@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "ColumnarTraceReader.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace DRAMSys::ColumnarTrace;
+
+namespace DRAMSys
+{
+
+ColumnarTraceReader::ColumnarTraceReader(const std::string& fileName) :
+    fileName(fileName),
+    file(fileName),
+    data(file.data()),
+    size(file.size())
+{
+    if (size < HEADER_SIZE + TRAILER_SIZE ||
+        !std::equal(MAGIC.begin(), MAGIC.end(), reinterpret_cast<const char*>(data)))
+        throw std::runtime_error(fileName + " is not a columnar trace");
+
+    ColumnDecoder header(data + MAGIC.size(), data + HEADER_SIZE);
+    uint32_t version = header.getFixed32();
+    if (version != VERSION)
+        throw std::runtime_error(fileName + " has unsupported version " + std::to_string(version));
+
+    readFooter();
+    readMetadata();
+}
+
+void ColumnarTraceReader::readFooter()
+{
+    ColumnDecoder trailer(data + size - TRAILER_SIZE, data + size);
+    uint64_t footerOffset = trailer.getFixed64();
+    uint64_t numberOfChunks = trailer.getFixed32();
+
+    if (!std::equal(MAGIC.begin(),
+                    MAGIC.end(),
+                    reinterpret_cast<const char*>(data + size - MAGIC.size())) ||
+        footerOffset < HEADER_SIZE ||
+        footerOffset + numberOfChunks * CHUNK_INFO_SIZE + TRAILER_SIZE != size)
+        throw std::runtime_error(fileName +
+                                 " has no valid footer, the recording may be incomplete");
+
+    ColumnDecoder footer(data + footerOffset, data + size - TRAILER_SIZE);
+    chunks.reserve(numberOfChunks);
+    for (uint64_t index = 0; index < numberOfChunks; index++)
+    {
+        ChunkInfo chunk;
+        chunk.table = static_cast<Table>(footer.getByte());
+        chunk.numberOfRows = footer.getFixed32();
+        chunk.offset = footer.getFixed64();
+        chunk.size = footer.getFixed64();
+        chunk.minTime = footer.getFixed64();
+        chunk.maxTime = footer.getFixed64();
+
+        if (footer.hasFailed() || chunk.table >= Table::END_ENUM ||
+            chunk.offset < HEADER_SIZE || chunk.offset > footerOffset ||
+            chunk.size > footerOffset - chunk.offset)
+            throw std::runtime_error(fileName + " has a malformed footer");
+
+        chunks.push_back(chunk);
+    }
+}
+
+void ColumnarTraceReader::readMetadata()
+{
+    auto chunk = std::find_if(chunks.begin(),
+                              chunks.end(),
+                              [](const ChunkInfo& info) { return info.table == Table::Metadata; });
+    if (chunk == chunks.end())
+        throw std::runtime_error(fileName + " contains no metadata");
+
+    auto columns = getColumns(*chunk, Table::Metadata);
+    ColumnDecoder& column = columns[0];
+
+    metadata.numberOfRanks = static_cast<uint32_t>(column.getVarint());
+    metadata.numberOfBankGroups = static_cast<uint32_t>(column.getVarint());
+    metadata.numberOfBanks = static_cast<uint32_t>(column.getVarint());
+    metadata.clk = column.getVarint();
+    metadata.unitOfTime = column.getString();
+    metadata.mcConfig = column.getString();
+    metadata.memSpec = column.getString();
+    metadata.traces = column.getString();
+    metadata.windowSize = column.getVarint();
+    metadata.refreshMaxPostponed = static_cast<uint32_t>(column.getVarint());
+    metadata.refreshMaxPulledin = static_cast<uint32_t>(column.getVarint());
+    metadata.controllerThread = static_cast<uint32_t>(column.getVarint());
+    metadata.maxBufferDepth = static_cast<uint32_t>(column.getVarint());
+    metadata.per2BankOffset = static_cast<uint32_t>(column.getVarint());
+    metadata.rowColumnCommandBus = column.getVarint() != 0;
+    metadata.pseudoChannelMode = column.getVarint() != 0;
+    metadata.timeResolution = column.getDouble();
+
+    uint64_t numberOfCommands = column.getVarint();
+    for (uint64_t command = 0; command < numberOfCommands && !column.hasFailed(); command++)
+    {
+        std::string name = column.getString();
+        metadata.commandLengths.emplace_back(std::move(name), column.getDouble());
+    }
+
+    uint64_t numberOfPhases = column.getVarint();
+    for (uint64_t phase = 0; phase < numberOfPhases && !column.hasFailed(); phase++)
+    {
+        uint8_t id = column.getByte();
+        metadata.phaseNames.emplace_back(id, column.getString());
+    }
+
+    checkColumns(columns);
+}
+
+std::vector<ChunkInfo>
+ColumnarTraceReader::findChunks(Table table, uint64_t begin, uint64_t end) const
+{
+    std::vector<ChunkInfo> result;
+    for (const ChunkInfo& chunk : chunks)
+    {
+        if (chunk.table == table && chunk.minTime <= end && chunk.maxTime >= begin)
+            result.push_back(chunk);
+    }
+    return result;
+}
+
+void ColumnarTraceReader::read(const ChunkInfo& chunk,
+                               std::vector<TransactionRecord>& records) const
+{
+    auto columns = getColumns(chunk, Table::Transactions);
+    records.reserve(records.size() + chunk.numberOfRows);
+
+    for (uint32_t row = 0; row < chunk.numberOfRows; row++)
+    {
+        TransactionRecord& record = records.emplace_back();
+        record.id = columns[0].getDelta();
+        record.address = columns[1].getVarint();
+        record.dataLength = static_cast<uint32_t>(columns[2].getVarint());
+        record.thread = static_cast<uint32_t>(columns[3].getVarint());
+        record.channel = static_cast<uint32_t>(columns[4].getVarint());
+        record.timeOfGeneration = columns[5].getDelta();
+        record.command = static_cast<char>(columns[6].getByte());
+        record.rangeBegin = columns[7].getDelta();
+        record.rangeEnd = record.rangeBegin + static_cast<uint64_t>(columns[8].getZigZag());
+    }
+
+    checkColumns(columns);
+}
+
+void ColumnarTraceReader::read(const ChunkInfo& chunk, std::vector<PhaseRecord>& records) const
+{
+    auto columns = getColumns(chunk, Table::Phases);
+    records.reserve(records.size() + chunk.numberOfRows);
+
+    for (uint32_t row = 0; row < chunk.numberOfRows; row++)
+    {
+        PhaseRecord& record = records.emplace_back();
+        record.transaction = columns[0].getDelta();
+        record.phaseNameId = columns[1].getByte();
+        record.begin = columns[2].getDelta();
+        record.end = record.begin + static_cast<uint64_t>(columns[3].getZigZag());
+        record.dataStrobeBegin = columns[4].getOptionalOffset(record.begin);
+        record.dataStrobeEnd = columns[5].getOptionalOffset(record.begin);
+        record.rank = static_cast<uint32_t>(columns[6].getVarint());
+        record.bankGroup = static_cast<uint32_t>(columns[7].getVarint());
+        record.bank = static_cast<uint32_t>(columns[8].getVarint());
+        record.row = static_cast<uint32_t>(columns[9].getVarint());
+        record.column = static_cast<uint32_t>(columns[10].getVarint());
+        record.burstLength = static_cast<uint32_t>(columns[11].getVarint());
+    }
+
+    checkColumns(columns);
+}
+
+void ColumnarTraceReader::read(const ChunkInfo& chunk, std::vector<PowerRecord>& records) const
+{
+    auto columns = getColumns(chunk, Table::Power);
+    records.reserve(records.size() + chunk.numberOfRows);
+
+    for (uint32_t row = 0; row < chunk.numberOfRows; row++)
+    {
+        PowerRecord& record = records.emplace_back();
+        record.time = columns[0].getDouble();
+        record.averagePower = columns[1].getDouble();
+    }
+
+    checkColumns(columns);
+}
+
+void ColumnarTraceReader::read(const ChunkInfo& chunk,
+                               std::vector<BufferDepthRecord>& records) const
+{
+    auto columns = getColumns(chunk, Table::BufferDepth);
+    records.reserve(records.size() + chunk.numberOfRows);
+
+    for (uint32_t row = 0; row < chunk.numberOfRows; row++)
+    {
+        BufferDepthRecord& record = records.emplace_back();
+        record.time = columns[0].getDouble();
+        record.bufferNumber = static_cast<uint32_t>(columns[1].getVarint());
+        record.averageBufferDepth = columns[2].getDouble();
+    }
+
+    checkColumns(columns);
+}
+
+void ColumnarTraceReader::read(const ChunkInfo& chunk,
+                               std::vector<BandwidthRecord>& records) const
+{
+    auto columns = getColumns(chunk, Table::Bandwidth);
+    records.reserve(records.size() + chunk.numberOfRows);
+
+    for (uint32_t row = 0; row < chunk.numberOfRows; row++)
+    {
+        BandwidthRecord& record = records.emplace_back();
+        record.time = columns[0].getDouble();
+        record.averageBandwidth = columns[1].getDouble();
+    }
+
+    checkColumns(columns);
+}
+
+void ColumnarTraceReader::read(const ChunkInfo& chunk,
+                               std::vector<DebugMessageRecord>& records) const
+{
+    auto columns = getColumns(chunk, Table::DebugMessages);
+    records.reserve(records.size() + chunk.numberOfRows);
+
+    for (uint32_t row = 0; row < chunk.numberOfRows; row++)
+    {
+        DebugMessageRecord& record = records.emplace_back();
+        record.time = columns[0].getDelta();
+        record.message = columns[1].getString();
+    }
+
+    checkColumns(columns);
+}
+
+std::vector<ColumnDecoder> ColumnarTraceReader::getColumns(const ChunkInfo& chunk,
+                                                           Table table) const
+{
+    if (chunk.table != table)
+        throw std::runtime_error("Chunk does not belong to the requested table");
+
+    const uint8_t* chunkBegin = data + chunk.offset;
+    const uint8_t* chunkEnd = chunkBegin + chunk.size;
+
+    std::size_t numberOfColumns = NUMBER_OF_COLUMNS[static_cast<std::size_t>(table)];
+    std::vector<uint64_t> columnSizes(numberOfColumns);
+    ColumnDecoder header(chunkBegin, chunkEnd);
+    for (auto& columnSize : columnSizes)
+        columnSize = header.getVarint();
+
+    if (header.hasFailed())
+        throw std::runtime_error(fileName + " contains a malformed chunk");
+
+    std::vector<ColumnDecoder> columns;
+    columns.reserve(numberOfColumns);
+    const uint8_t* position = header.getPosition();
+    for (uint64_t columnSize : columnSizes)
+    {
+        if (columnSize > static_cast<uint64_t>(chunkEnd - position))
+            throw std::runtime_error(fileName + " contains a malformed chunk");
+
+        columns.emplace_back(position, position + columnSize);
+        position += columnSize;
+    }
+
+    return columns;
+}
+
+void ColumnarTraceReader::checkColumns(const std::vector<ColumnDecoder>& columns) const
+{
+    for (const auto& column : columns)
+    {
+        if (column.hasFailed())
+            throw std::runtime_error(fileName + " contains a truncated column");
+    }
+}
+
+} // namespace DRAMSys
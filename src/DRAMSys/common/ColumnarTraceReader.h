@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef COLUMNARTRACEREADER_H
+#define COLUMNARTRACEREADER_H
+
+#include "DRAMSys/common/ColumnarTrace.h"
+#include "DRAMSys/common/MappedFile.h"
+#include "DRAMSys/common/TraceSchema.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Memory-mapped reader for columnar traces (.ctr), see ColumnarTrace.h for the file
+ * layout.
+ *
+ * Only the footer and the metadata are decoded when the file is opened. The rows are decoded
+ * chunk by chunk on request, e.g., only for the chunks returned by findChunks(). Throws
+ * std::runtime_error if the file cannot be opened or is malformed.
+ */
+class ColumnarTraceReader
+{
+public:
+    explicit ColumnarTraceReader(const std::string& fileName);
+    ColumnarTraceReader(const ColumnarTraceReader&) = delete;
+    ColumnarTraceReader(ColumnarTraceReader&&) = delete;
+    ColumnarTraceReader& operator=(const ColumnarTraceReader&) = delete;
+    ColumnarTraceReader& operator=(ColumnarTraceReader&&) = delete;
+    ~ColumnarTraceReader() = default;
+
+    [[nodiscard]] const TraceMetadata& getMetadata() const { return metadata; }
+    [[nodiscard]] const std::vector<ColumnarTrace::ChunkInfo>& getChunks() const { return chunks; }
+
+    /**
+     * Returns the chunks of a table that cover a part of the time range [begin, end].
+     */
+    [[nodiscard]] std::vector<ColumnarTrace::ChunkInfo>
+    findChunks(ColumnarTrace::Table table, uint64_t begin, uint64_t end) const;
+
+    // Append the rows of a chunk to the given vector
+    void read(const ColumnarTrace::ChunkInfo& chunk,
+              std::vector<ColumnarTrace::TransactionRecord>& records) const;
+    void read(const ColumnarTrace::ChunkInfo& chunk,
+              std::vector<ColumnarTrace::PhaseRecord>& records) const;
+    void read(const ColumnarTrace::ChunkInfo& chunk,
+              std::vector<ColumnarTrace::PowerRecord>& records) const;
+    void read(const ColumnarTrace::ChunkInfo& chunk,
+              std::vector<ColumnarTrace::BufferDepthRecord>& records) const;
+    void read(const ColumnarTrace::ChunkInfo& chunk,
+              std::vector<ColumnarTrace::BandwidthRecord>& records) const;
+    void read(const ColumnarTrace::ChunkInfo& chunk,
+              std::vector<ColumnarTrace::DebugMessageRecord>& records) const;
+
+private:
+    void readFooter();
+    void readMetadata();
+
+    [[nodiscard]] std::vector<ColumnarTrace::ColumnDecoder>
+    getColumns(const ColumnarTrace::ChunkInfo& chunk, ColumnarTrace::Table table) const;
+    void checkColumns(const std::vector<ColumnarTrace::ColumnDecoder>& columns) const;
+
+    std::string fileName;
+    MappedFile file;
+    const uint8_t* data;
+    std::size_t size;
+
+    std::vector<ColumnarTrace::ChunkInfo> chunks;
+    TraceMetadata metadata;
+};
+
+} // namespace DRAMSys
+
+#endif // COLUMNARTRACEREADER_H
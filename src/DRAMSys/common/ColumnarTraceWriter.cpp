@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "ColumnarTraceWriter.h"
+
+#include <cassert>
+#include <cmath>
+#include <systemc>
+
+using namespace DRAMSys::ColumnarTrace;
+
+namespace DRAMSys
+{
+
+ColumnarTraceWriter::ColumnarTraceWriter(const std::string& fileName,
+                                         const TraceMetadata& metadata,
+                                         std::size_t rowsPerChunk) :
+    fileName(fileName),
+    rowsPerChunk(rowsPerChunk),
+    timeResolution(metadata.timeResolution),
+    file(fileName, std::ios::binary | std::ios::trunc)
+{
+    if (!file)
+        SC_REPORT_FATAL("ColumnarTraceWriter", ("Cannot open " + fileName).c_str());
+
+    for (std::size_t table = 0; table < tables.size(); table++)
+    {
+        tables[table].table = static_cast<Table>(table);
+        tables[table].columns.resize(NUMBER_OF_COLUMNS[table]);
+        tables[table].timestamps.resize(NUMBER_OF_COLUMNS[table]);
+    }
+
+    std::vector<uint8_t> header(MAGIC.begin(), MAGIC.end());
+    putFixed32(header, VERSION);
+    file.write(reinterpret_cast<const char*>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+    fileOffset = header.size();
+
+    TableBuffer& metadataTable = getTable(Table::Metadata);
+    encodeMetadata(metadataTable.columns[0], metadata);
+    metadataTable.coverTime(0, 0);
+    metadataTable.numberOfRows = 1;
+    writeChunk(metadataTable);
+}
+
+ColumnarTraceWriter::~ColumnarTraceWriter()
+{
+    close();
+}
+
+void ColumnarTraceWriter::append(const TransactionRecord& record)
+{
+    TableBuffer& buffer = getTable(Table::Transactions);
+    auto& columns = buffer.columns;
+
+    buffer.timestamps[0].put(columns[0], record.id);
+    putVarint(columns[1], record.address);
+    putVarint(columns[2], record.dataLength);
+    putVarint(columns[3], record.thread);
+    putVarint(columns[4], record.channel);
+    buffer.timestamps[5].put(columns[5], record.timeOfGeneration);
+    columns[6].push_back(static_cast<uint8_t>(record.command));
+    buffer.timestamps[7].put(columns[7], record.rangeBegin);
+    putZigZag(columns[8], static_cast<int64_t>(record.rangeEnd - record.rangeBegin));
+
+    buffer.coverTime(record.rangeBegin, record.rangeEnd);
+    finishRow(buffer);
+}
+
+void ColumnarTraceWriter::append(const PhaseRecord& record)
+{
+    TableBuffer& buffer = getTable(Table::Phases);
+    auto& columns = buffer.columns;
+
+    buffer.timestamps[0].put(columns[0], record.transaction);
+    columns[1].push_back(record.phaseNameId);
+    buffer.timestamps[2].put(columns[2], record.begin);
+    putZigZag(columns[3], static_cast<int64_t>(record.end - record.begin));
+    putOptionalOffset(columns[4], record.dataStrobeBegin, record.begin);
+    putOptionalOffset(columns[5], record.dataStrobeEnd, record.begin);
+    putVarint(columns[6], record.rank);
+    putVarint(columns[7], record.bankGroup);
+    putVarint(columns[8], record.bank);
+    putVarint(columns[9], record.row);
+    putVarint(columns[10], record.column);
+    putVarint(columns[11], record.burstLength);
+
+    buffer.coverTime(record.begin, std::max(record.begin, record.end));
+    finishRow(buffer);
+}
+
+void ColumnarTraceWriter::append(const PowerRecord& record)
+{
+    TableBuffer& buffer = getTable(Table::Power);
+    putDouble(buffer.columns[0], record.time);
+    putDouble(buffer.columns[1], record.averagePower);
+
+    uint64_t time = toTimeUnits(record.time);
+    buffer.coverTime(time, time);
+    finishRow(buffer);
+}
+
+void ColumnarTraceWriter::append(const BufferDepthRecord& record)
+{
+    TableBuffer& buffer = getTable(Table::BufferDepth);
+    putDouble(buffer.columns[0], record.time);
+    putVarint(buffer.columns[1], record.bufferNumber);
+    putDouble(buffer.columns[2], record.averageBufferDepth);
+
+    uint64_t time = toTimeUnits(record.time);
+    buffer.coverTime(time, time);
+    finishRow(buffer);
+}
+
+void ColumnarTraceWriter::append(const BandwidthRecord& record)
+{
+    TableBuffer& buffer = getTable(Table::Bandwidth);
+    putDouble(buffer.columns[0], record.time);
+    putDouble(buffer.columns[1], record.averageBandwidth);
+
+    uint64_t time = toTimeUnits(record.time);
+    buffer.coverTime(time, time);
+    finishRow(buffer);
+}
+
+void ColumnarTraceWriter::append(const DebugMessageRecord& record)
+{
+    TableBuffer& buffer = getTable(Table::DebugMessages);
+    buffer.timestamps[0].put(buffer.columns[0], record.time);
+    putString(buffer.columns[1], record.message);
+
+    buffer.coverTime(record.time, record.time);
+    finishRow(buffer);
+}
+
+void ColumnarTraceWriter::close()
+{
+    if (closed)
+        return;
+
+    for (TableBuffer& buffer : tables)
+    {
+        if (buffer.numberOfRows > 0)
+            writeChunk(buffer);
+    }
+
+    std::lock_guard lock(fileMutex);
+
+    std::vector<uint8_t> footer;
+    footer.reserve(chunks.size() * CHUNK_INFO_SIZE + TRAILER_SIZE);
+    for (const ChunkInfo& chunk : chunks)
+    {
+        footer.push_back(static_cast<uint8_t>(chunk.table));
+        putFixed32(footer, chunk.numberOfRows);
+        putFixed64(footer, chunk.offset);
+        putFixed64(footer, chunk.size);
+        putFixed64(footer, chunk.minTime);
+        putFixed64(footer, chunk.maxTime);
+    }
+
+    putFixed64(footer, fileOffset);
+    putFixed32(footer, static_cast<uint32_t>(chunks.size()));
+    footer.insert(footer.end(), MAGIC.begin(), MAGIC.end());
+
+    file.write(reinterpret_cast<const char*>(footer.data()),
+               static_cast<std::streamsize>(footer.size()));
+    file.close();
+    closed = true;
+
+    if (file.fail())
+        SC_REPORT_FATAL("ColumnarTraceWriter", ("Cannot write " + fileName).c_str());
+}
+
+void ColumnarTraceWriter::finishRow(TableBuffer& buffer)
+{
+    assert(!closed);
+
+    if (++buffer.numberOfRows == rowsPerChunk)
+        writeChunk(buffer);
+}
+
+void ColumnarTraceWriter::writeChunk(TableBuffer& buffer)
+{
+    std::lock_guard lock(fileMutex);
+
+    encodedChunk.clear();
+    for (const auto& column : buffer.columns)
+        putVarint(encodedChunk, column.size());
+
+    ChunkInfo chunk;
+    chunk.table = buffer.table;
+    chunk.numberOfRows = buffer.numberOfRows;
+    chunk.offset = fileOffset;
+    chunk.minTime = buffer.minTime;
+    chunk.maxTime = buffer.maxTime;
+
+    file.write(reinterpret_cast<const char*>(encodedChunk.data()),
+               static_cast<std::streamsize>(encodedChunk.size()));
+    chunk.size = encodedChunk.size();
+
+    for (auto& column : buffer.columns)
+    {
+        file.write(reinterpret_cast<const char*>(column.data()),
+                   static_cast<std::streamsize>(column.size()));
+        chunk.size += column.size();
+
+        // Keep the capacity for the next chunk
+        column.clear();
+    }
+
+    if (!file)
+        SC_REPORT_FATAL("ColumnarTraceWriter", ("Cannot write " + fileName).c_str());
+
+    fileOffset += chunk.size;
+    chunks.push_back(chunk);
+
+    for (auto& timestamp : buffer.timestamps)
+        timestamp.reset();
+    buffer.numberOfRows = 0;
+    buffer.minTime = UINT64_MAX;
+    buffer.maxTime = 0;
+}
+
+uint64_t ColumnarTraceWriter::toTimeUnits(double timeInSeconds) const
+{
+    return static_cast<uint64_t>(std::llround(timeInSeconds / timeResolution));
+}
+
+void ColumnarTraceWriter::encodeMetadata(std::vector<uint8_t>& buffer,
+                                         const TraceMetadata& metadata)
+{
+    putVarint(buffer, metadata.numberOfRanks);
+    putVarint(buffer, metadata.numberOfBankGroups);
+    putVarint(buffer, metadata.numberOfBanks);
+    putVarint(buffer, metadata.clk);
+    putString(buffer, metadata.unitOfTime);
+    putString(buffer, metadata.mcConfig);
+    putString(buffer, metadata.memSpec);
+    putString(buffer, metadata.traces);
+    putVarint(buffer, metadata.windowSize);
+    putVarint(buffer, metadata.refreshMaxPostponed);
+    putVarint(buffer, metadata.refreshMaxPulledin);
+    putVarint(buffer, metadata.controllerThread);
+    putVarint(buffer, metadata.maxBufferDepth);
+    putVarint(buffer, metadata.per2BankOffset);
+    putVarint(buffer, static_cast<uint64_t>(metadata.rowColumnCommandBus));
+    putVarint(buffer, static_cast<uint64_t>(metadata.pseudoChannelMode));
+    putDouble(buffer, metadata.timeResolution);
+
+    putVarint(buffer, metadata.commandLengths.size());
+    for (const auto& [command, length] : metadata.commandLengths)
+    {
+        putString(buffer, command);
+        putDouble(buffer, length);
+    }
+
+    putVarint(buffer, metadata.phaseNames.size());
+    for (const auto& [id, name] : metadata.phaseNames)
+    {
+        buffer.push_back(id);
+        putString(buffer, name);
+    }
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef COLUMNARTRACEWRITER_H
+#define COLUMNARTRACEWRITER_H
+
+#include "DRAMSys/common/ColumnarTrace.h"
+#include "DRAMSys/common/TraceSchema.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Writes a columnar trace (.ctr), see ColumnarTrace.h for the file layout.
+ *
+ * The rows of every table are collected in column buffers and appended to the file as soon as
+ * a chunk is full. The transactions and phases may be appended from a different thread than the
+ * remaining tables, but the rows of one table always have to be appended from the same thread.
+ */
+class ColumnarTraceWriter
+{
+public:
+    ColumnarTraceWriter(const std::string& fileName,
+                        const TraceMetadata& metadata,
+                        std::size_t rowsPerChunk = DEFAULT_ROWS_PER_CHUNK);
+    ColumnarTraceWriter(const ColumnarTraceWriter&) = delete;
+    ColumnarTraceWriter(ColumnarTraceWriter&&) = delete;
+    ColumnarTraceWriter& operator=(const ColumnarTraceWriter&) = delete;
+    ColumnarTraceWriter& operator=(ColumnarTraceWriter&&) = delete;
+    ~ColumnarTraceWriter();
+
+    void append(const ColumnarTrace::TransactionRecord& record);
+    void append(const ColumnarTrace::PhaseRecord& record);
+    void append(const ColumnarTrace::PowerRecord& record);
+    void append(const ColumnarTrace::BufferDepthRecord& record);
+    void append(const ColumnarTrace::BandwidthRecord& record);
+    void append(const ColumnarTrace::DebugMessageRecord& record);
+
+    /**
+     * Writes the remaining rows and the footer. No rows may be appended afterwards.
+     */
+    void close();
+
+    static constexpr std::size_t DEFAULT_ROWS_PER_CHUNK = 65536;
+
+private:
+    struct TableBuffer
+    {
+        ColumnarTrace::Table table = ColumnarTrace::Table::END_ENUM;
+        std::vector<std::vector<uint8_t>> columns;
+        std::vector<ColumnarTrace::DeltaEncoder> timestamps;
+        uint32_t numberOfRows = 0;
+        uint64_t minTime = UINT64_MAX;
+        uint64_t maxTime = 0;
+
+        void coverTime(uint64_t begin, uint64_t end)
+        {
+            minTime = std::min(minTime, begin);
+            maxTime = std::max(maxTime, end);
+        }
+    };
+
+    TableBuffer& getTable(ColumnarTrace::Table table)
+    {
+        return tables[static_cast<std::size_t>(table)];
+    }
+
+    void finishRow(TableBuffer& buffer);
+    void writeChunk(TableBuffer& buffer);
+    [[nodiscard]] uint64_t toTimeUnits(double timeInSeconds) const;
+
+    static void encodeMetadata(std::vector<uint8_t>& buffer, const TraceMetadata& metadata);
+
+    std::string fileName;
+    std::size_t rowsPerChunk;
+    double timeResolution;
+
+    std::array<TableBuffer, static_cast<std::size_t>(ColumnarTrace::Table::END_ENUM)> tables;
+
+    // Chunks of different tables may be completed by different threads
+    std::mutex fileMutex;
+    std::ofstream file;
+    uint64_t fileOffset = 0;
+    std::vector<ColumnarTrace::ChunkInfo> chunks;
+    std::vector<uint8_t> encodedChunk;
+    bool closed = false;
+};
+
+} // namespace DRAMSys
+
+#endif // COLUMNARTRACEWRITER_H
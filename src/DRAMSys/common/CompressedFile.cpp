@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "CompressedFile.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef USE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace DRAMSys
+{
+
+struct CompressedFile::Decoder
+{
+    Decoder() = default;
+    Decoder(const Decoder&) = delete;
+    Decoder(Decoder&&) = delete;
+    Decoder& operator=(const Decoder&) = delete;
+    Decoder& operator=(Decoder&&) = delete;
+    virtual ~Decoder() = default;
+
+    /**
+     * Decompresses from input into output, both are advanced by the processed bytes. Returns
+     * false if the data is corrupt.
+     */
+    virtual bool decompress(const uint8_t*& input,
+                            const uint8_t* inputEnd,
+                            char*& output,
+                            char* outputEnd) = 0;
+
+    // True if the input ended at a frame boundary
+    [[nodiscard]] virtual bool isComplete() const = 0;
+};
+
+namespace
+{
+
+#ifdef USE_ZLIB
+class GzipDecoder : public CompressedFile::Decoder
+{
+public:
+    GzipDecoder()
+    {
+        // 32 enables the automatic detection of the gzip and zlib headers
+        if (inflateInit2(&stream, MAX_WBITS + 32) != Z_OK)
+            throw std::runtime_error("Failed to initialize zlib");
+    }
+
+    GzipDecoder(const GzipDecoder&) = delete;
+    GzipDecoder(GzipDecoder&&) = delete;
+    GzipDecoder& operator=(const GzipDecoder&) = delete;
+    GzipDecoder& operator=(GzipDecoder&&) = delete;
+    ~GzipDecoder() override { inflateEnd(&stream); }
+
+    bool decompress(const uint8_t*& input,
+                    const uint8_t* inputEnd,
+                    char*& output,
+                    char* outputEnd) override
+    {
+        // zlib counts in 32 bit, larger buffers are processed over several calls
+        constexpr std::size_t maxChunk = std::numeric_limits<uInt>::max();
+
+        stream.next_in = const_cast<Bytef*>(input);
+        stream.avail_in = static_cast<uInt>(
+            std::min(static_cast<std::size_t>(inputEnd - input), maxChunk));
+        stream.next_out = reinterpret_cast<Bytef*>(output);
+        stream.avail_out = static_cast<uInt>(
+            std::min(static_cast<std::size_t>(outputEnd - output), maxChunk));
+
+        int result = inflate(&stream, Z_NO_FLUSH);
+
+        input = stream.next_in;
+        output = reinterpret_cast<char*>(stream.next_out);
+
+        if (result == Z_STREAM_END)
+        {
+            // Concatenated gzip members form a single file
+            complete = true;
+            return inflateReset(&stream) == Z_OK;
+        }
+
+        if (result == Z_OK || result == Z_BUF_ERROR)
+        {
+            complete = complete && stream.total_in == 0;
+            return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] bool isComplete() const override { return complete; }
+
+private:
+    z_stream stream{};
+    bool complete = false;
+};
+#endif
+
+#ifdef USE_ZSTD
+class ZstdDecoder : public CompressedFile::Decoder
+{
+public:
+    ZstdDecoder() : stream(ZSTD_createDStream())
+    {
+        if (stream == nullptr)
+            throw std::runtime_error("Failed to initialize zstd");
+    }
+
+    ZstdDecoder(const ZstdDecoder&) = delete;
+    ZstdDecoder(ZstdDecoder&&) = delete;
+    ZstdDecoder& operator=(const ZstdDecoder&) = delete;
+    ZstdDecoder& operator=(ZstdDecoder&&) = delete;
+    ~ZstdDecoder() override { ZSTD_freeDStream(stream); }
+
+    bool decompress(const uint8_t*& input,
+                    const uint8_t* inputEnd,
+                    char*& output,
+                    char* outputEnd) override
+    {
+        ZSTD_inBuffer in{input, static_cast<std::size_t>(inputEnd - input), 0};
+        ZSTD_outBuffer out{output, static_cast<std::size_t>(outputEnd - output), 0};
+
+        std::size_t result = ZSTD_decompressStream(stream, &out, &in);
+
+        input += in.pos;
+        output += out.pos;
+
+        if (ZSTD_isError(result) != 0U)
+            return false;
+
+        // A result of 0 marks the end of a frame, calls without progress only return a hint
+        if (in.pos != 0 || out.pos != 0)
+            complete = result == 0;
+        return true;
+    }
+
+    [[nodiscard]] bool isComplete() const override { return complete; }
+
+private:
+    ZSTD_DStream* stream;
+    bool complete = false;
+};
+#endif
+
+} // namespace
+
+std::optional<CompressedFile::Format> CompressedFile::getFormat(const std::filesystem::path& path)
+{
+    auto extension = path.extension();
+    if (extension == ".gz")
+        return Format::Gzip;
+    if (extension == ".zst")
+        return Format::Zstd;
+
+    return std::nullopt;
+}
+
+bool CompressedFile::isSupported(Format format)
+{
+    switch (format)
+    {
+    case Format::Gzip:
+#ifdef USE_ZLIB
+        return true;
+#else
+        return false;
+#endif
+    case Format::Zstd:
+#ifdef USE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    return false;
+}
+
+CompressedFile::CompressedFile(const std::string& fileName, Format format) :
+    fileName(fileName),
+    file(fileName)
+{
+#ifdef USE_ZLIB
+    if (format == Format::Gzip)
+        decoder = std::make_unique<GzipDecoder>();
+#endif
+
+#ifdef USE_ZSTD
+    if (format == Format::Zstd)
+        decoder = std::make_unique<ZstdDecoder>();
+#endif
+
+    if (decoder == nullptr)
+        throw std::runtime_error("DRAMSys was built without support for the compression of " +
+                                 fileName);
+}
+
+CompressedFile::~CompressedFile() = default;
+
+std::size_t CompressedFile::read(char* buffer, std::size_t size)
+{
+    const uint8_t* input = file.data() + offset;
+    const uint8_t* inputEnd = file.data() + file.size();
+    char* output = buffer;
+    char* outputEnd = buffer + size;
+
+    // The decoder may hold back output even after all input has been consumed
+    while (output != outputEnd)
+    {
+        const uint8_t* previousInput = input;
+        char* previousOutput = output;
+
+        if (!decoder->decompress(input, inputEnd, output, outputEnd))
+            throw std::runtime_error("Corrupt compressed data in " + fileName);
+
+        // The decoder needs more input than available to make progress
+        if (input == previousInput && output == previousOutput)
+            break;
+    }
+
+    offset = static_cast<std::size_t>(input - file.data());
+
+    if (output == buffer && offset == file.size() && !decoder->isComplete())
+        throw std::runtime_error("Unexpected end of compressed data in " + fileName);
+
+    return static_cast<std::size_t>(output - buffer);
+}
+
+} // namespace DRAMSys
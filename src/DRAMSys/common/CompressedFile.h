@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef COMPRESSEDFILE_H
+#define COMPRESSEDFILE_H
+
+#include "DRAMSys/common/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Streaming decompression of a memory-mapped gzip (.gz) or zstd (.zst) file.
+ *
+ * The formats are only available if DRAMSys was built with zlib or zstd respectively. Throws
+ * std::runtime_error if the file cannot be opened, its format is not supported by this build or
+ * the compressed data is corrupt.
+ */
+class CompressedFile
+{
+public:
+    enum class Format : uint8_t
+    {
+        Gzip,
+        Zstd
+    };
+
+    /**
+     * Returns the format of a file based on its extension or std::nullopt for an uncompressed
+     * file.
+     */
+    static std::optional<Format> getFormat(const std::filesystem::path& path);
+
+    static bool isSupported(Format format);
+
+    CompressedFile(const std::string& fileName, Format format);
+    CompressedFile(const CompressedFile&) = delete;
+    CompressedFile(CompressedFile&&) = delete;
+    CompressedFile& operator=(const CompressedFile&) = delete;
+    CompressedFile& operator=(CompressedFile&&) = delete;
+    ~CompressedFile();
+
+    /**
+     * Decompresses up to size bytes into the buffer. Returns 0 at the end of the file.
+     */
+    std::size_t read(char* buffer, std::size_t size);
+
+    // Number of compressed bytes that have been consumed so far
+    [[nodiscard]] std::size_t getOffset() const { return offset; }
+
+    // Size of the compressed file
+    [[nodiscard]] std::size_t size() const { return file.size(); }
+
+    // Implemented for every supported format in the translation unit
+    struct Decoder;
+
+private:
+
+    std::string fileName;
+    MappedFile file;
+    std::unique_ptr<Decoder> decoder;
+    std::size_t offset = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // COMPRESSEDFILE_H
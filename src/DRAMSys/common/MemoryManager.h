@@ -42,6 +42,7 @@
 #include <stack>
 #include <tlm>
 #include <unordered_map>
+#include <vector>
 
 namespace DRAMSys
 {
@@ -60,7 +61,10 @@ public:
     void free(tlm::tlm_generic_payload* trans) override;
 
 private:
-    std::unordered_map<std::size_t, std::stack<tlm::tlm_generic_payload*>> freePayloads;
+    // Vector based stacks keep their capacity, returning a payload never allocates
+    std::unordered_map<std::size_t,
+                       std::stack<tlm::tlm_generic_payload*, std::vector<tlm::tlm_generic_payload*>>>
+        freePayloads;
     bool storageEnabled;
 };
 
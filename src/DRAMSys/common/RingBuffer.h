@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief FIFO queue on a circular buffer with the interface subset of std::queue used in the
+ * simulator. In contrast to std::queue on a std::deque, the storage is only reallocated when the
+ * queue grows beyond its largest size so far, so that a queue in steady state does not allocate.
+ */
+template <typename T> class RingBuffer
+{
+public:
+    explicit RingBuffer(std::size_t initialCapacity = 16) :
+        storage(roundUpToPowerOfTwo(initialCapacity))
+    {
+    }
+
+    void push(const T& value) { emplace(value); }
+
+    template <typename... Args> void emplace(Args&&... args)
+    {
+        if (count == storage.size())
+            grow();
+
+        storage[(head + count) & (storage.size() - 1)] = T(std::forward<Args>(args)...);
+        count++;
+    }
+
+    void pop()
+    {
+        assert(count > 0);
+        head = (head + 1) & (storage.size() - 1);
+        count--;
+    }
+
+    [[nodiscard]] T& front() { return storage[head]; }
+    [[nodiscard]] const T& front() const { return storage[head]; }
+    [[nodiscard]] bool empty() const { return count == 0; }
+    [[nodiscard]] std::size_t size() const { return count; }
+
+private:
+    static std::size_t roundUpToPowerOfTwo(std::size_t value)
+    {
+        std::size_t result = 1;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    void grow()
+    {
+        std::vector<T> newStorage(storage.size() * 2);
+        for (std::size_t i = 0; i < count; i++)
+            newStorage[i] = std::move(storage[(head + i) & (storage.size() - 1)]);
+
+        storage = std::move(newStorage);
+        head = 0;
+    }
+
+    std::vector<T> storage;
+    std::size_t head = 0;
+    std::size_t count = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // RINGBUFFER_H
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Bounded lock-free ring of slots that is shared between exactly one producer thread and
+ * exactly one consumer thread. The slots are filled and drained in place, so that buffers stored
+ * in the slots (e.g., vectors) keep their capacity and are reused without further allocations.
+ *
+ * The producer acquires the next free slot with tryAcquire(), fills it and hands it over with
+ * publish(). The consumer obtains the oldest published slot with front() and releases it for
+ * reuse with pop().
+ */
+template <typename T> class SpscRing
+{
+public:
+    explicit SpscRing(std::size_t capacity) : slots(capacity) { assert(capacity > 0); }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing(SpscRing&&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+    SpscRing& operator=(SpscRing&&) = delete;
+    ~SpscRing() = default;
+
+    /**
+     * Producer: returns the slot behind the last published one or nullptr if all slots are
+     * still held by the consumer. Repeated calls without publish() return the same slot.
+     */
+    [[nodiscard]] T* tryAcquire()
+    {
+        std::size_t tailPosition = tail.load(std::memory_order_relaxed);
+        if (tailPosition - head.load(std::memory_order_acquire) == slots.size())
+            return nullptr;
+
+        return &slots[tailPosition % slots.size()];
+    }
+
+    /**
+     * Producer: hands the acquired slot over to the consumer.
+     */
+    void publish()
+    {
+        std::size_t tailPosition = tail.load(std::memory_order_relaxed);
+        assert(tailPosition - head.load(std::memory_order_acquire) < slots.size());
+        tail.store(tailPosition + 1, std::memory_order_release);
+    }
+
+    /**
+     * Consumer: returns the oldest published slot or nullptr if there is none.
+     */
+    [[nodiscard]] T* front()
+    {
+        std::size_t headPosition = head.load(std::memory_order_relaxed);
+        if (headPosition == tail.load(std::memory_order_acquire))
+            return nullptr;
+
+        return &slots[headPosition % slots.size()];
+    }
+
+    /**
+     * Consumer: returns the slot obtained with front() to the producer.
+     */
+    void pop()
+    {
+        std::size_t headPosition = head.load(std::memory_order_relaxed);
+        assert(headPosition != tail.load(std::memory_order_acquire));
+        head.store(headPosition + 1, std::memory_order_release);
+    }
+
+    /**
+     * Returns true if the consumer has released all published slots.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::size_t capacity() const { return slots.size(); }
+
+private:
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    std::vector<T> slots;
+
+    // Both positions increase monotonically, the slot index is the position modulo the capacity
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail{0};
+};
+
+} // namespace DRAMSys
+
+#endif // SPSCRING_H
@@ -106,6 +106,8 @@ class MemSpecGDDR6;
 class CheckerGDDR6;
 class MemSpecSTTMRAM;
 class CheckerSTTMRAM;
+class CmdMuxOldest;
+class CmdMuxOldestRasCas;
 
 namespace StandardMapping
 {
@@ -129,6 +131,7 @@ struct Mapping<DRAMUtils::MemSpec::MemSpecDDR4>
 {
     using CheckerType = CheckerDDR4;
     using MemSpecType = MemSpecDDR4;
+    using SpecializedCmdMuxType = CmdMuxOldest;
 #ifdef USE_DRAMPOWER
     using PowerType = DRAMPowerDDR4;
 #endif
@@ -153,6 +156,7 @@ struct Mapping<DRAMUtils::MemSpec::MemSpecLPDDR4>
 {
     using MemSpecType = MemSpecLPDDR4;
     using CheckerType = CheckerLPDDR4;
+    using SpecializedCmdMuxType = CmdMuxOldest;
 #ifdef USE_DRAMPOWER
     using PowerType = DRAMPowerLPDDR4;
 #endif
@@ -203,6 +207,7 @@ struct Mapping<DRAMUtils::MemSpec::MemSpecHBM2>
 {
     using MemSpecType = MemSpecHBM2;
     using CheckerType = CheckerHBM2;
+    using SpecializedCmdMuxType = CmdMuxOldestRasCas;
 };
 
 #ifdef HBM3_4_SIM
@@ -279,6 +284,19 @@ struct has_CheckerType<T, std::void_t<typename StandardMapping ::Mapping<T>::Che
 template <typename T>
 inline constexpr bool has_CheckerType_v = has_CheckerType<T>::value;
 
+// Standards with a SpecializedCmdMuxType get a compile-time specialized controller pipeline
+template <typename T, typename = void>
+struct has_SpecializedCmdMuxType : std::false_type
+{
+};
+template <typename T>
+struct has_SpecializedCmdMuxType<T, std::void_t<typename StandardMapping ::Mapping<T>::SpecializedCmdMuxType>>
+    : std::true_type
+{
+};
+template <typename T>
+inline constexpr bool has_SpecializedCmdMuxType_v = has_SpecializedCmdMuxType<T>::value;
+
 template <typename T, typename = void>
 struct has_PowerType : std::false_type
 {
@@ -42,9 +42,13 @@
 #include "TlmRecorder.h"
 
 #include "DRAMSys/common/DebugManager.h"
+#include "DRAMSys/common/TraceSummaryWriter.h"
+#include "DRAMSys/common/WorkerPool.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <stdexcept>
 #include <sqlite3.h>
 
 using namespace sc_core;
@@ -60,17 +64,35 @@ TlmRecorder::TlmRecorder(const std::string& name,
                          const std::string& dbName,
                          const std::string& mcConfigString,
                          const std::string& memSpecString,
-                         const std::string& traces) :
+                         const std::string& traces,
+                         WorkerPool& writer,
+                         std::size_t writerLane) :
     name(name),
     simConfig(simConfig),
     mcConfig(mcConfig),
     memSpec(memSpec),
-    currentDataBuffer(&recordingDataBuffer.at(0)),
-    storageDataBuffer(&recordingDataBuffer.at(1)),
-    simulationTimeCoveredByRecording(SC_ZERO_TIME)
+    writer(&writer),
+    writerLane(writerLane),
+    batches(std::make_unique<SpscRing<Batch>>(simConfig.recordingQueueDepth)),
+    simulationTimeCoveredByRecording(SC_ZERO_TIME),
+    history(simConfig.recordingHistoryLength),
+    triggerLatency(simConfig.recordingTriggerLatency, SC_SEC)
 {
-    currentDataBuffer->reserve(transactionCommitRate);
-    storageDataBuffer->reserve(transactionCommitRate);
+    acquireBatch();
+
+    for (const auto& [start, end] : simConfig.recordingTimeWindows)
+        recordingTimeWindows.emplace_back(sc_time(start, SC_SEC), sc_time(end, SC_SEC));
+
+    filtersEnabled = !recordingTimeWindows.empty() || !simConfig.recordingThreads.empty() ||
+                     simConfig.recordingSampleInterval > 1;
+
+    TraceMetadata metadata = createMetadata(mcConfigString, memSpecString, traces);
+
+    if (simConfig.recordingFormat == Config::RecordingFormatType::Columnar)
+    {
+        columnarTrace = std::make_unique<ColumnarTraceWriter>(dbName, metadata);
+        return;
+    }
 
     openDB(dbName);
     char* sErrMsg = nullptr;
@@ -83,16 +105,62 @@ TlmRecorder::TlmRecorder(const std::string& name,
     executeInitialSqlCommand();
     prepareSqlStatements();
 
-    insertGeneralInfo(mcConfigString, memSpecString, traces);
-    insertCommandLengths();
+    insertGeneralInfo(metadata);
+    insertCommandLengths(metadata);
+    insertPhaseNames(metadata);
+    summary = std::make_unique<TraceSummary>(metadata);
 
     PRINTDEBUGMESSAGE(name, "Starting new database transaction");
 }
 
+void TlmRecorder::finishRecording()
+{
+    if (recordingFinished)
+        return;
+
+    terminateRemainingTransactions();
+    if (!currentBatch->empty())
+        submitCurrentBatch();
+    waitForWriter();
+    recordingFinished = true;
+
+    PRINTDEBUGMESSAGE(
+        name,
+        "Number of transactions written to DB: " + std::to_string(numberOfCommittedTransactions));
+    PRINTDEBUGMESSAGE(name, "tlmPhaseRecorder:\tEnd Recording");
+}
+
 void TlmRecorder::finalize()
 {
-    if (db != nullptr)
-        closeConnection();
+    if (columnarTrace)
+    {
+        finishRecording();
+        columnarTrace->close();
+        columnarTrace.reset();
+        return;
+    }
+
+    if (db == nullptr)
+        return;
+
+    finishRecording();
+    finalizing = true;
+
+    // The statements have to be finalized before the tables are altered and the database is closed
+    finalizeSqlStatements();
+
+    insertSummaryInDB();
+
+    if (simConfig.recordingBulkLoad)
+        executeSqlCommand("BEGIN;" + std::string(TraceSchema::bulkLoadRangesCommand) +
+                          std::string(TraceSchema::createIndexesCommand) + "COMMIT;");
+
+    sqlite3_close(db);
+    db = nullptr;
+}
+
+void TlmRecorder::finalizeSqlStatements()
+{
     sqlite3_finalize(insertTransactionStatement);
     sqlite3_finalize(insertRangeStatement);
     sqlite3_finalize(updateRangeStatement);
@@ -100,6 +168,7 @@ void TlmRecorder::finalize()
     sqlite3_finalize(updatePhaseStatement);
     sqlite3_finalize(insertGeneralInfoStatement);
     sqlite3_finalize(insertCommandLengthsStatement);
+    sqlite3_finalize(insertPhaseNameStatement);
     sqlite3_finalize(insertDebugMessageStatement);
     sqlite3_finalize(insertPowerStatement);
     sqlite3_finalize(insertBufferDepthStatement);
@@ -108,6 +177,12 @@ void TlmRecorder::finalize()
 
 void TlmRecorder::recordPower(double timeInSeconds, double averagePower)
 {
+    if (columnarTrace)
+    {
+        columnarTrace->append(ColumnarTrace::PowerRecord{timeInSeconds, averagePower});
+        return;
+    }
+
     sqlite3_bind_double(insertPowerStatement, 1, timeInSeconds);
     sqlite3_bind_double(insertPowerStatement, 2, averagePower);
     executeSqlStatement(insertPowerStatement);
@@ -116,6 +191,16 @@ void TlmRecorder::recordPower(double timeInSeconds, double averagePower)
 void TlmRecorder::recordBufferDepth(double timeInSeconds,
                                     const std::vector<double>& averageBufferDepth)
 {
+    if (columnarTrace)
+    {
+        for (size_t index = 0; index < averageBufferDepth.size(); index++)
+        {
+            columnarTrace->append(ColumnarTrace::BufferDepthRecord{
+                timeInSeconds, static_cast<uint32_t>(index), averageBufferDepth[index]});
+        }
+        return;
+    }
+
     for (size_t index = 0; index < averageBufferDepth.size(); index++)
     {
         sqlite3_bind_double(insertBufferDepthStatement, 1, timeInSeconds);
@@ -127,6 +212,12 @@ void TlmRecorder::recordBufferDepth(double timeInSeconds,
 
 void TlmRecorder::recordBandwidth(double timeInSeconds, double averageBandwidth)
 {
+    if (columnarTrace)
+    {
+        columnarTrace->append(ColumnarTrace::BandwidthRecord{timeInSeconds, averageBandwidth});
+        return;
+    }
+
     sqlite3_bind_double(insertBandwidthStatement, 1, timeInSeconds);
     sqlite3_bind_double(insertBandwidthStatement, 2, averageBandwidth);
     executeSqlStatement(insertBandwidthStatement);
@@ -138,30 +229,27 @@ void TlmRecorder::recordPhase(const tlm_generic_payload& trans,
 {
     const sc_time& currentTime = sc_time_stamp();
 
+    if (filtersEnabled && skipFilteredPhase(trans, phase, currentTime + delay))
+        return;
+
     if (phase == BEGIN_REQ)
     {
         introduceTransactionToSystem(trans);
-        std::string phaseName = getPhaseName(phase).substr(6);
-        currentTransactionsInSystem.at(&trans).recordedPhases.emplace_back(phaseName,
-                                                                           currentTime + delay);
+        getTransaction(trans).recordedPhases.emplace_back(getPhaseId(phase), currentTime + delay);
     }
     if (phase == BEGIN_RESP)
     {
-        std::string phaseName = getPhaseName(phase).substr(6);
-        currentTransactionsInSystem.at(&trans).recordedPhases.emplace_back(phaseName,
-                                                                           currentTime + delay);
+        getTransaction(trans).recordedPhases.emplace_back(getPhaseId(phase), currentTime + delay);
     }
     else if (phase == END_REQ)
     {
         // BEGIN_REQ is always the first phase of a normal transaction
-        currentTransactionsInSystem.at(&trans).recordedPhases.front().interval.end =
-            currentTime + delay;
+        getTransaction(trans).recordedPhases.front().interval.end = currentTime + delay;
     }
     else if (phase == END_RESP)
     {
         // BEGIN_RESP is always the last phase of a normal transaction at this point
-        currentTransactionsInSystem.at(&trans).recordedPhases.back().interval.end =
-            currentTime + delay;
+        getTransaction(trans).recordedPhases.back().interval.end = currentTime + delay;
         removeTransactionFromSystem(trans);
     }
     else if (isFixedCommandPhase(phase))
@@ -173,13 +261,12 @@ void TlmRecorder::recordPhase(const tlm_generic_payload& trans,
             }
             else
             {
-                if (currentTransactionsInSystem.find(&trans) == currentTransactionsInSystem.end())
+                if (RecorderExtension::getSlot(trans) == RecorderExtension::INVALID_SLOT)
                     introduceTransactionToSystem(trans);
                 return &trans;
             }
         }();
 
-        std::string phaseName = getPhaseName(phase).substr(6); // remove "BEGIN_"
         const ControllerExtension& extension = ControllerExtension::getExtension(trans);
         TimeInterval intervalOnDataStrobe;
         if (phaseHasDataStrobe(phase))
@@ -189,8 +276,8 @@ void TlmRecorder::recordPhase(const tlm_generic_payload& trans,
             intervalOnDataStrobe.end = currentTime + delay + intervalOnDataStrobe.end;
         }
 
-        currentTransactionsInSystem.at(keyTrans).recordedPhases.emplace_back(
-            std::move(phaseName),
+        getTransaction(*keyTrans).recordedPhases.emplace_back(
+            getPhaseId(phase),
             std::move(TimeInterval(currentTime + delay,
                                    currentTime + delay +
                                        memSpec.getExecutionTime(Command(phase), trans))),
@@ -208,10 +295,9 @@ void TlmRecorder::recordPhase(const tlm_generic_payload& trans,
     else if (isPowerDownEntryPhase(phase))
     {
         introduceTransactionToSystem(trans);
-        std::string phaseName = getPhaseName(phase).substr(6); // remove "BEGIN_"
         const ControllerExtension& extension = ControllerExtension::getExtension(trans);
-        currentTransactionsInSystem.at(&trans).recordedPhases.emplace_back(
-            std::move(phaseName),
+        getTransaction(trans).recordedPhases.emplace_back(
+            getPhaseId(phase),
             std::move(TimeInterval(currentTime + delay, SC_ZERO_TIME)),
             std::move(TimeInterval(SC_ZERO_TIME, SC_ZERO_TIME)),
             extension.getRank(),
@@ -223,7 +309,7 @@ void TlmRecorder::recordPhase(const tlm_generic_payload& trans,
     }
     else if (isPowerDownExitPhase(phase))
     {
-        currentTransactionsInSystem.at(&trans).recordedPhases.back().interval.end =
+        getTransaction(trans).recordedPhases.back().interval.end =
             currentTime + delay + memSpec.getCommandLength(Command(phase));
         removeTransactionFromSystem(trans);
     }
@@ -233,11 +319,73 @@ void TlmRecorder::recordPhase(const tlm_generic_payload& trans,
 
 void TlmRecorder::recordDebugMessage(const std::string& message, const sc_time& time)
 {
-    insertDebugMessageInDB(message, time);
+    if (columnarTrace)
+        columnarTrace->append(ColumnarTrace::DebugMessageRecord{time.value(), message});
+    else
+        insertDebugMessageInDB(message, time);
 }
 
 // ------------- internal -----------------------
 
+bool TlmRecorder::isRecorded(const tlm_generic_payload& trans, const sc_time& time)
+{
+    if (!recordingTimeWindows.empty() &&
+        std::none_of(recordingTimeWindows.cbegin(),
+                     recordingTimeWindows.cend(),
+                     [&time](const TimeInterval& window)
+                     { return time >= window.start && time < window.end; }))
+        return false;
+
+    // Refreshes and power-down phases of the controller are not associated with a thread and
+    // are always recorded within the time windows
+    if (trans.get_command() == TLM_IGNORE_COMMAND)
+        return true;
+
+    const auto& recordingThreads = simConfig.recordingThreads;
+    if (!recordingThreads.empty())
+    {
+        auto thread = static_cast<unsigned int>(ArbiterExtension::getThread(trans));
+        if (std::find(recordingThreads.cbegin(), recordingThreads.cend(), thread) ==
+            recordingThreads.cend())
+            return false;
+    }
+
+    return sampleCounter++ % simConfig.recordingSampleInterval == 0;
+}
+
+bool TlmRecorder::skipFilteredPhase(const tlm_generic_payload& trans,
+                                    const tlm_phase& phase,
+                                    const sc_time& time)
+{
+    // Commands of child transactions belong to their parent transaction
+    const tlm_generic_payload& keyTrans =
+        ChildExtension::isChildTrans(trans)
+            ? trans.get_extension<ChildExtension>()->getParentTrans()
+            : trans;
+    uint32_t slot = RecorderExtension::getSlot(keyTrans);
+
+    if (slot == RecorderExtension::FILTERED_SLOT)
+    {
+        // The payload is reused after its last phase
+        if (phase == END_RESP || isPowerDownExitPhase(phase))
+            RecorderExtension::setSlot(const_cast<tlm_generic_payload&>(trans),
+                                       RecorderExtension::INVALID_SLOT);
+        return true;
+    }
+
+    bool startsTransaction = phase == BEGIN_REQ || isPowerDownEntryPhase(phase) ||
+                             (isFixedCommandPhase(phase) && &keyTrans == &trans &&
+                              slot == RecorderExtension::INVALID_SLOT);
+    if (!startsTransaction || isRecorded(trans, time))
+        return false;
+
+    // Refreshes end with their only phase, all other transactions are skipped until they end
+    if (!isRefreshCommandPhase(phase))
+        RecorderExtension::setSlot(const_cast<tlm_generic_payload&>(trans),
+                                   RecorderExtension::FILTERED_SLOT);
+    return true;
+}
+
 void TlmRecorder::introduceTransactionToSystem(const tlm_generic_payload& trans)
 {
     totalNumTransactions++;
@@ -253,76 +401,227 @@ void TlmRecorder::introduceTransactionToSystem(const tlm_generic_payload& trans)
 
     const ArbiterExtension& extension = ArbiterExtension::getExtension(trans);
 
-    currentTransactionsInSystem.insert({&trans,
-                                        Transaction(totalNumTransactions,
-                                                    trans.get_address(),
-                                                    trans.get_data_length(),
-                                                    commandChar,
-                                                    extension.getTimeOfGeneration(),
-                                                    extension.getThread(),
-                                                    extension.getChannel())});
+    uint32_t slot = 0;
+    if (freeSlots.empty())
+    {
+        slot = static_cast<uint32_t>(transactionSlots.size());
+        transactionSlots.emplace_back();
+        slotPayloads.emplace_back();
+    }
+    else
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+
+    // The phases of a transaction that was retained in the history are reused
+    Transaction& transaction = transactionSlots[slot];
+    std::vector<Transaction::Phase> recordedPhases = std::move(transaction.recordedPhases);
+    recordedPhases.clear();
+    transaction = Transaction(totalNumTransactions,
+                              trans.get_address(),
+                              trans.get_data_length(),
+                              commandChar,
+                              extension.getTimeOfGeneration(),
+                              extension.getThread(),
+                              extension.getChannel());
+    transaction.recordedPhases = std::move(recordedPhases);
+    slotPayloads[slot] = &trans;
+
+    // The slot is bookkeeping of the recorder, the transaction itself is not modified
+    RecorderExtension::setSlot(const_cast<tlm_generic_payload&>(trans), slot);
 
     PRINTDEBUGMESSAGE(name,
                       "New transaction #" + std::to_string(totalNumTransactions) +
-                          " generation time " +
-                          currentTransactionsInSystem.at(&trans).timeOfGeneration.to_string());
+                          " generation time " + transaction.timeOfGeneration.to_string());
 }
 
 void TlmRecorder::removeTransactionFromSystem(const tlm_generic_payload& trans)
 {
-    assert(currentTransactionsInSystem.count(&trans) != 0);
+    uint32_t slot = RecorderExtension::getSlot(trans);
+    assert(slot != RecorderExtension::INVALID_SLOT);
 
-    PRINTDEBUGMESSAGE(
-        name, "Removing transaction #" + std::to_string(currentTransactionsInSystem.at(&trans).id));
+    Transaction& transaction = transactionSlots[slot];
+
+    PRINTDEBUGMESSAGE(name, "Removing transaction #" + std::to_string(transaction.id));
+
+    if (!history.empty())
+    {
+        // The transaction that exceeds the latency is the first one after the history
+        if (exceedsTriggerLatency(transaction))
+            trigger("request latency");
+        else if (postTriggerTransactions == 0)
+        {
+            retainInHistory(transaction);
+            releaseSlot(slot);
+            return;
+        }
+        else
+            postTriggerTransactions--;
+    }
+
+    commitTransaction(std::move(transaction));
+    releaseSlot(slot);
+}
+
+void TlmRecorder::trigger(std::string_view reason)
+{
+    if (history.empty() || recordingFinished)
+        return;
+
+    // Triggers that only extend the current period are not marked
+    if (historySize > 0 || postTriggerTransactions == 0)
+        recordDebugMessage("Flight recorder triggered by " + std::string(reason), sc_time_stamp());
+
+    for (std::size_t index = 0; index < historySize; index++)
+        commitTransaction(std::move(history[(historyBegin + index) % history.size()]));
+
+    historyBegin = 0;
+    historySize = 0;
+    postTriggerTransactions = simConfig.recordingPostTriggerLength;
+}
+
+bool TlmRecorder::exceedsTriggerLatency(const Transaction& transaction) const
+{
+    if (triggerLatency == SC_ZERO_TIME || transaction.cmd == 'X')
+        return false;
+
+    // BEGIN_REQ is the first and BEGIN_RESP the last phase of a completed transaction
+    return transaction.recordedPhases.back().interval.start -
+               transaction.recordedPhases.front().interval.start >
+           triggerLatency;
+}
+
+void TlmRecorder::retainInHistory(Transaction& transaction)
+{
+    // The oldest entry is overwritten, its phases are handed back to the slot for reuse
+    std::size_t index = (historyBegin + historySize) % history.size();
+    std::swap(history[index], transaction);
+
+    if (historySize == history.size())
+        historyBegin = (historyBegin + 1) % history.size();
+    else
+        historySize++;
+}
+
+void TlmRecorder::commitTransaction(Transaction&& transaction)
+{
+    numberOfCommittedTransactions++;
+
+    // The transactions dropped from the history would leave gaps, the trace analyzer expects the
+    // IDs to be contiguous
+    if (!history.empty())
+        transaction.id = numberOfCommittedTransactions;
+
+    currentBatch->push_back(std::move(transaction));
+
+    if (currentBatch->size() == simConfig.recordingBatchSize)
+    {
+        submitCurrentBatch();
+        acquireBatch();
+    }
+}
+
+void TlmRecorder::submitCurrentBatch()
+{
+    batches->publish();
+    writer->submit(writerLane, [this]() { commitPendingBatches(); });
+}
 
-    Transaction& recordingData = currentTransactionsInSystem.at(&trans);
-    currentDataBuffer->push_back(recordingData);
-    currentTransactionsInSystem.erase(&trans);
+void TlmRecorder::acquireBatch()
+{
+    currentBatch = batches->tryAcquire();
 
-    if (currentDataBuffer->size() == transactionCommitRate)
+    if (currentBatch == nullptr)
     {
-        if (storageThread.joinable())
-            storageThread.join();
+        // All batches are still waiting to be committed, apply backpressure. Every batch is
+        // published before its commit task is submitted, so all of them are free afterwards.
+        numberOfStalls++;
+        auto begin = std::chrono::steady_clock::now();
+        writer->wait(writerLane);
+        currentBatch = batches->tryAcquire();
+        blockedTime += std::chrono::steady_clock::now() - begin;
+    }
+
+    // Only allocates the first time a batch slot is used
+    currentBatch->reserve(simConfig.recordingBatchSize);
+}
 
-        std::swap(currentDataBuffer, storageDataBuffer);
+void TlmRecorder::waitForWriter()
+{
+    writer->wait(writerLane);
+}
 
-        storageThread = std::thread(&TlmRecorder::commitRecordedDataToDB, this);
-        currentDataBuffer->clear();
+void TlmRecorder::commitPendingBatches()
+{
+    while (Batch* batch = batches->front())
+    {
+        if (columnarTrace)
+            commitBatchToColumnarTrace(*batch);
+        else
+            commitBatchToDB(*batch);
+        batch->clear();
+        batches->pop();
     }
 }
 
+TlmRecorder::Transaction& TlmRecorder::getTransaction(const tlm_generic_payload& trans)
+{
+    uint32_t slot = RecorderExtension::getSlot(trans);
+    assert(slot != RecorderExtension::INVALID_SLOT);
+    return transactionSlots[slot];
+}
+
+void TlmRecorder::releaseSlot(uint32_t slot)
+{
+    RecorderExtension::setSlot(const_cast<tlm_generic_payload&>(*slotPayloads[slot]),
+                               RecorderExtension::INVALID_SLOT);
+    slotPayloads[slot] = nullptr;
+    freeSlots.push_back(slot);
+}
+
 void TlmRecorder::terminateRemainingTransactions()
 {
-    while (!currentTransactionsInSystem.empty())
+    // Terminate the remaining transactions in the order they were introduced
+    std::vector<uint32_t> remainingSlots;
+    for (uint32_t slot = 0; slot < slotPayloads.size(); slot++)
+    {
+        if (slotPayloads[slot] != nullptr)
+            remainingSlots.push_back(slot);
+    }
+
+    std::sort(remainingSlots.begin(),
+              remainingSlots.end(),
+              [this](uint32_t l, uint32_t r)
+              { return transactionSlots[l].id < transactionSlots[r].id; });
+
+    for (uint32_t slot : remainingSlots)
     {
-        auto transaction =
-            std::min_element(currentTransactionsInSystem.begin(),
-                             currentTransactionsInSystem.end(),
-                             [](decltype(currentTransactionsInSystem)::value_type& l,
-                                decltype(currentTransactionsInSystem)::value_type& r) -> bool
-                             { return l.second.id < r.second.id; });
-        if (transaction->second.cmd == 'X')
+        const tlm_generic_payload& trans = *slotPayloads[slot];
+        const Transaction& transaction = transactionSlots[slot];
+
+        if (transaction.cmd == 'X')
         {
-            std::string beginPhase = transaction->second.recordedPhases.front().name;
-            if (beginPhase == "PDNA")
-                recordPhase(*(transaction->first), END_PDNA, SC_ZERO_TIME);
-            else if (beginPhase == "PDNP")
-                recordPhase(*(transaction->first), END_PDNP, SC_ZERO_TIME);
-            else if (beginPhase == "SREF")
-                recordPhase(*(transaction->first), END_SREF, SC_ZERO_TIME);
+            uint8_t beginPhase = transaction.recordedPhases.front().id;
+            if (beginPhase == getPhaseId(BEGIN_PDNA))
+                recordPhase(trans, END_PDNA, SC_ZERO_TIME);
+            else if (beginPhase == getPhaseId(BEGIN_PDNP))
+                recordPhase(trans, END_PDNP, SC_ZERO_TIME);
+            else if (beginPhase == getPhaseId(BEGIN_SREF))
+                recordPhase(trans, END_SREF, SC_ZERO_TIME);
             else
-                removeTransactionFromSystem(*transaction->first);
+                removeTransactionFromSystem(trans);
         }
         else
         {
-            std::string beginPhase = transaction->second.recordedPhases.back().name;
+            uint8_t beginPhase = transaction.recordedPhases.back().id;
 
-            if (beginPhase == "RESP")
-                recordPhase(*(transaction->first), END_RESP, SC_ZERO_TIME);
+            if (beginPhase == getPhaseId(BEGIN_RESP))
+                recordPhase(trans, END_RESP, SC_ZERO_TIME);
             else
             {
                 // Do not terminate transaction as it is not ready to be completed.
-                currentTransactionsInSystem.erase(transaction);
+                releaseSlot(slot);
 
                 // Decrement totalNumTransactions as this transaction will not be recorded in the
                 // database.
@@ -332,28 +631,79 @@ void TlmRecorder::terminateRemainingTransactions()
     }
 }
 
-void TlmRecorder::commitRecordedDataToDB()
+void TlmRecorder::commitBatchToDB(const std::vector<Transaction>& batch)
 {
     sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr);
-    for (const Transaction& transaction : *storageDataBuffer)
+    for (const Transaction& transaction : batch)
     {
         assert(!transaction.recordedPhases.empty());
         insertTransactionInDB(transaction);
+        summary->addTransaction(transaction.thread, transaction.cmd, transaction.dataLength);
         for (const Transaction::Phase& phase : transaction.recordedPhases)
         {
             insertPhaseInDB(phase, transaction.id);
+            summary->addPhase(transaction.id,
+                              phase.id,
+                              phase.interval.start.value(),
+                              phase.interval.end.value(),
+                              phase.intervalOnDataStrobe.start.value(),
+                              phase.intervalOnDataStrobe.end.value(),
+                              phase.rank,
+                              phase.bank);
         }
 
-        sc_time rangeBegin = transaction.recordedPhases.front().interval.start;
-        sc_time rangeEnd = rangeBegin;
+        TimeInterval range = getRange(transaction);
+        insertRangeInDB(transaction.id, range.start, range.end);
+    }
+
+    sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+}
+
+void TlmRecorder::commitBatchToColumnarTrace(const std::vector<Transaction>& batch)
+{
+    for (const Transaction& transaction : batch)
+    {
+        assert(!transaction.recordedPhases.empty());
+
+        TimeInterval range = getRange(transaction);
+        columnarTrace->append(ColumnarTrace::TransactionRecord{transaction.id,
+                                                               transaction.address,
+                                                               transaction.dataLength,
+                                                               transaction.thread,
+                                                               transaction.channel,
+                                                               transaction.timeOfGeneration.value(),
+                                                               transaction.cmd,
+                                                               range.start.value(),
+                                                               range.end.value()});
+
         for (const Transaction::Phase& phase : transaction.recordedPhases)
         {
-            rangeEnd = std::max(rangeEnd, phase.interval.end);
+            columnarTrace->append(
+                ColumnarTrace::PhaseRecord{transaction.id,
+                                           phase.id,
+                                           phase.interval.start.value(),
+                                           phase.interval.end.value(),
+                                           phase.intervalOnDataStrobe.start.value(),
+                                           phase.intervalOnDataStrobe.end.value(),
+                                           phase.rank,
+                                           phase.bankGroup,
+                                           phase.bank,
+                                           phase.row,
+                                           phase.column,
+                                           phase.burstLength});
         }
-        insertRangeInDB(transaction.id, rangeBegin, rangeEnd);
     }
+}
 
-    sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+TimeInterval TlmRecorder::getRange(const Transaction& transaction)
+{
+    sc_time rangeBegin = transaction.recordedPhases.front().interval.start;
+    sc_time rangeEnd = rangeBegin;
+    for (const Transaction::Phase& phase : transaction.recordedPhases)
+    {
+        rangeEnd = std::max(rangeEnd, phase.interval.end);
+    }
+    return {rangeBegin, rangeEnd};
 }
 
 void TlmRecorder::openDB(const std::string& dbName)
@@ -378,14 +728,14 @@ void TlmRecorder::prepareSqlStatements()
     updateRangeString = "UPDATE Ranges SET  End = :end WHERE ID = :id";
 
     insertPhaseString =
-        "INSERT INTO Phases "
-        "(PhaseName,PhaseBegin,PhaseEnd,DataStrobeBegin,DataStrobeEnd,Rank,BankGroup,Bank,"
+        "INSERT INTO PhaseData "
+        "(PhaseNameID,PhaseBegin,PhaseEnd,DataStrobeBegin,DataStrobeEnd,Rank,BankGroup,Bank,"
         "Row,Column,BurstLength,Transact) VALUES "
-        "(:name,:begin,:end,:strobeBegin,:strobeEnd,:rank,:bankGroup,:bank,"
+        "(:nameID,:begin,:end,:strobeBegin,:strobeEnd,:rank,:bankGroup,:bank,"
         ":row,:column,:burstLength,:transaction)";
 
     updatePhaseString =
-        "UPDATE Phases SET PhaseEnd = :end WHERE Transact = :trans AND PhaseName = :name";
+        "UPDATE PhaseData SET PhaseEnd = :end WHERE Transact = :trans AND PhaseNameID = :nameID";
 
     insertGeneralInfoString =
         "INSERT INTO GeneralInfo VALUES"
@@ -397,6 +747,8 @@ void TlmRecorder::prepareSqlStatements()
     insertCommandLengthsString = "INSERT INTO CommandLengths VALUES"
                                  "(:command, :length)";
 
+    insertPhaseNameString = "INSERT INTO PhaseNames VALUES (:id, :name)";
+
     insertDebugMessageString = "INSERT INTO DebugMessages (Time,Message) Values (:time,:message)";
 
     insertPowerString = "INSERT INTO Power VALUES (:time,:averagePower)";
@@ -414,6 +766,7 @@ void TlmRecorder::prepareSqlStatements()
         db, insertGeneralInfoString.c_str(), -1, &insertGeneralInfoStatement, nullptr);
     sqlite3_prepare_v2(
         db, insertCommandLengthsString.c_str(), -1, &insertCommandLengthsStatement, nullptr);
+    sqlite3_prepare_v2(db, insertPhaseNameString.c_str(), -1, &insertPhaseNameStatement, nullptr);
     sqlite3_prepare_v2(
         db, insertDebugMessageString.c_str(), -1, &insertDebugMessageStatement, nullptr);
     sqlite3_prepare_v2(db, insertPowerString.c_str(), -1, &insertPowerStatement, nullptr);
@@ -433,69 +786,120 @@ void TlmRecorder::insertDebugMessageInDB(const std::string& message, const sc_ti
     executeSqlStatement(insertDebugMessageStatement);
 }
 
-void TlmRecorder::insertGeneralInfo(const std::string& mcConfigString,
-                                    const std::string& memSpecString,
-                                    const std::string& traces)
+TraceMetadata TlmRecorder::createMetadata(const std::string& mcConfigString,
+                                          const std::string& memSpecString,
+                                          const std::string& traces) const
+{
+    TraceMetadata metadata;
+    metadata.numberOfRanks = memSpec.ranksPerChannel;
+    metadata.numberOfBankGroups = memSpec.bankGroupsPerChannel;
+    metadata.numberOfBanks = memSpec.banksPerChannel;
+    metadata.clk = memSpec.tCK.value();
+    metadata.unitOfTime = "PS";
+    metadata.mcConfig = mcConfigString;
+    metadata.memSpec = memSpecString;
+    metadata.traces = traces;
+    metadata.windowSize =
+        simConfig.enableWindowing ? (memSpec.tCK * simConfig.windowSize).value() : 0;
+    metadata.refreshMaxPostponed = mcConfig.refreshMaxPostponed;
+    metadata.refreshMaxPulledin = mcConfig.refreshMaxPulledin;
+    metadata.controllerThread = UINT_MAX;
+    metadata.maxBufferDepth = mcConfig.requestBufferSize;
+    metadata.per2BankOffset = memSpec.getPer2BankOffset();
+    metadata.rowColumnCommandBus = memSpec.hasRasAndCasBus();
+    metadata.pseudoChannelMode = memSpec.pseudoChannelMode();
+    metadata.timeResolution = sc_get_time_resolution().to_seconds();
+
+    for (unsigned int command = 0; command < Command::END_ENUM; ++command)
+    {
+        Command cmd(static_cast<Command::Type>(command));
+        metadata.commandLengths.emplace_back(cmd.toString(), memSpec.getCommandLengthInCycles(cmd));
+    }
+
+    auto addPhaseName = [&metadata](const tlm_phase& phase)
+    {
+        std::string phaseName = getPhaseName(phase);
+        if (phaseName.rfind("BEGIN_", 0) != 0)
+            return;
+
+        // remove "BEGIN_"
+        metadata.phaseNames.emplace_back(getPhaseId(phase), phaseName.substr(6));
+    };
+
+    addPhaseName(BEGIN_REQ);
+    addPhaseName(BEGIN_RESP);
+    for (unsigned int command = 0; command < Command::END_ENUM; ++command)
+        addPhaseName(Command(static_cast<Command::Type>(command)).toPhase());
+
+    return metadata;
+}
+
+void TlmRecorder::insertGeneralInfo(const TraceMetadata& metadata)
 {
-    sqlite3_bind_int(insertGeneralInfoStatement, 1, static_cast<int>(memSpec.ranksPerChannel));
-    sqlite3_bind_int(insertGeneralInfoStatement, 2, static_cast<int>(memSpec.bankGroupsPerChannel));
-    sqlite3_bind_int(insertGeneralInfoStatement, 3, static_cast<int>(memSpec.banksPerChannel));
-    sqlite3_bind_int64(insertGeneralInfoStatement, 4, static_cast<int64_t>(memSpec.tCK.value()));
-    sqlite3_bind_text(insertGeneralInfoStatement, 5, "PS", 2, nullptr);
+    sqlite3_bind_int(insertGeneralInfoStatement, 1, static_cast<int>(metadata.numberOfRanks));
+    sqlite3_bind_int(insertGeneralInfoStatement, 2, static_cast<int>(metadata.numberOfBankGroups));
+    sqlite3_bind_int(insertGeneralInfoStatement, 3, static_cast<int>(metadata.numberOfBanks));
+    sqlite3_bind_int64(insertGeneralInfoStatement, 4, static_cast<int64_t>(metadata.clk));
+    sqlite3_bind_text(insertGeneralInfoStatement,
+                      5,
+                      metadata.unitOfTime.c_str(),
+                      static_cast<int>(metadata.unitOfTime.length()),
+                      nullptr);
 
     sqlite3_bind_text(insertGeneralInfoStatement,
                       6,
-                      mcConfigString.c_str(),
-                      static_cast<int>(mcConfigString.length()),
+                      metadata.mcConfig.c_str(),
+                      static_cast<int>(metadata.mcConfig.length()),
                       nullptr);
     sqlite3_bind_text(insertGeneralInfoStatement,
                       7,
-                      memSpecString.c_str(),
-                      static_cast<int>(memSpecString.length()),
+                      metadata.memSpec.c_str(),
+                      static_cast<int>(metadata.memSpec.length()),
                       nullptr);
-    sqlite3_bind_text(
-        insertGeneralInfoStatement, 8, traces.c_str(), static_cast<int>(traces.length()), nullptr);
-
-    if (simConfig.enableWindowing)
-    {
-        sqlite3_bind_int64(insertGeneralInfoStatement,
-                           9,
-                           static_cast<int64_t>((memSpec.tCK * simConfig.windowSize).value()));
-    }
-    else
-    {
-        sqlite3_bind_int64(insertGeneralInfoStatement, 9, 0);
-    }
+    sqlite3_bind_text(insertGeneralInfoStatement,
+                      8,
+                      metadata.traces.c_str(),
+                      static_cast<int>(metadata.traces.length()),
+                      nullptr);
+    sqlite3_bind_int64(insertGeneralInfoStatement, 9, static_cast<int64_t>(metadata.windowSize));
     sqlite3_bind_int(
-        insertGeneralInfoStatement, 10, static_cast<int>(mcConfig.refreshMaxPostponed));
-    sqlite3_bind_int(insertGeneralInfoStatement, 11, static_cast<int>(mcConfig.refreshMaxPulledin));
-    sqlite3_bind_int(insertGeneralInfoStatement, 12, static_cast<int>(UINT_MAX));
-    sqlite3_bind_int(insertGeneralInfoStatement, 13, static_cast<int>(mcConfig.requestBufferSize));
-    sqlite3_bind_int(insertGeneralInfoStatement, 14, static_cast<int>(memSpec.getPer2BankOffset()));
-
-    bool rowColumnCommandBus = memSpec.hasRasAndCasBus();
-    bool pseudoChannelMode = memSpec.pseudoChannelMode();
-
-    sqlite3_bind_int(insertGeneralInfoStatement, 15, static_cast<int>(rowColumnCommandBus));
-    sqlite3_bind_int(insertGeneralInfoStatement, 16, static_cast<int>(pseudoChannelMode));
+        insertGeneralInfoStatement, 10, static_cast<int>(metadata.refreshMaxPostponed));
+    sqlite3_bind_int(insertGeneralInfoStatement, 11, static_cast<int>(metadata.refreshMaxPulledin));
+    sqlite3_bind_int(insertGeneralInfoStatement, 12, static_cast<int>(metadata.controllerThread));
+    sqlite3_bind_int(insertGeneralInfoStatement, 13, static_cast<int>(metadata.maxBufferDepth));
+    sqlite3_bind_int(insertGeneralInfoStatement, 14, static_cast<int>(metadata.per2BankOffset));
+    sqlite3_bind_int(
+        insertGeneralInfoStatement, 15, static_cast<int>(metadata.rowColumnCommandBus));
+    sqlite3_bind_int(insertGeneralInfoStatement, 16, static_cast<int>(metadata.pseudoChannelMode));
     executeSqlStatement(insertGeneralInfoStatement);
 }
 
-void TlmRecorder::insertCommandLengths()
+void TlmRecorder::insertCommandLengths(const TraceMetadata& metadata)
 {
-    auto insertCommandLength = [this](Command command)
+    for (const auto& [command, length] : metadata.commandLengths)
     {
-        auto commandName = command.toString();
-
-        sqlite3_bind_text(
-            insertCommandLengthsStatement, 1, commandName.c_str(), commandName.length(), nullptr);
-        sqlite3_bind_double(
-            insertCommandLengthsStatement, 2, memSpec.getCommandLengthInCycles(command));
+        sqlite3_bind_text(insertCommandLengthsStatement,
+                          1,
+                          command.c_str(),
+                          static_cast<int>(command.length()),
+                          nullptr);
+        sqlite3_bind_double(insertCommandLengthsStatement, 2, length);
         executeSqlStatement(insertCommandLengthsStatement);
-    };
+    }
+}
 
-    for (unsigned int command = 0; command < Command::END_ENUM; ++command)
-        insertCommandLength(static_cast<Command::Type>(command));
+void TlmRecorder::insertPhaseNames(const TraceMetadata& metadata)
+{
+    for (const auto& [id, phaseName] : metadata.phaseNames)
+    {
+        sqlite3_bind_int(insertPhaseNameStatement, 1, id);
+        sqlite3_bind_text(insertPhaseNameStatement,
+                          2,
+                          phaseName.c_str(),
+                          static_cast<int>(phaseName.length()),
+                          nullptr);
+        executeSqlStatement(insertPhaseNameStatement);
+    }
 }
 
 void TlmRecorder::insertTransactionInDB(const Transaction& recordingData)
@@ -524,11 +928,7 @@ void TlmRecorder::insertRangeInDB(uint64_t id, const sc_time& begin, const sc_ti
 
 void TlmRecorder::insertPhaseInDB(const Transaction::Phase& phase, uint64_t transactionID)
 {
-    sqlite3_bind_text(insertPhaseStatement,
-                      1,
-                      phase.name.c_str(),
-                      static_cast<int>(phase.name.length()),
-                      nullptr);
+    sqlite3_bind_int(insertPhaseStatement, 1, phase.id);
     sqlite3_bind_int64(insertPhaseStatement, 2, static_cast<int64_t>(phase.interval.start.value()));
     sqlite3_bind_int64(insertPhaseStatement, 3, static_cast<int64_t>(phase.interval.end.value()));
     sqlite3_bind_int64(
@@ -545,14 +945,18 @@ void TlmRecorder::insertPhaseInDB(const Transaction::Phase& phase, uint64_t tran
     executeSqlStatement(insertPhaseStatement);
 }
 
+void TlmRecorder::insertSummaryInDB()
+{
+    executeSqlCommand("BEGIN;");
+    insertTraceSummary(db, *summary);
+    executeSqlCommand("COMMIT;");
+}
+
 void TlmRecorder::executeSqlStatement(sqlite3_stmt* statement)
 {
     int errorCode = sqlite3_step(statement);
     if (errorCode != SQLITE_DONE)
-        SC_REPORT_FATAL(
-            "Error in TraceRecorder",
-            (std::string("Could not execute statement. Error code: ") + std::to_string(errorCode))
-                .c_str());
+        reportSqlError("Could not execute statement. Error code: " + std::to_string(errorCode));
 
     sqlite3_reset(statement);
 }
@@ -561,29 +965,42 @@ void TlmRecorder::executeInitialSqlCommand()
 {
     PRINTDEBUGMESSAGE(name, "Creating database by running provided sql script");
 
+    executeSqlCommand(std::string(TraceSchema::initialCommand));
+
+    // In bulk load mode, the ranges are inserted into a plain table and the R*-tree and the
+    // indexes are built in finalize()
+    if (simConfig.recordingBulkLoad)
+    {
+        executeSqlCommand(std::string(TraceSchema::createRangesBulkLoadCommand));
+    }
+    else
+    {
+        executeSqlCommand(std::string(TraceSchema::createRangesCommand));
+        executeSqlCommand(std::string(TraceSchema::createIndexesCommand));
+    }
+
+    PRINTDEBUGMESSAGE(name, "Database created successfully");
+}
+
+void TlmRecorder::executeSqlCommand(const std::string& command)
+{
     char* errMsg = nullptr;
-    int rc = sqlite3_exec(db, initialCommand.c_str(), nullptr, nullptr, &errMsg);
+    int rc = sqlite3_exec(db, command.c_str(), nullptr, nullptr, &errMsg);
     if (rc != SQLITE_OK)
     {
-        SC_REPORT_FATAL("SQLITE Error", errMsg);
+        std::string message = errMsg;
         sqlite3_free(errMsg);
+        reportSqlError(message);
     }
-
-    PRINTDEBUGMESSAGE(name, "Database created successfully");
 }
 
-void TlmRecorder::closeConnection()
+void TlmRecorder::reportSqlError(const std::string& message) const
 {
-    terminateRemainingTransactions();
-    if (storageThread.joinable())
-        storageThread.join();
-    std::swap(currentDataBuffer, storageDataBuffer);
-    commitRecordedDataToDB();
-    PRINTDEBUGMESSAGE(
-        name, "Number of transactions written to DB: " + std::to_string(totalNumTransactions));
-    PRINTDEBUGMESSAGE(name, "tlmPhaseRecorder:\tEnd Recording");
-    sqlite3_close(db);
-    db = nullptr;
+    // finalize() runs on its own thread, where the simulation kernel must not be accessed
+    if (finalizing)
+        throw std::runtime_error("Error in TraceRecorder: " + message);
+
+    SC_REPORT_FATAL("Error in TraceRecorder", message.c_str());
 }
 
 } // namespace DRAMSys
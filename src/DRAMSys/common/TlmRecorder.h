@@ -41,17 +41,22 @@
 #ifndef TLMRECORDER_H
 #define TLMRECORDER_H
 
+#include "DRAMSys/common/ColumnarTraceWriter.h"
+#include "DRAMSys/common/SpscRing.h"
+#include "DRAMSys/common/TraceSchema.h"
+#include "DRAMSys/common/TraceSummary.h"
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/common/utils.h"
 #include "DRAMSys/configuration/memspec/MemSpec.h"
 #include "DRAMSys/controller/McConfig.h"
 #include "DRAMSys/simulation/SimConfig.h"
 
+#include <chrono>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <systemc>
-#include <thread>
 #include <tlm>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -61,6 +66,8 @@ class sqlite3_stmt;
 namespace DRAMSys
 {
 
+class WorkerPool;
+
 class TlmRecorder
 {
 public:
@@ -71,7 +78,9 @@ public:
                 const std::string& dbName,
                 const std::string& mcconfig,
                 const std::string& memspec,
-                const std::string& traces);
+                const std::string& traces,
+                WorkerPool& writer,
+                std::size_t writerLane);
     TlmRecorder(const TlmRecorder&) = delete;
     TlmRecorder(TlmRecorder&&) = default;
     TlmRecorder& operator=(const TlmRecorder&) = delete;
@@ -85,16 +94,49 @@ public:
     void recordBufferDepth(double timeInSeconds, const std::vector<double>& averageBufferDepth);
     void recordBandwidth(double timeInSeconds, double averageBandwidth);
     void recordDebugMessage(const std::string& message, const sc_core::sc_time& time);
+
+    /**
+     * Flight recorder: writes the history of completed transactions followed by the next
+     * RecordingPostTriggerLength transactions. A trigger during this period extends it. Has no
+     * effect if no history is kept.
+     */
+    void trigger(std::string_view reason);
+
+    /**
+     * Terminates the remaining transactions and waits until all of them are committed. Has to
+     * be called on the simulation thread.
+     */
+    void finishRecording();
+
+    /**
+     * Builds the deferred indexes and closes the database. Does not access the simulation kernel
+     * and can therefore run concurrently for all channels after finishRecording(). Database
+     * errors are thrown as std::runtime_error and have to be reported by the caller.
+     */
     void finalize();
 
+    /**
+     * Wall-clock time the simulation thread was blocked because all batches were still waiting
+     * to be committed by the writer.
+     */
+    [[nodiscard]] std::chrono::duration<double> getBlockedTime() const { return blockedTime; }
+
+    /**
+     * Number of times the simulation thread found the batch queue full.
+     */
+    [[nodiscard]] uint64_t getNumberOfStalls() const { return numberOfStalls; }
+
 private:
     std::string name;
     const SimConfig& simConfig;
     const McConfig& mcConfig;
     const MemSpec& memSpec;
 
+    // The records are kept compact because the batches hold several thousand of them. Phases are
+    // identified by the id of their begin phase, the names are stored once in the PhaseNames table.
     struct Transaction
     {
+        Transaction() = default;
         Transaction(uint64_t id,
                     uint64_t address,
                     unsigned int dataLength,
@@ -104,31 +146,31 @@ private:
                     Channel channel) :
             id(id),
             address(address),
-            dataLength(dataLength),
-            cmd(cmd),
             timeOfGeneration(timeOfGeneration),
-            thread(thread),
-            channel(channel)
+            dataLength(dataLength),
+            thread(static_cast<uint32_t>(thread)),
+            channel(static_cast<uint16_t>(channel)),
+            cmd(cmd)
         {
         }
 
         uint64_t id = 0;
         uint64_t address = 0;
-        unsigned int dataLength = 0;
-        char cmd = 'X';
         sc_core::sc_time timeOfGeneration;
-        Thread thread;
-        Channel channel;
+        uint32_t dataLength = 0;
+        uint32_t thread = 0;
+        uint16_t channel = 0;
+        char cmd = 'X';
 
         struct Phase
         {
             // for BEGIN_REQ and BEGIN_RESP
-            Phase(std::string name, const sc_core::sc_time& begin) :
-                name(std::move(name)),
-                interval(begin, sc_core::SC_ZERO_TIME)
+            Phase(uint8_t id, const sc_core::sc_time& begin) :
+                interval(begin, sc_core::SC_ZERO_TIME),
+                id(id)
             {
             }
-            Phase(std::string name,
+            Phase(uint8_t id,
                   TimeInterval interval,
                   TimeInterval intervalOnDataStrobe,
                   Rank rank,
@@ -137,172 +179,136 @@ private:
                   Row row,
                   Column column,
                   unsigned int burstLength) :
-                name(std::move(name)),
                 interval(std::move(interval)),
                 intervalOnDataStrobe(std::move(intervalOnDataStrobe)),
-                rank(rank),
-                bankGroup(bankGroup),
-                bank(bank),
-                row(row),
-                column(column),
-                burstLength(burstLength)
+                row(static_cast<uint32_t>(row)),
+                column(static_cast<uint32_t>(column)),
+                rank(static_cast<uint16_t>(rank)),
+                bankGroup(static_cast<uint16_t>(bankGroup)),
+                bank(static_cast<uint16_t>(bank)),
+                burstLength(static_cast<uint16_t>(burstLength)),
+                id(id)
             {
             }
-            std::string name;
             TimeInterval interval;
             TimeInterval intervalOnDataStrobe = {sc_core::SC_ZERO_TIME, sc_core::SC_ZERO_TIME};
-            Rank rank = Rank(0);
-            BankGroup bankGroup = BankGroup(0);
-            Bank bank = Bank(0);
-            Row row = Row(0);
-            Column column = Column(0);
-            unsigned int burstLength = 0;
+            uint32_t row = 0;
+            uint32_t column = 0;
+            uint16_t rank = 0;
+            uint16_t bankGroup = 0;
+            uint16_t bank = 0;
+            uint16_t burstLength = 0;
+            uint8_t id;
         };
         std::vector<Phase> recordedPhases;
     };
 
+    static uint8_t getPhaseId(const tlm::tlm_phase& phase)
+    {
+        return static_cast<uint8_t>(static_cast<unsigned int>(phase));
+    }
+
     void prepareSqlStatements();
+    void finalizeSqlStatements();
     void executeInitialSqlCommand();
-    static void executeSqlStatement(sqlite3_stmt* statement);
+    void executeSqlCommand(const std::string& command);
+    void executeSqlStatement(sqlite3_stmt* statement);
+    void reportSqlError(const std::string& message) const;
 
     void openDB(const std::string& dbName);
-    void closeConnection();
+
+    [[nodiscard]] bool isRecorded(const tlm::tlm_generic_payload& trans,
+                                  const sc_core::sc_time& time);
+    bool skipFilteredPhase(const tlm::tlm_generic_payload& trans,
+                           const tlm::tlm_phase& phase,
+                           const sc_core::sc_time& time);
 
     void introduceTransactionToSystem(const tlm::tlm_generic_payload& trans);
     void removeTransactionFromSystem(const tlm::tlm_generic_payload& trans);
+    Transaction& getTransaction(const tlm::tlm_generic_payload& trans);
+    void releaseSlot(uint32_t slot);
+
+    [[nodiscard]] bool exceedsTriggerLatency(const Transaction& transaction) const;
+    void retainInHistory(Transaction& transaction);
+    void commitTransaction(Transaction&& transaction);
 
     void terminateRemainingTransactions();
-    void commitRecordedDataToDB();
-    void insertGeneralInfo(const std::string& mcConfigString,
-                           const std::string& memSpecString,
-                           const std::string& traces);
-    void insertCommandLengths();
+    void submitCurrentBatch();
+    void acquireBatch();
+    void waitForWriter();
+
+    // Executed in the lane of the recorder by the writer
+    void commitPendingBatches();
+    void commitBatchToDB(const std::vector<Transaction>& batch);
+    void commitBatchToColumnarTrace(const std::vector<Transaction>& batch);
+    static TimeInterval getRange(const Transaction& transaction);
+
+    [[nodiscard]] TraceMetadata createMetadata(const std::string& mcConfigString,
+                                               const std::string& memSpecString,
+                                               const std::string& traces) const;
+    void insertGeneralInfo(const TraceMetadata& metadata);
+    void insertCommandLengths(const TraceMetadata& metadata);
+    void insertPhaseNames(const TraceMetadata& metadata);
     void insertTransactionInDB(const Transaction& recordingData);
     void insertRangeInDB(uint64_t id, const sc_core::sc_time& begin, const sc_core::sc_time& end);
     void insertPhaseInDB(const Transaction::Phase& phase, uint64_t transactionID);
     void insertDebugMessageInDB(const std::string& message, const sc_core::sc_time& time);
+    void insertSummaryInDB();
+
+    // Completed transactions are collected in batches, which are committed by the writer
+    using Batch = std::vector<Transaction>;
+    WorkerPool* writer;
+    std::size_t writerLane;
+    std::unique_ptr<SpscRing<Batch>> batches;
+    Batch* currentBatch = nullptr;
+
+    std::chrono::duration<double> blockedTime{0};
+    uint64_t numberOfStalls = 0;
 
-    static constexpr unsigned transactionCommitRate = 8192;
-    std::array<std::vector<Transaction>, 2> recordingDataBuffer;
-    std::vector<Transaction>* currentDataBuffer;
-    std::vector<Transaction>* storageDataBuffer;
-    std::thread storageThread;
+    bool recordingFinished = false;
+    bool finalizing = false;
 
-    std::unordered_map<const tlm::tlm_generic_payload*, Transaction> currentTransactionsInSystem;
+    // In-flight transactions, indexed by the slot in the RecorderExtension of their payload.
+    // Released slots are reused through the free list.
+    std::vector<Transaction> transactionSlots;
+    std::vector<const tlm::tlm_generic_payload*> slotPayloads;
+    std::vector<uint32_t> freeSlots;
 
     uint64_t totalNumTransactions = 0;
+    uint64_t numberOfCommittedTransactions = 0;
     sc_core::sc_time simulationTimeCoveredByRecording;
 
+    // Recording filters of the simulation config, only evaluated when a transaction starts
+    bool filtersEnabled = false;
+    std::vector<TimeInterval> recordingTimeWindows;
+    uint64_t sampleCounter = 0;
+
+    // Flight recorder, completed transactions are kept in the history ring until a trigger fires.
+    // The phases of overwritten entries are reused by new transactions. The committed
+    // transactions are numbered again in commit order.
+    std::vector<Transaction> history;
+    std::size_t historyBegin = 0;
+    std::size_t historySize = 0;
+    uint64_t postTriggerTransactions = 0;
+    sc_core::sc_time triggerLatency;
+
+    // Only used with the columnar recording format, replaces the database
+    std::unique_ptr<ColumnarTraceWriter> columnarTrace;
+
+    // Only used with the SQLite recording format, updated by the writer thread
+    std::unique_ptr<TraceSummary> summary;
+
     sqlite3* db = nullptr;
     sqlite3_stmt *insertTransactionStatement = nullptr, *insertRangeStatement = nullptr,
                  *updateRangeStatement = nullptr, *insertPhaseStatement = nullptr,
                  *updatePhaseStatement = nullptr, *insertGeneralInfoStatement = nullptr,
-                 *insertCommandLengthsStatement = nullptr, *insertDebugMessageStatement = nullptr,
-                 *insertPowerStatement = nullptr, *insertBufferDepthStatement = nullptr,
-                 *insertBandwidthStatement = nullptr;
+                 *insertCommandLengthsStatement = nullptr, *insertPhaseNameStatement = nullptr,
+                 *insertDebugMessageStatement = nullptr, *insertPowerStatement = nullptr,
+                 *insertBufferDepthStatement = nullptr, *insertBandwidthStatement = nullptr;
     std::string insertTransactionString, insertRangeString, updateRangeString, insertPhaseString,
         updatePhaseString, insertGeneralInfoString, insertCommandLengthsString,
-        insertDebugMessageString, insertPowerString, insertBufferDepthString, insertBandwidthString;
-
-    std::string initialCommand = R"(
-        DROP TABLE IF EXISTS Phases;
-        DROP TABLE IF EXISTS GeneralInfo;
-        DROP TABLE IF EXISTS CommandLengths;
-        DROP TABLE IF EXISTS Comments;
-        DROP TABLE IF EXISTS ranges;
-        DROP TABLE IF EXISTS Transactions;
-        DROP TABLE IF EXISTS DebugMessages;
-        DROP TABLE IF EXISTS Power;
-        DROP TABLE IF EXISTS BufferDepth;
-        DROP TABLE IF EXISTS Bandwidth;
-
-        CREATE TABLE Phases(
-                ID INTEGER PRIMARY KEY,
-                PhaseName TEXT,
-                PhaseBegin INTEGER,
-                PhaseEnd INTEGER,
-                DataStrobeBegin INTEGER,
-                DataStrobeEnd INTEGER,
-                Rank INTEGER,
-                BankGroup INTEGER,
-                Bank INTEGER,
-                Row INTEGER,
-                Column INTEGER,
-                BurstLength INTEGER,
-                Transact INTEGER
-        );
-
-        CREATE TABLE GeneralInfo(
-                NumberOfRanks INTEGER,
-                NumberOfBankgroups INTEGER,
-                NumberOfBanks INTEGER,
-                clk INTEGER,
-                UnitOfTime TEXT,
-                MCconfig TEXT,
-                Memspec TEXT,
-                Traces TEXT,
-                WindowSize INTEGER,
-                RefreshMaxPostponed INTEGER,
-                RefreshMaxPulledin INTEGER,
-                ControllerThread INTEGER,
-                MaxBufferDepth INTEGER,
-                Per2BankOffset INTEGER,
-                RowColumnCommandBus BOOL,
-                PseudoChannelMode BOOL
-        );
-
-        CREATE TABLE CommandLengths(
-                Command TEXT,
-                Length DOUBLE
-        );
-
-        CREATE TABLE Power(
-                time DOUBLE,
-                AveragePower DOUBLE
-        );
-
-        CREATE TABLE BufferDepth(
-            Time DOUBLE,
-            BufferNumber INTEGER,
-            AverageBufferDepth DOUBLE
-        );
-
-        CREATE TABLE Bandwidth(
-            Time DOUBLE,
-            AverageBandwidth DOUBLE
-        );
-
-        CREATE TABLE Comments(
-                Time INTEGER,
-                Text TEXT
-        );
-
-        CREATE TABLE DebugMessages(
-                Time INTEGER,
-                Message TEXT
-        );
-
-        -- use SQLITE R* TREE Module to make queries on timespans effecient (see http://www.sqlite.org/rtree.html)
-        CREATE VIRTUAL TABLE ranges USING rtree(
-           id,
-           begin, end
-        );
-
-        CREATE TABLE Transactions(
-                ID INTEGER,
-                Range INTEGER,
-                Address INTEGER,
-                DataLength INTEGER,
-                Thread INTEGER,
-                Channel INTEGER,
-                TimeOfGeneration INTEGER,
-                Command TEXT
-        );
-
-        CREATE INDEX ranges_index ON Transactions(Range);
-        CREATE INDEX "phasesTransactions" ON "Phases" ("Transact" ASC);
-        CREATE INDEX "messageTimes" ON "DebugMessages" ("Time" ASC);
-    )";
+        insertPhaseNameString, insertDebugMessageString, insertPowerString,
+        insertBufferDepthString, insertBandwidthString;
 };
 
 } // namespace DRAMSys
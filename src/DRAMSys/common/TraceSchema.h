@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef TRACESCHEMA_H
+#define TRACESCHEMA_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * General information about a recorded channel that is stored once per trace database. It is
+ * gathered by the TlmRecorder and written into the GeneralInfo, CommandLengths and PhaseNames
+ * tables, or into the header of a columnar trace from which these tables can be restored.
+ */
+struct TraceMetadata
+{
+    uint32_t numberOfRanks = 0;
+    uint32_t numberOfBankGroups = 0;
+    uint32_t numberOfBanks = 0;
+    uint64_t clk = 0;
+    std::string unitOfTime;
+    std::string mcConfig;
+    std::string memSpec;
+    std::string traces;
+    uint64_t windowSize = 0;
+    uint32_t refreshMaxPostponed = 0;
+    uint32_t refreshMaxPulledin = 0;
+    uint32_t controllerThread = 0;
+    uint32_t maxBufferDepth = 0;
+    uint32_t per2BankOffset = 0;
+    bool rowColumnCommandBus = false;
+    bool pseudoChannelMode = false;
+
+    // Duration of one simulation time unit in seconds
+    double timeResolution = 0.0;
+
+    std::vector<std::pair<std::string, double>> commandLengths;
+    std::vector<std::pair<uint8_t, std::string>> phaseNames;
+};
+
+/**
+ * Schema of the trace databases (.tdb) that are read by the Trace Analyzer and the Python
+ * scripts.
+ */
+namespace TraceSchema
+{
+
+// The R*-tree and the indexes are either created together with the tables or, in bulk load
+// mode, after all data has been inserted into plain tables.
+inline constexpr std::string_view initialCommand = R"(
+        DROP VIEW IF EXISTS Phases;
+        DROP TABLE IF EXISTS PhaseData;
+        DROP TABLE IF EXISTS PhaseNames;
+        DROP TABLE IF EXISTS GeneralInfo;
+        DROP TABLE IF EXISTS CommandLengths;
+        DROP TABLE IF EXISTS Comments;
+        DROP TABLE IF EXISTS ranges;
+        DROP TABLE IF EXISTS Transactions;
+        DROP TABLE IF EXISTS DebugMessages;
+        DROP TABLE IF EXISTS Power;
+        DROP TABLE IF EXISTS BufferDepth;
+        DROP TABLE IF EXISTS Bandwidth;
+
+        CREATE TABLE PhaseData(
+                ID INTEGER PRIMARY KEY,
+                PhaseNameID INTEGER,
+                PhaseBegin INTEGER,
+                PhaseEnd INTEGER,
+                DataStrobeBegin INTEGER,
+                DataStrobeEnd INTEGER,
+                Rank INTEGER,
+                BankGroup INTEGER,
+                Bank INTEGER,
+                Row INTEGER,
+                Column INTEGER,
+                BurstLength INTEGER,
+                Transact INTEGER
+        );
+
+        CREATE TABLE PhaseNames(
+                ID INTEGER PRIMARY KEY,
+                Name TEXT
+        );
+
+        -- compatibility view for the Trace Analyzer and the scripts that expect the phase names
+        CREATE VIEW Phases AS
+            SELECT PhaseData.ID AS ID, PhaseNames.Name AS PhaseName, PhaseBegin, PhaseEnd,
+                   DataStrobeBegin, DataStrobeEnd, Rank, BankGroup, Bank, Row, Column,
+                   BurstLength, Transact
+            FROM PhaseData INNER JOIN PhaseNames ON PhaseData.PhaseNameID = PhaseNames.ID;
+
+        CREATE TABLE GeneralInfo(
+                NumberOfRanks INTEGER,
+                NumberOfBankgroups INTEGER,
+                NumberOfBanks INTEGER,
+                clk INTEGER,
+                UnitOfTime TEXT,
+                MCconfig TEXT,
+                Memspec TEXT,
+                Traces TEXT,
+                WindowSize INTEGER,
+                RefreshMaxPostponed INTEGER,
+                RefreshMaxPulledin INTEGER,
+                ControllerThread INTEGER,
+                MaxBufferDepth INTEGER,
+                Per2BankOffset INTEGER,
+                RowColumnCommandBus BOOL,
+                PseudoChannelMode BOOL
+        );
+
+        CREATE TABLE CommandLengths(
+                Command TEXT,
+                Length DOUBLE
+        );
+
+        CREATE TABLE Power(
+                time DOUBLE,
+                AveragePower DOUBLE
+        );
+
+        CREATE TABLE BufferDepth(
+            Time DOUBLE,
+            BufferNumber INTEGER,
+            AverageBufferDepth DOUBLE
+        );
+
+        CREATE TABLE Bandwidth(
+            Time DOUBLE,
+            AverageBandwidth DOUBLE
+        );
+
+        CREATE TABLE Comments(
+                Time INTEGER,
+                Text TEXT
+        );
+
+        CREATE TABLE DebugMessages(
+                Time INTEGER,
+                Message TEXT
+        );
+
+        CREATE TABLE Transactions(
+                ID INTEGER,
+                Range INTEGER,
+                Address INTEGER,
+                DataLength INTEGER,
+                Thread INTEGER,
+                Channel INTEGER,
+                TimeOfGeneration INTEGER,
+                Command TEXT
+        );
+    )";
+
+inline constexpr std::string_view createRangesCommand = R"(
+        -- use SQLITE R* TREE Module to make queries on timespans effecient (see http://www.sqlite.org/rtree.html)
+        CREATE VIRTUAL TABLE ranges USING rtree(
+           id,
+           begin, end
+        );
+    )";
+
+inline constexpr std::string_view createRangesBulkLoadCommand = R"(
+        CREATE TABLE ranges(
+           id INTEGER,
+           begin INTEGER,
+           end INTEGER
+        );
+    )";
+
+// Inserting the ranges sorted by time keeps the nodes of the R*-tree compact
+inline constexpr std::string_view bulkLoadRangesCommand = R"(
+        ALTER TABLE ranges RENAME TO rangesBulkLoad;
+        CREATE VIRTUAL TABLE ranges USING rtree(
+           id,
+           begin, end
+        );
+        INSERT INTO ranges SELECT * FROM rangesBulkLoad ORDER BY "begin", "id";
+        DROP TABLE rangesBulkLoad;
+    )";
+
+inline constexpr std::string_view createIndexesCommand = R"(
+        CREATE INDEX ranges_index ON Transactions(Range);
+        CREATE INDEX "phasesTransactions" ON "PhaseData" ("Transact" ASC);
+        CREATE INDEX "messageTimes" ON "DebugMessages" ("Time" ASC);
+    )";
+
+// The summary tables are filled from a TraceSummary once all transactions have been recorded.
+// All times are in the unit of time of the GeneralInfo table.
+inline constexpr std::string_view createSummaryTablesCommand = R"(
+        DROP TABLE IF EXISTS SummaryGeneral;
+        DROP TABLE IF EXISTS SummaryLatency;
+        DROP TABLE IF EXISTS SummaryThreads;
+        DROP TABLE IF EXISTS SummaryPhases;
+        DROP TABLE IF EXISTS SummaryBanks;
+        DROP TABLE IF EXISTS SummaryWindows;
+
+        CREATE TABLE SummaryGeneral(
+                Transactions INTEGER,
+                BeginTime INTEGER,
+                EndTime INTEGER,
+                WindowLength INTEGER
+        );
+
+        CREATE TABLE SummaryLatency(
+                LowerBound INTEGER,
+                UpperBound INTEGER,
+                Count INTEGER
+        );
+
+        CREATE TABLE SummaryThreads(
+                Thread INTEGER,
+                Reads INTEGER,
+                Writes INTEGER,
+                BytesRead INTEGER,
+                BytesWritten INTEGER
+        );
+
+        CREATE TABLE SummaryPhases(
+                PhaseNameID INTEGER,
+                Count INTEGER
+        );
+
+        CREATE TABLE SummaryBanks(
+                Bank INTEGER,
+                Activates INTEGER,
+                Reads INTEGER,
+                Writes INTEGER,
+                Precharges INTEGER,
+                RowHits INTEGER,
+                DataBusTime INTEGER
+        );
+
+        CREATE TABLE SummaryWindows(
+                WindowBegin INTEGER,
+                Reads INTEGER,
+                Writes INTEGER,
+                Activates INTEGER,
+                DataBusTime INTEGER
+        );
+    )";
+
+} // namespace TraceSchema
+
+} // namespace DRAMSys
+
+#endif // TRACESCHEMA_H
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "TraceSummary.h"
+
+#include <algorithm>
+#include <string>
+
+namespace DRAMSys
+{
+
+TraceSummary::TraceSummary(const TraceMetadata& metadata) :
+    clk(metadata.clk > 0 ? metadata.clk : 1),
+    windowLength(metadata.windowSize > 0 ? metadata.windowSize : DEFAULT_WINDOW_CYCLES * clk),
+    banksPerRank(std::max(1U, metadata.numberOfBanks / std::max(1U, metadata.numberOfRanks))),
+    banksPerGroup(
+        std::max(1U, metadata.numberOfBanks / std::max(1U, metadata.numberOfBankGroups))),
+    banks(metadata.numberOfBanks)
+{
+    for (const auto& [id, name] : metadata.phaseNames)
+    {
+        PhaseType type = PhaseType::Other;
+        if (name == "REQ")
+            type = PhaseType::Request;
+        else if (name == "RESP")
+            type = PhaseType::Response;
+        else if (name == "ACT")
+            type = PhaseType::Activate;
+        else if (name == "RD")
+            type = PhaseType::Read;
+        else if (name == "RDA")
+            type = PhaseType::ReadAutoPrecharge;
+        else if (name == "WR" || name == "MWR")
+            type = PhaseType::Write;
+        else if (name == "WRA" || name == "MWRA")
+            type = PhaseType::WriteAutoPrecharge;
+        else if (name == "PREPB")
+            type = PhaseType::Precharge;
+        else if (name == "PREAB")
+            type = PhaseType::PrechargeAll;
+        else if (name == "PRESB")
+            type = PhaseType::PrechargeSameBank;
+        phaseTypes[id] = type;
+    }
+}
+
+void TraceSummary::addTransaction(uint32_t thread, char command, uint32_t dataLength)
+{
+    numberOfTransactions++;
+
+    ThreadCounters& counters = threads[thread];
+    if (command == 'R')
+    {
+        counters.reads++;
+        counters.bytesRead += dataLength;
+    }
+    else if (command == 'W')
+    {
+        counters.writes++;
+        counters.bytesWritten += dataLength;
+    }
+}
+
+void TraceSummary::addPhase(uint64_t transaction,
+                            uint8_t phaseNameId,
+                            uint64_t begin,
+                            uint64_t end,
+                            uint64_t dataStrobeBegin,
+                            uint64_t dataStrobeEnd,
+                            uint32_t rank,
+                            uint32_t bank)
+{
+    numberOfPhases++;
+    this->begin = std::min(this->begin, begin);
+    this->end = std::max(this->end, end);
+    phaseCounts[phaseNameId]++;
+
+    PhaseType type = phaseTypes[phaseNameId];
+    if (type == PhaseType::Request)
+    {
+        requestTransaction = transaction;
+        requestBegin = begin;
+        return;
+    }
+
+    if (type == PhaseType::Response)
+    {
+        if (transaction == requestTransaction && begin >= requestBegin)
+        {
+            latencyHistogram.record((begin - requestBegin) / clk);
+        }
+        return;
+    }
+
+    if (type == PhaseType::Other || bank >= banks.size())
+        return;
+
+    BankCounters& bankCounters = banks[bank];
+    WindowCounters& window = getWindow(begin);
+
+    switch (type)
+    {
+    case PhaseType::Activate:
+        bankCounters.activates++;
+        window.activates++;
+        break;
+    case PhaseType::Read:
+    case PhaseType::ReadAutoPrecharge:
+        bankCounters.reads++;
+        window.reads++;
+        break;
+    case PhaseType::Write:
+    case PhaseType::WriteAutoPrecharge:
+        bankCounters.writes++;
+        window.writes++;
+        break;
+    default:
+        break;
+    }
+
+    addPrecharge(type, rank, bank);
+
+    if (dataStrobeEnd > dataStrobeBegin)
+    {
+        bankCounters.dataBusTime += dataStrobeEnd - dataStrobeBegin;
+
+        // The burst is split at the window boundaries
+        for (uint64_t time = dataStrobeBegin; time < dataStrobeEnd;)
+        {
+            uint64_t windowEnd = (time / windowLength + 1) * windowLength;
+            uint64_t sliceEnd = std::min(windowEnd, dataStrobeEnd);
+            getWindow(time).dataBusTime += sliceEnd - time;
+            time = sliceEnd;
+        }
+    }
+}
+
+std::vector<TraceSummary::LatencyBin> TraceSummary::getLatencyHistogram() const
+{
+    std::vector<LatencyBin> histogram;
+    const auto& buckets = latencyHistogram.getBuckets();
+    for (std::size_t index = 0; index < buckets.size(); index++)
+    {
+        if (buckets[index] == 0)
+            continue;
+
+        auto [lowerBound, upperBound] = Statistics::Histogram::getBucketBounds(index);
+        histogram.push_back({lowerBound * clk, (upperBound + 1) * clk, buckets[index]});
+    }
+    return histogram;
+}
+
+void TraceSummary::addPrecharge(PhaseType type, uint32_t rank, uint32_t bank)
+{
+    if (type == PhaseType::Precharge || type == PhaseType::ReadAutoPrecharge ||
+        type == PhaseType::WriteAutoPrecharge)
+    {
+        banks[bank].precharges++;
+    }
+    else if (type == PhaseType::PrechargeAll || type == PhaseType::PrechargeSameBank)
+    {
+        // PREAB closes every bank of the rank, PRESB the bank with the same index in every bank
+        // group of the rank
+        std::size_t rankBegin = static_cast<std::size_t>(rank) * banksPerRank;
+        std::size_t rankEnd = std::min(rankBegin + banksPerRank, banks.size());
+        bool allBanks = type == PhaseType::PrechargeAll;
+        std::size_t first = allBanks ? rankBegin : rankBegin + bank % banksPerGroup;
+        std::size_t stride = allBanks ? 1 : banksPerGroup;
+        for (std::size_t index = first; index < rankEnd; index += stride)
+            banks[index].precharges++;
+    }
+}
+
+TraceSummary::WindowCounters& TraceSummary::getWindow(uint64_t time)
+{
+    std::size_t index = time / windowLength;
+    if (index >= windows.size())
+        windows.resize(index + 1);
+    return windows[index];
+}
+
+} // namespace DRAMSys
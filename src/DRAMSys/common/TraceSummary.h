@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef TRACESUMMARY_H
+#define TRACESUMMARY_H
+
+#include "DRAMSys/common/TraceSchema.h"
+#include "DRAMSys/statistics/Histogram.h"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Aggregates the recorded transactions and phases of a channel while they are written.
+ *
+ * The summary is stored in the Summary* tables of the trace database so that the common metrics
+ * do not require a scan of the Transactions and Phases tables. All times are in simulation time
+ * units. The phases of a transaction have to be added consecutively, the transactions themselves
+ * may be added in any order.
+ */
+class TraceSummary
+{
+public:
+    struct LatencyBin
+    {
+        uint64_t lowerBound;
+        uint64_t upperBound;
+        uint64_t count;
+    };
+
+    struct ThreadCounters
+    {
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t bytesRead = 0;
+        uint64_t bytesWritten = 0;
+    };
+
+    struct BankCounters
+    {
+        uint64_t activates = 0;
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t precharges = 0;
+        uint64_t dataBusTime = 0;
+
+        // Every access that does not need an activate of its own hits an open row
+        [[nodiscard]] uint64_t getRowHits() const
+        {
+            return reads + writes > activates ? reads + writes - activates : 0;
+        }
+    };
+
+    struct WindowCounters
+    {
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t activates = 0;
+        uint64_t dataBusTime = 0;
+    };
+
+    explicit TraceSummary(const TraceMetadata& metadata);
+
+    void addTransaction(uint32_t thread, char command, uint32_t dataLength);
+    void addPhase(uint64_t transaction,
+                  uint8_t phaseNameId,
+                  uint64_t begin,
+                  uint64_t end,
+                  uint64_t dataStrobeBegin,
+                  uint64_t dataStrobeEnd,
+                  uint32_t rank,
+                  uint32_t bank);
+
+    [[nodiscard]] uint64_t getNumberOfTransactions() const { return numberOfTransactions; }
+    [[nodiscard]] uint64_t getBegin() const { return numberOfPhases > 0 ? begin : 0; }
+    [[nodiscard]] uint64_t getEnd() const { return end; }
+
+    /**
+     * Latencies between the begin of the request and the begin of the response, in the buckets
+     * of a Statistics::Histogram of clock cycles. The upper bound of a bin is exclusive. Only the
+     * bins that contain at least one transaction are returned.
+     */
+    [[nodiscard]] std::vector<LatencyBin> getLatencyHistogram() const;
+
+    [[nodiscard]] const std::map<uint32_t, ThreadCounters>& getThreads() const
+    {
+        return threads;
+    }
+    [[nodiscard]] const std::map<uint8_t, uint64_t>& getPhaseCounts() const
+    {
+        return phaseCounts;
+    }
+    [[nodiscard]] const std::vector<BankCounters>& getBanks() const { return banks; }
+    [[nodiscard]] uint64_t getWindowLength() const { return windowLength; }
+    [[nodiscard]] const std::vector<WindowCounters>& getWindows() const { return windows; }
+
+    static constexpr uint64_t DEFAULT_WINDOW_CYCLES = 1000;
+
+private:
+    enum class PhaseType : uint8_t
+    {
+        Other,
+        Request,
+        Response,
+        Activate,
+        Read,
+        ReadAutoPrecharge,
+        Write,
+        WriteAutoPrecharge,
+        Precharge,
+        PrechargeAll,
+        PrechargeSameBank
+    };
+
+    WindowCounters& getWindow(uint64_t time);
+    void addPrecharge(PhaseType type, uint32_t rank, uint32_t bank);
+
+    const uint64_t clk;
+    const uint64_t windowLength;
+    const uint32_t banksPerRank;
+    const uint32_t banksPerGroup;
+    std::array<PhaseType, UINT8_MAX + 1> phaseTypes{};
+
+    uint64_t numberOfTransactions = 0;
+    uint64_t numberOfPhases = 0;
+    uint64_t begin = UINT64_MAX;
+    uint64_t end = 0;
+
+    // Request of the transaction whose phases are currently added
+    uint64_t requestTransaction = UINT64_MAX;
+    uint64_t requestBegin = 0;
+
+    // In clock cycles
+    Statistics::Histogram latencyHistogram;
+    std::map<uint32_t, ThreadCounters> threads;
+    std::map<uint8_t, uint64_t> phaseCounts;
+    std::vector<BankCounters> banks;
+    std::vector<WindowCounters> windows;
+};
+
+} // namespace DRAMSys
+
+#endif // TRACESUMMARY_H
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "TraceSummaryWriter.h"
+
+#include <cstdint>
+#include <sqlite3.h>
+#include <stdexcept>
+#include <string>
+
+namespace DRAMSys
+{
+
+namespace
+{
+
+class Statement
+{
+public:
+    Statement(sqlite3* db, const char* sql)
+    {
+        if (sqlite3_prepare_v2(db, sql, -1, &statement, nullptr) != SQLITE_OK)
+            throw std::runtime_error(std::string("Cannot prepare statement ") + sql);
+    }
+
+    Statement(const Statement&) = delete;
+    Statement(Statement&&) = delete;
+    Statement& operator=(const Statement&) = delete;
+    Statement& operator=(Statement&&) = delete;
+    ~Statement() { sqlite3_finalize(statement); }
+
+    template <typename... Values> void insert(Values... values)
+    {
+        int index = 1;
+        (sqlite3_bind_int64(statement, index++, static_cast<int64_t>(values)), ...);
+
+        int errorCode = sqlite3_step(statement);
+        if (errorCode != SQLITE_DONE)
+            throw std::runtime_error("Could not execute statement. Error code: " +
+                                     std::to_string(errorCode));
+        sqlite3_reset(statement);
+    }
+
+private:
+    sqlite3_stmt* statement = nullptr;
+};
+
+} // namespace
+
+void insertTraceSummary(sqlite3* db, const TraceSummary& summary)
+{
+    char* errMsg = nullptr;
+    if (sqlite3_exec(db,
+                     std::string(TraceSchema::createSummaryTablesCommand).c_str(),
+                     nullptr,
+                     nullptr,
+                     &errMsg) != SQLITE_OK)
+    {
+        std::string message = errMsg != nullptr ? errMsg : "unknown error";
+        sqlite3_free(errMsg);
+        throw std::runtime_error("SQLite error: " + message);
+    }
+
+    Statement general(db, "INSERT INTO SummaryGeneral VALUES (?, ?, ?, ?)");
+    general.insert(summary.getNumberOfTransactions(),
+                   summary.getBegin(),
+                   summary.getEnd(),
+                   summary.getWindowLength());
+
+    Statement latency(db, "INSERT INTO SummaryLatency VALUES (?, ?, ?)");
+    for (const TraceSummary::LatencyBin& bin : summary.getLatencyHistogram())
+        latency.insert(bin.lowerBound, bin.upperBound, bin.count);
+
+    Statement threads(db, "INSERT INTO SummaryThreads VALUES (?, ?, ?, ?, ?)");
+    for (const auto& [thread, counters] : summary.getThreads())
+    {
+        threads.insert(
+            thread, counters.reads, counters.writes, counters.bytesRead, counters.bytesWritten);
+    }
+
+    Statement phases(db, "INSERT INTO SummaryPhases VALUES (?, ?)");
+    for (const auto& [phaseNameId, count] : summary.getPhaseCounts())
+        phases.insert(phaseNameId, count);
+
+    Statement banks(db, "INSERT INTO SummaryBanks VALUES (?, ?, ?, ?, ?, ?, ?)");
+    const auto& bankCounters = summary.getBanks();
+    for (std::size_t bank = 0; bank < bankCounters.size(); bank++)
+    {
+        const TraceSummary::BankCounters& counters = bankCounters[bank];
+        banks.insert(bank,
+                     counters.activates,
+                     counters.reads,
+                     counters.writes,
+                     counters.precharges,
+                     counters.getRowHits(),
+                     counters.dataBusTime);
+    }
+
+    Statement windows(db, "INSERT INTO SummaryWindows VALUES (?, ?, ?, ?, ?)");
+    const auto& windowCounters = summary.getWindows();
+    for (std::size_t window = 0; window < windowCounters.size(); window++)
+    {
+        const TraceSummary::WindowCounters& counters = windowCounters[window];
+        windows.insert(window * summary.getWindowLength(),
+                       counters.reads,
+                       counters.writes,
+                       counters.activates,
+                       counters.dataBusTime);
+    }
+}
+
+} // namespace DRAMSys
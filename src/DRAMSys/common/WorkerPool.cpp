@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace DRAMSys
+{
+
+WorkerPool::WorkerPool(unsigned numberOfThreads, std::size_t numberOfLanes) :
+    lanes(numberOfLanes)
+{
+    // More threads than lanes would never receive a task
+    numberOfThreads =
+        std::max(1U, std::min(numberOfThreads, static_cast<unsigned>(numberOfLanes)));
+
+    workers.reserve(numberOfThreads);
+    for (unsigned i = 0; i < numberOfThreads; i++)
+        workers.emplace_back(std::make_unique<Worker>());
+
+    for (auto& worker : workers)
+        worker->thread = std::thread([this, &worker = *worker]() { run(worker); });
+}
+
+WorkerPool::~WorkerPool()
+{
+    for (auto& worker : workers)
+    {
+        {
+            std::lock_guard lock(worker->mutex);
+            worker->stop = true;
+        }
+        worker->taskAvailable.notify_one();
+    }
+
+    for (auto& worker : workers)
+        worker->thread.join();
+}
+
+void WorkerPool::submit(std::size_t lane, Task task)
+{
+    assert(lane < lanes.size());
+    Worker& worker = getWorker(lane);
+
+    {
+        std::lock_guard lock(worker.mutex);
+        worker.tasks.emplace_back(lane, std::move(task));
+        lanes[lane].submitted++;
+    }
+    worker.taskAvailable.notify_one();
+}
+
+void WorkerPool::wait(std::size_t lane)
+{
+    assert(lane < lanes.size());
+    Worker& worker = getWorker(lane);
+
+    std::unique_lock lock(worker.mutex);
+    worker.taskCompleted.wait(
+        lock, [this, lane]() { return lanes[lane].completed == lanes[lane].submitted; });
+}
+
+void WorkerPool::run(Worker& worker)
+{
+    std::unique_lock lock(worker.mutex);
+
+    while (true)
+    {
+        worker.taskAvailable.wait(lock,
+                                  [&worker]() { return worker.stop || !worker.tasks.empty(); });
+
+        // Remaining tasks are still executed when the pool is destroyed
+        if (worker.tasks.empty())
+            return;
+
+        auto [lane, task] = std::move(worker.tasks.front());
+        worker.tasks.pop_front();
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        lanes[lane].completed++;
+        worker.taskCompleted.notify_all();
+    }
+}
+
+} // namespace DRAMSys
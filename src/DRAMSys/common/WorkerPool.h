@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Fixed set of worker threads that executes tasks in the background of the simulation
+ * kernel. Tasks are submitted to lanes. All tasks of one lane are executed by the same worker in
+ * submission order, so a lane can update sequential state (e.g., the DRAMPower instance of a
+ * channel) without further synchronization. The simulation kernel synchronizes with a lane by
+ * waiting for its submitted tasks to complete.
+ */
+class WorkerPool
+{
+public:
+    using Task = std::function<void()>;
+
+    WorkerPool(unsigned numberOfThreads, std::size_t numberOfLanes);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool& operator=(WorkerPool&&) = delete;
+
+    void submit(std::size_t lane, Task task);
+
+    /**
+     * Blocks until all tasks that have been submitted to the lane so far are completed.
+     */
+    void wait(std::size_t lane);
+
+    [[nodiscard]] unsigned getNumberOfThreads() const
+    {
+        return static_cast<unsigned>(workers.size());
+    }
+
+private:
+    struct Worker
+    {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable taskAvailable;
+        std::condition_variable taskCompleted;
+        std::deque<std::pair<std::size_t, Task>> tasks;
+        bool stop = false;
+    };
+
+    // Protected by the mutex of the worker the lane is assigned to
+    struct Lane
+    {
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+    };
+
+    void run(Worker& worker);
+    Worker& getWorker(std::size_t lane) { return *workers[lane % workers.size()]; }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<Lane> lanes;
+};
+
+} // namespace DRAMSys
+
+#endif // WORKERPOOL_H
@@ -67,6 +67,7 @@ void ArbiterExtension::setAutoExtension(tlm::tlm_generic_payload& trans,
         extension->channel = channel;
         extension->threadPayloadID = 0;
         extension->timeOfGeneration = SC_ZERO_TIME;
+        extension->timeOfResponse = SC_ZERO_TIME;
     }
     else
     {
@@ -97,9 +98,19 @@ void ArbiterExtension::setIDAndTimeOfGeneration(tlm::tlm_generic_payload& trans,
     extension->timeOfGeneration = timeOfGeneration;
 }
 
+void ArbiterExtension::setTimeOfResponse(tlm::tlm_generic_payload& trans,
+                                         const sc_core::sc_time& timeOfResponse)
+{
+    assert(trans.get_extension<ArbiterExtension>() != nullptr);
+
+    trans.get_extension<ArbiterExtension>()->timeOfResponse = timeOfResponse;
+}
+
 tlm_extension_base* ArbiterExtension::clone() const
 {
-    return new ArbiterExtension(thread, channel, threadPayloadID, timeOfGeneration);
+    auto* extension = new ArbiterExtension(thread, channel, threadPayloadID, timeOfGeneration);
+    extension->timeOfResponse = timeOfResponse;
+    return extension;
 }
 
 void ArbiterExtension::copy_from(const tlm_extension_base& ext)
@@ -109,6 +120,7 @@ void ArbiterExtension::copy_from(const tlm_extension_base& ext)
     channel = cpyFrom.channel;
     threadPayloadID = cpyFrom.threadPayloadID;
     timeOfGeneration = cpyFrom.timeOfGeneration;
+    timeOfResponse = cpyFrom.timeOfResponse;
 }
 
 Thread ArbiterExtension::getThread() const
@@ -131,6 +143,11 @@ sc_core::sc_time ArbiterExtension::getTimeOfGeneration() const
     return timeOfGeneration;
 }
 
+sc_core::sc_time ArbiterExtension::getTimeOfResponse() const
+{
+    return timeOfResponse;
+}
+
 const ArbiterExtension& ArbiterExtension::getExtension(const tlm::tlm_generic_payload& trans)
 {
     return *trans.get_extension<ArbiterExtension>();
@@ -156,6 +173,11 @@ sc_time ArbiterExtension::getTimeOfGeneration(const tlm::tlm_generic_payload& tr
     return trans.get_extension<ArbiterExtension>()->timeOfGeneration;
 }
 
+sc_time ArbiterExtension::getTimeOfResponse(const tlm::tlm_generic_payload& trans)
+{
+    return trans.get_extension<ArbiterExtension>()->timeOfResponse;
+}
+
 ControllerExtension::ControllerExtension(uint64_t channelPayloadID,
                                          Rank rank,
                                          Stack stack,
@@ -222,10 +244,20 @@ void ControllerExtension::setExtension(tlm::tlm_generic_payload& trans,
     trans.set_extension(extension);
 }
 
+void ControllerExtension::setTimeOfAcceptance(tlm::tlm_generic_payload& trans,
+                                              const sc_core::sc_time& timeOfAcceptance)
+{
+    assert(trans.get_extension<ControllerExtension>() != nullptr);
+
+    trans.get_extension<ControllerExtension>()->timeOfAcceptance = timeOfAcceptance;
+}
+
 tlm_extension_base* ControllerExtension::clone() const
 {
-    return new ControllerExtension(
+    auto* extension = new ControllerExtension(
         channelPayloadID, rank, stack, bankGroup, bank, row, column, burstLength);
+    extension->timeOfAcceptance = timeOfAcceptance;
+    return extension;
 }
 
 void ControllerExtension::copy_from(const tlm_extension_base& ext)
@@ -239,6 +271,7 @@ void ControllerExtension::copy_from(const tlm_extension_base& ext)
     row = cpyFrom.row;
     column = cpyFrom.column;
     burstLength = cpyFrom.burstLength;
+    timeOfAcceptance = cpyFrom.timeOfAcceptance;
 }
 
 uint64_t ControllerExtension::getChannelPayloadID() const
@@ -326,6 +359,21 @@ unsigned ControllerExtension::getBurstLength(const tlm::tlm_generic_payload& tra
     return trans.get_extension<ControllerExtension>()->burstLength;
 }
 
+sc_time ControllerExtension::getTimeOfAcceptance(const tlm::tlm_generic_payload& trans)
+{
+    return trans.get_extension<ControllerExtension>()->timeOfAcceptance;
+}
+
+SchedulerLinks& ControllerExtension::getSchedulerLinks(tlm::tlm_generic_payload& trans)
+{
+    return trans.get_extension<ControllerExtension>()->schedulerLinks;
+}
+
+const SchedulerLinks& ControllerExtension::getSchedulerLinks(const tlm::tlm_generic_payload& trans)
+{
+    return trans.get_extension<ControllerExtension>()->schedulerLinks;
+}
+
 tlm::tlm_extension_base* ChildExtension::clone() const
 {
     return new ChildExtension(*parentTrans);
@@ -373,6 +421,39 @@ bool ChildExtension::isChildTrans(const tlm::tlm_generic_payload& trans)
     return trans.get_extension<ChildExtension>() != nullptr;
 }
 
+tlm_extension_base* RecorderExtension::clone() const
+{
+    return new RecorderExtension(slot);
+}
+
+void RecorderExtension::copy_from(const tlm_extension_base& ext)
+{
+    const auto& cpyFrom = dynamic_cast<const RecorderExtension&>(ext);
+    slot = cpyFrom.slot;
+}
+
+void RecorderExtension::setSlot(tlm::tlm_generic_payload& trans, uint32_t slot)
+{
+    auto* extension = trans.get_extension<RecorderExtension>();
+
+    if (extension != nullptr)
+    {
+        extension->slot = slot;
+    }
+    else
+    {
+        // Not an auto extension, so that it is kept when pooled payloads are reused
+        extension = new RecorderExtension(slot);
+        trans.set_extension(extension);
+    }
+}
+
+uint32_t RecorderExtension::getSlot(const tlm::tlm_generic_payload& trans)
+{
+    const auto* extension = trans.get_extension<RecorderExtension>();
+    return extension != nullptr ? extension->slot : INVALID_SLOT;
+}
+
 tlm_extension_base* ParentExtension::clone() const
 {
     return new ParentExtension(childTranses);
@@ -385,18 +466,19 @@ void ParentExtension::copy_from(const tlm_extension_base& ext)
 }
 
 void ParentExtension::setExtension(tlm::tlm_generic_payload& parentTrans,
-                                   std::vector<tlm::tlm_generic_payload*> childTranses)
+                                   const std::vector<tlm::tlm_generic_payload*>& childTranses)
 {
     auto* extension = parentTrans.get_extension<ParentExtension>();
 
     if (extension != nullptr)
     {
-        extension->childTranses = std::move(childTranses);
+        // Copy assignment reuses the capacity of a pooled parent payload
+        extension->childTranses = childTranses;
         extension->completedChildTranses = 0;
     }
     else
     {
-        extension = new ParentExtension(std::move(childTranses));
+        extension = new ParentExtension(childTranses);
         parentTrans.set_auto_extension(extension);
     }
 }
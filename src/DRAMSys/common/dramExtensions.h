@@ -38,6 +38,7 @@
 #ifndef DRAMEXTENSIONS_H
 #define DRAMEXTENSIONS_H
 
+#include <cstdint>
 #include <vector>
 
 #include <systemc>
@@ -91,6 +92,8 @@ public:
     static void setIDAndTimeOfGeneration(tlm::tlm_generic_payload& trans,
                                          uint64_t threadPayloadID,
                                          const sc_core::sc_time& timeOfGeneration);
+    static void setTimeOfResponse(tlm::tlm_generic_payload& trans,
+                                  const sc_core::sc_time& timeOfResponse);
 
     [[nodiscard]] tlm::tlm_extension_base* clone() const override;
     void copy_from(const tlm::tlm_extension_base& ext) override;
@@ -99,12 +102,14 @@ public:
     [[nodiscard]] Channel getChannel() const;
     [[nodiscard]] uint64_t getThreadPayloadID() const;
     [[nodiscard]] sc_core::sc_time getTimeOfGeneration() const;
+    [[nodiscard]] sc_core::sc_time getTimeOfResponse() const;
 
     static const ArbiterExtension& getExtension(const tlm::tlm_generic_payload& trans);
     static Thread getThread(const tlm::tlm_generic_payload& trans);
     static Channel getChannel(const tlm::tlm_generic_payload& trans);
     static uint64_t getThreadPayloadID(const tlm::tlm_generic_payload& trans);
     static sc_core::sc_time getTimeOfGeneration(const tlm::tlm_generic_payload& trans);
+    static sc_core::sc_time getTimeOfResponse(const tlm::tlm_generic_payload& trans);
 
 private:
     ArbiterExtension(Thread thread,
@@ -115,6 +120,25 @@ private:
     Channel channel;
     uint64_t threadPayloadID;
     sc_core::sc_time timeOfGeneration;
+    // Arrival of the response from the memory controller at the arbiter
+    sc_core::sc_time timeOfResponse = sc_core::SC_ZERO_TIME;
+};
+
+/**
+ * Links of a payload in the intrusive request queues of the schedulers. A payload is pending in
+ * at most one scheduler buffer at a time, where it is linked into the age order of the bank and
+ * into the age order of its row.
+ */
+struct SchedulerLinks
+{
+    struct Link
+    {
+        tlm::tlm_generic_payload* previous = nullptr;
+        tlm::tlm_generic_payload* next = nullptr;
+    };
+
+    Link age;
+    Link row;
 };
 
 class ControllerExtension : public tlm::tlm_extension<ControllerExtension>
@@ -140,6 +164,9 @@ public:
                              Column column,
                              unsigned burstLength);
 
+    static void setTimeOfAcceptance(tlm::tlm_generic_payload& trans,
+                                    const sc_core::sc_time& timeOfAcceptance);
+
     // static ControllerExtension& getExtension(const tlm::tlm_generic_payload& trans);
 
     [[nodiscard]] tlm::tlm_extension_base* clone() const override;
@@ -163,6 +190,9 @@ public:
     static Row getRow(const tlm::tlm_generic_payload& trans);
     static Column getColumn(const tlm::tlm_generic_payload& trans);
     static unsigned getBurstLength(const tlm::tlm_generic_payload& trans);
+    static sc_core::sc_time getTimeOfAcceptance(const tlm::tlm_generic_payload& trans);
+    static SchedulerLinks& getSchedulerLinks(tlm::tlm_generic_payload& trans);
+    static const SchedulerLinks& getSchedulerLinks(const tlm::tlm_generic_payload& trans);
 
 private:
     ControllerExtension(uint64_t channelPayloadID,
@@ -181,6 +211,9 @@ private:
     Row row;
     Column column;
     unsigned burstLength;
+    // Acceptance of the request by the controller, children inherit it from their parent
+    sc_core::sc_time timeOfAcceptance = sc_core::SC_ZERO_TIME;
+    SchedulerLinks schedulerLinks;
 };
 
 class ChildExtension : public tlm::tlm_extension<ChildExtension>
@@ -202,6 +235,29 @@ public:
     static bool isChildTrans(const tlm::tlm_generic_payload& trans);
 };
 
+/**
+ * Slot of a payload in the table of in-flight transactions of a TlmRecorder. The extension stays
+ * on the payload when it is reused, an invalid slot marks a payload that is not in flight.
+ */
+class RecorderExtension : public tlm::tlm_extension<RecorderExtension>
+{
+public:
+    static constexpr uint32_t INVALID_SLOT = UINT32_MAX;
+
+    // Marks transactions that are excluded by the recording filters until their last phase
+    static constexpr uint32_t FILTERED_SLOT = UINT32_MAX - 1;
+
+    [[nodiscard]] tlm::tlm_extension_base* clone() const override;
+    void copy_from(const tlm::tlm_extension_base& ext) override;
+
+    static void setSlot(tlm::tlm_generic_payload& trans, uint32_t slot);
+    static uint32_t getSlot(const tlm::tlm_generic_payload& trans);
+
+private:
+    explicit RecorderExtension(uint32_t slot) : slot(slot) {}
+    uint32_t slot;
+};
+
 class ParentExtension : public tlm::tlm_extension<ParentExtension>
 {
 private:
@@ -218,7 +274,7 @@ public:
     [[nodiscard]] tlm_extension_base* clone() const override;
     void copy_from(const tlm_extension_base& ext) override;
     static void setExtension(tlm::tlm_generic_payload& parentTrans,
-                             std::vector<tlm::tlm_generic_payload*> childTranses);
+                             const std::vector<tlm::tlm_generic_payload*>& childTranses);
     const std::vector<tlm::tlm_generic_payload*>& getChildTranses();
     bool notifyChildTransCompletion();
     static bool notifyChildTransCompletion(tlm::tlm_generic_payload& trans);
@@ -39,6 +39,8 @@
 #include <DRAMUtils/config/toggling_rate.h>
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace DRAMSys::Config
 {
@@ -69,6 +71,18 @@ NLOHMANN_JSON_SERIALIZE_ENUM(InlineEccType,
                               {InlineEccType::Orin, "Orin"},
                               {InlineEccType::TwoLevel, "TwoLevel"}})
 
+enum class RecordingFormatType
+{
+    Sqlite,
+    Columnar,
+    Invalid = -1
+};
+
+NLOHMANN_JSON_SERIALIZE_ENUM(RecordingFormatType,
+                             {{RecordingFormatType::Invalid, nullptr},
+                              {RecordingFormatType::Sqlite, "Sqlite"},
+                              {RecordingFormatType::Columnar, "Columnar"}})
+
 struct SimConfig
 {
     static constexpr std::string_view KEY = "simconfig";
@@ -85,6 +99,21 @@ struct SimConfig
     std::optional<unsigned int> WindowSize;
     std::optional<double> SimulationTime;
     std::optional<DRAMUtils::Config::ToggleRateDefinition> TogglingRate;
+    std::optional<unsigned int> WorkerThreads;
+    std::optional<unsigned int> RecordingBatchSize;
+    std::optional<unsigned int> RecordingQueueDepth;
+    std::optional<unsigned int> RecordingWriterThreads;
+    std::optional<bool> RecordingBulkLoad;
+    std::optional<RecordingFormatType> RecordingFormat;
+    std::optional<std::vector<std::pair<double, double>>> RecordingTimeWindows;
+    std::optional<std::vector<unsigned int>> RecordingChannels;
+    std::optional<std::vector<unsigned int>> RecordingThreads;
+    std::optional<unsigned int> RecordingSampleInterval;
+    std::optional<unsigned int> RecordingHistoryLength;
+    std::optional<unsigned int> RecordingPostTriggerLength;
+    std::optional<double> RecordingTriggerLatency;
+    std::optional<unsigned int> RecordingTriggerBufferDepth;
+    std::optional<bool> RecordingTriggerForcedRefresh;
 };
 
 NLOHMANN_JSONIFY_ALL_THINGS(SimConfig,
@@ -99,6 +128,21 @@ NLOHMANN_JSONIFY_ALL_THINGS(SimConfig,
                             ThermalSimulation,
                             WindowSize,
                             SimulationTime,
-                            TogglingRate)
+                            TogglingRate,
+                            WorkerThreads,
+                            RecordingBatchSize,
+                            RecordingQueueDepth,
+                            RecordingWriterThreads,
+                            RecordingBulkLoad,
+                            RecordingFormat,
+                            RecordingTimeWindows,
+                            RecordingChannels,
+                            RecordingThreads,
+                            RecordingSampleInterval,
+                            RecordingHistoryLength,
+                            RecordingPostTriggerLength,
+                            RecordingTriggerLatency,
+                            RecordingTriggerBufferDepth,
+                            RecordingTriggerForcedRefresh)
 
 } // namespace DRAMSys::Config
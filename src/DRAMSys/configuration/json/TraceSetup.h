@@ -81,10 +81,20 @@ struct TracePlayer
     unsigned dataLength;
     std::optional<unsigned int> maxPendingReadRequests;
     std::optional<unsigned int> maxPendingWriteRequests;
+
+    // Start of the playback in a binary trace (.btl)
+    std::optional<uint64_t> startRequest;
+    std::optional<uint64_t> startCycle;
 };
 
-NLOHMANN_JSONIFY_ALL_THINGS(
-    TracePlayer, clkMhz, name, dataLength, maxPendingReadRequests, maxPendingWriteRequests)
+NLOHMANN_JSONIFY_ALL_THINGS(TracePlayer,
+                            clkMhz,
+                            name,
+                            dataLength,
+                            maxPendingReadRequests,
+                            maxPendingWriteRequests,
+                            startRequest,
+                            startCycle)
 
 struct TrafficGeneratorActiveState
 {
@@ -60,6 +60,8 @@ ReadyCommand BankMachine::getNextCommand()
 
 void BankMachine::update(Command command)
 {
+    dirty = true;
+
     switch (command)
     {
     case Command::ACT:
@@ -142,9 +144,25 @@ uint64_t BankMachine::getRefreshManagementCounter() const
 void BankMachine::block()
 {
     blocked = true;
+    dirty = true;
     nextCommand = Command::NOP;
 }
 
+void BankMachine::markDirty()
+{
+    dirty = true;
+}
+
+void BankMachine::clearDirty()
+{
+    dirty = false;
+}
+
+bool BankMachine::isDirty() const
+{
+    return dirty;
+}
+
 Rank BankMachine::getRank() const
 {
     return rank;
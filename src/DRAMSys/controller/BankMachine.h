@@ -55,6 +55,15 @@ public:
     void update(Command command) override;
     void block();
 
+    /**
+     * @brief Marks the bank machine as affected by a new request, an issued command or a changed
+     * scheduling mode. Only dirty bank machines are re-evaluated by the controller, all others
+     * keep their next command and its cached ready time.
+     */
+    void markDirty();
+    void clearDirty();
+    [[nodiscard]] bool isDirty() const;
+
     [[nodiscard]] Rank getRank() const;
     [[nodiscard]] BankGroup getBankGroup() const;
     [[nodiscard]] Bank getBank() const;
@@ -84,6 +93,7 @@ protected:
     unsigned refreshManagementCounter = 0;
     const bool refreshManagement = false;
     bool keepTrans = false;
+    bool dirty = true;
 };
 
 class BankMachineOpen final : public BankMachine
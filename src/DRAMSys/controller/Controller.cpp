@@ -42,6 +42,7 @@
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/configuration/json/McConfig.h"
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/CheckerTable.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxOldest.h"
 #include "DRAMSys/controller/cmdmux/CmdMuxStrict.h"
 #include "DRAMSys/controller/powerdown/PowerDownManagerDummy.h"
@@ -85,9 +86,12 @@
 #include "DRAMSys/controller/checker/CheckerHBM3_4.h" // IWYU pragma: keep
 #endif
 
+#include <algorithm>
+#include <cassert>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 using namespace sc_core;
@@ -112,14 +116,28 @@ Controller::Controller(const sc_module_name& name,
     gearing(config.gearing),
     windowSizeTime(simConfig.windowSize * memSpec.tCK),
     numberOfBeatsServed(memSpec.ranksPerChannel, 0),
+    commandBusCycles(memSpec.hasRasAndCasBus() ? 2 : 1, 0),
     memoryManager(simConfig.storageEnabled),
-    stats(*this)
+    stats(*this),
+    nextRowAccess(memSpec.banksPerChannel, RowAccess::Hit),
+    rowHits(memSpec.banksPerChannel, 0),
+    rowMisses(memSpec.banksPerChannel, 0),
+    rowConflicts(memSpec.banksPerChannel, 0),
+    pendingRequestsOnBank(memSpec.banksPerChannel, 0)
 {
     if (simConfig.databaseRecording && tlmRecorder != nullptr)
     {
         SC_THREAD(recordBufferDepth);
     }
 
+    // The triggers of the flight recorder are only evaluated if the channel is recorded
+    if (simConfig.databaseRecording && tlmRecorder != nullptr &&
+        simConfig.recordingHistoryLength > 0)
+    {
+        triggerBufferDepth = simConfig.recordingTriggerBufferDepth;
+        triggerOnForcedRefresh = simConfig.recordingTriggerForcedRefresh;
+    }
+
     SC_METHOD(controllerMethod);
     sensitive << beginReqEvent << endRespEvent << controllerEvent << dataResponseEvent;
 
@@ -139,6 +157,13 @@ Controller::Controller(const sc_module_name& name,
             using MemSpecType = typename StandardMapping::Mapping<T>::MemSpecType;
             try
             {
+#ifdef USE_TABLE_CHECKERS
+                if constexpr (has_TimingTable_v<MemSpecType>)
+                {
+                    const auto& specificMemSpec = dynamic_cast<const MemSpecType&>(memSpec);
+                    return std::make_unique<CheckerTable>(specificMemSpec, createTimingTable(specificMemSpec));
+                }
+#endif
                 return std::make_unique<CheckerType>(dynamic_cast<const MemSpecType&>(memSpec));
             }
             catch (const std::bad_cast& e)
@@ -210,6 +235,9 @@ Controller::Controller(const sc_module_name& name,
                 config, memSpec, *scheduler, Bank(bankID)));
     }
 
+    bankMachineReadyTimes =
+        ControllerVector<Bank, sc_time>(memSpec.banksPerChannel, sc_max_time());
+
     bankMachinesOnRank = ControllerVector<Rank, ControllerVector<Bank, BankMachine*>>(
         memSpec.ranksPerChannel, ControllerVector<Bank, BankMachine*>(memSpec.banksPerRank));
     for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
@@ -295,6 +323,59 @@ Controller::Controller(const sc_module_name& name,
 
     slidingAverageBufferDepth = std::vector<sc_time>(scheduler->getBufferDepth().size());
     windowAverageBufferDepth = std::vector<double>(scheduler->getBufferDepth().size());
+
+    // At most one command per bank machine and one refresh or power-down command per rank
+    readyCommands.reserve(memSpec.banksPerChannel + memSpec.ranksPerChannel);
+
+    selectPipeline(memSpecVar);
+}
+
+void Controller::selectPipeline(
+    [[maybe_unused]] const DRAMUtils::MemSpec::MemSpecVariant& memSpecVar)
+{
+    pipeline =
+        &Controller::controllerMethodPipeline<CheckerIF, SchedulerIF, BankMachine, CmdMuxIF, MemSpec>;
+
+#ifdef USE_SPECIALIZED_CONTROLLER
+    // Only the most common configurations are specialized, all others use the generic pipeline
+    if (config.scheduler != Config::SchedulerType::FrFcfs ||
+        config.cmdMux != Config::CmdMuxType::Oldest)
+        return;
+
+    std::visit(
+        [this](const auto& v)
+        {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (StandardMapping::has_SpecializedCmdMuxType_v<T>)
+            {
+                using MemSpecType = typename StandardMapping::Mapping<T>::MemSpecType;
+                using CmdMuxType = typename StandardMapping::Mapping<T>::SpecializedCmdMuxType;
+#ifdef USE_TABLE_CHECKERS
+                using CheckerType = std::conditional_t<has_TimingTable_v<MemSpecType>,
+                                                       CheckerTable,
+                                                       typename StandardMapping::Mapping<T>::CheckerType>;
+#else
+                using CheckerType = typename StandardMapping::Mapping<T>::CheckerType;
+#endif
+                assert(dynamic_cast<CheckerType*>(checker.get()) != nullptr);
+                assert(dynamic_cast<CmdMuxType*>(cmdMux.get()) != nullptr);
+
+                if (config.pagePolicy == Config::PagePolicyType::Open)
+                    pipeline = &Controller::controllerMethodPipeline<CheckerType,
+                                                                     SchedulerFrFcfs,
+                                                                     BankMachineOpen,
+                                                                     CmdMuxType,
+                                                                     MemSpecType>;
+                else if (config.pagePolicy == Config::PagePolicyType::OpenAdaptive)
+                    pipeline = &Controller::controllerMethodPipeline<CheckerType,
+                                                                     SchedulerFrFcfs,
+                                                                     BankMachineOpenAdaptive,
+                                                                     CmdMuxType,
+                                                                     MemSpecType>;
+            }
+        },
+        memSpecVar.getVariant());
+#endif
 }
 
 void Controller::registerIdleCallback(std::function<void()> idleCallback)
@@ -333,12 +414,29 @@ void Controller::recordBufferDepth()
 
 void Controller::controllerMethod()
 {
+    (this->*pipeline)();
+}
+
+template <typename CheckerType,
+          typename SchedulerType,
+          typename BankMachineType,
+          typename CmdMuxType,
+          typename MemSpecType>
+void Controller::controllerMethodPipeline()
+{
+    // The casts are no-ops for the generic pipeline. For final component types they allow the
+    // compiler to resolve and inline all calls of the per-cycle path.
+    auto& checkerImpl = static_cast<CheckerType&>(*checker);
+    auto& schedulerImpl = static_cast<SchedulerType&>(*scheduler);
+    auto& cmdMuxImpl = static_cast<CmdMuxType&>(*cmdMux);
+    const auto& memSpecImpl = static_cast<const MemSpecType&>(memSpec);
+
     // Compute and report BufferDepth
-    if (simConfig.databaseRecording && simConfig.enableWindowing)
+    if (tlmRecorder != nullptr && simConfig.enableWindowing)
     {
         sc_time timeDiff = sc_time_stamp() - lastTimeCalled;
         lastTimeCalled = sc_time_stamp();
-        const std::vector<unsigned>& bufferDepth = scheduler->getBufferDepth();
+        const std::vector<unsigned>& bufferDepth = schedulerImpl.getBufferDepth();
 
         for (std::size_t index = 0; index < slidingAverageBufferDepth.size(); index++)
             slidingAverageBufferDepth[index] += bufferDepth[index] * timeDiff;
@@ -360,7 +458,7 @@ void Controller::controllerMethod()
         it->evaluate();
 
     // clear command buffer
-    std::vector<ReadyCommand> readyCommands;
+    readyCommands.clear();
 
     // (4) Collect all ready commands from BMs, RMs and PDMs
     for (unsigned rankID = 0; rankID < memSpec.ranksPerChannel; rankID++)
@@ -380,7 +478,7 @@ void Controller::controllerMethod()
             // (4.3) Check for bank commands (PREPB, ACT, RD/RDA or WR/WRA)
             for (auto* it : bankMachinesOnRank[rank])
             {
-                nextCommand = it->getNextCommand();
+                nextCommand = static_cast<BankMachineType*>(it)->getNextCommand();
                 if (nextCommand.command != Command::NOP)
                     readyCommands.emplace_back(nextCommand);
             }
@@ -389,98 +487,207 @@ void Controller::controllerMethod()
 
     for (auto& it : readyCommands)
     {
-        it.readyTime = checker->timeToSatisfyConstraints(it.command, *it.trans);
+        it.readyTime = checkerImpl.timeToSatisfyConstraints(it.command, *it.trans);
     }
 
-    // (5) Select some of the ready commands and issue it to the DRAM
-    bool readyCmdBlocked = false;
-    if (!readyCommands.empty())
+    // Issues a selected command to the DRAM and updates all components accordingly
+    auto issueCommand = [&](const ReadyCommand& readyCommand)
     {
-        auto selectedCommand = cmdMux->selectCommand(readyCommands);
+        Command command = readyCommand.command;
+        tlm_generic_payload* trans = readyCommand.trans;
 
-        if (!selectedCommand.has_value() // can happen with FIFO strict
-            || selectedCommand->readyTime != sc_time_stamp())
+        Rank rank = ControllerExtension::getRank(*trans);
+        Bank bank = ControllerExtension::getBank(*trans);
+
+        // update
+        if (command.isRankCommand())
         {
-            readyCmdBlocked = true;
+            for (auto* it : bankMachinesOnRank[rank])
+                static_cast<BankMachineType*>(it)->update(command);
         }
-        else
+        else if (command.isGroupCommand())
         {
-            Command command = selectedCommand->command;
-            tlm_generic_payload* trans = selectedCommand->trans;
+            for (std::size_t bankID = (static_cast<std::size_t>(bank) % memSpec.banksPerGroup);
+                 bankID < memSpec.banksPerRank;
+                 bankID += memSpec.banksPerGroup)
+                static_cast<BankMachineType*>(bankMachinesOnRank[rank][Bank(bankID)])
+                    ->update(command);
+        }
+        else if (command.is2BankCommand())
+        {
+            static_cast<BankMachineType&>(*bankMachines[bank]).update(command);
+            static_cast<BankMachineType&>(
+                *bankMachines[Bank(static_cast<std::size_t>(bank) + memSpecImpl.getPer2BankOffset())])
+                .update(command);
+        }
+        else // if (isBankCommand(command))
+            static_cast<BankMachineType&>(*bankMachines[bank]).update(command);
 
-            Rank rank = ControllerExtension::getRank(*trans);
-            Bank bank = ControllerExtension::getBank(*trans);
+        cmdMuxImpl.update(command);
 
-            // update
-            if (command.isRankCommand())
-            {
-                for (auto* it : bankMachinesOnRank[rank])
-                    it->update(command);
-            }
-            else if (command.isGroupCommand())
-            {
-                for (std::size_t bankID = (static_cast<std::size_t>(bank) % memSpec.banksPerGroup);
-                     bankID < memSpec.banksPerRank;
-                     bankID += memSpec.banksPerGroup)
-                    bankMachinesOnRank[rank][Bank(bankID)]->update(command);
-            }
-            else if (command.is2BankCommand())
-            {
-                bankMachines[bank]->update(command);
-                bankMachines[Bank(static_cast<std::size_t>(bank) + memSpec.getPer2BankOffset())]
-                    ->update(command);
-            }
-            else // if (isBankCommand(command))
-                bankMachines[bank]->update(command);
+        // The state of the refresh manager has to be checked before it is updated
+        if (triggerOnForcedRefresh && isRefreshCommandPhase(command.toPhase()) &&
+            refreshManagers[rank]->isRefreshForced())
+            tlmRecorder->trigger("forced refresh");
 
-            cmdMux->update(command);
+        refreshManagers[rank]->update(command);
+        powerDownManagers[rank]->update(command);
+        checkerImpl.insert(command, *trans);
 
-            refreshManagers[rank]->update(command);
-            powerDownManagers[rank]->update(command);
-            checker->insert(command, *trans);
+        const std::size_t commandBus = command.isCasCommand() ? commandBusCycles.size() - 1 : 0;
+        commandBusCycles[commandBus] += memSpecImpl.getCommandLengthInCycles(command);
 
-            if (command.isCasCommand())
-            {
-                scheduler->removeRequest(*trans);
-                manageRequests(config.thinkDelayFw);
+        numberOfCommands[command]++;
 
-                if (accessCallback)
-                    accessCallback(*trans);
+        // A precharge on behalf of a request closes a row that the request does not hit, all
+        // other precharges are issued by the page policy or the refresh managers
+        if (command == Command::PREPB && trans->get_command() != TLM_IGNORE_COMMAND)
+            nextRowAccess[bank] = RowAccess::Conflict;
+        else if (command == Command::ACT && nextRowAccess[bank] == RowAccess::Hit)
+            nextRowAccess[bank] = RowAccess::Miss;
+
+        if (command.isCasCommand())
+        {
+            stats.queueingDelay.histogram.record(
+                (sc_time_stamp() - ControllerExtension::getTimeOfAcceptance(*trans)).value());
+
+            if (nextRowAccess[bank] == RowAccess::Hit)
+                rowHits[bank]++;
+            else if (nextRowAccess[bank] == RowAccess::Miss)
+                rowMisses[bank]++;
+            else
+                rowConflicts[bank]++;
+            nextRowAccess[bank] = RowAccess::Hit;
 
-                sc_time phyDelayBwEff = trans->is_read()
-                                ? config.phyDelayBw
-                                : SC_ZERO_TIME;
+            removeFromScheduler(bank);
+            schedulerImpl.removeRequest(*trans);
+            manageRequests(config.thinkDelayFw);
 
-                respQueue->insertPayload(trans,
-                                         sc_time_stamp() + config.phyDelayFw +
-                                             memSpec.getIntervalOnDataStrobe(command, *trans).end +
-                                             phyDelayBwEff + config.thinkDelayBw);
+            if (accessCallback)
+                accessCallback(*trans);
 
-                sc_time triggerTime = respQueue->getTriggerTime();
-                if (triggerTime != sc_max_time())
-                    dataResponseEvent.notify(triggerTime - sc_time_stamp());
+            sc_time phyDelayBwEff = trans->is_read()
+                            ? config.phyDelayBw
+                            : SC_ZERO_TIME;
 
-                ranksNumberOfPayloads[rank]--; // TODO: move to a different place?
+            respQueue->insertPayload(trans,
+                                     sc_time_stamp() + config.phyDelayFw +
+                                         memSpecImpl.getIntervalOnDataStrobe(command, *trans).end +
+                                         phyDelayBwEff + config.thinkDelayBw);
+
+            sc_time triggerTime = respQueue->getTriggerTime();
+            if (triggerTime != sc_max_time())
+                dataResponseEvent.notify(triggerTime - sc_time_stamp());
+
+            ranksNumberOfPayloads[rank]--; // TODO: move to a different place?
+        }
+        if (ranksNumberOfPayloads[rank] == 0)
+            powerDownManagers[rank]->triggerEntry();
+
+        if (traceCallback)
+            traceCallback(*trans, command.toPhase(), config.phyDelayFw);
+    };
+
+    // A second command selected for the other command bus was ready before the first command was
+    // issued. It is only issued as well if its source still offers it and the constraints
+    // introduced by the first command are satisfied.
+    auto isStillReady = [&](const ReadyCommand& readyCommand)
+    {
+        // A changed scheduling mode invalidates the next commands of all bank machines
+        if (schedulerImpl.getSelectionEpoch() != schedulerSelectionEpoch)
+            return false;
+
+        const tlm_generic_payload& trans = *readyCommand.trans;
+        Rank rank = ControllerExtension::getRank(trans);
+        auto isOffered = [&readyCommand](const ReadyCommand& nextCommand)
+        {
+            return nextCommand.command == readyCommand.command &&
+                   nextCommand.trans == readyCommand.trans;
+        };
+
+        refreshManagers[rank]->evaluate();
+        powerDownManagers[rank]->evaluate();
+
+        bool offered = false;
+        auto nextCommand = powerDownManagers[rank]->getNextCommand();
+        if (nextCommand.command != Command::NOP)
+            offered = isOffered(nextCommand);
+        else if (isOffered(refreshManagers[rank]->getNextCommand()))
+            offered = true;
+        else if (readyCommand.command.isBankCommand())
+        {
+            auto& bankMachine =
+                static_cast<BankMachineType&>(*bankMachines[ControllerExtension::getBank(trans)]);
+            if (bankMachine.isDirty())
+            {
+                bankMachine.evaluate();
+                bankMachine.clearDirty();
             }
-            if (ranksNumberOfPayloads[rank] == 0)
-                powerDownManagers[rank]->triggerEntry();
+            offered = isOffered(bankMachine.getNextCommand());
+        }
 
-            if (traceCallback)
-                traceCallback(*trans, command.toPhase(), config.phyDelayFw);
+        return offered && checkerImpl.timeToSatisfyConstraints(readyCommand.command, trans) ==
+                              sc_time_stamp();
+    };
+
+    // (5) Select some of the ready commands and issue them to the DRAM
+    bool readyCmdBlocked = false;
+    bool checkerUpdated = false;
+    if (!readyCommands.empty())
+    {
+        auto selectedCommands = cmdMuxImpl.selectCommands(readyCommands);
+        const auto& selectedCommand = selectedCommands[0];
+
+        if (!selectedCommand.has_value() // can happen with FIFO strict
+            || selectedCommand->readyTime != sc_time_stamp())
+        {
+            readyCmdBlocked = true;
+        }
+        else
+        {
+            issueCommand(*selectedCommand);
+            checkerUpdated = true;
+
+            // (5.1) Dual-issue on separate row and column command buses
+            const auto& secondCommand = selectedCommands[1];
+            if (secondCommand.has_value() && isStillReady(*secondCommand))
+                issueCommand(*secondCommand);
         }
     }
 
     // (6) Restart bank machines, refresh managers and power-down managers to issue new requests for
     // the future
+    // Only bank machines that are affected by a new request, an issued command or a changed
+    // scheduling mode are re-evaluated. All other bank machines keep their next command, their ready
+    // time is only recomputed if the timing checker has been updated in the meantime.
+    if (schedulerImpl.getSelectionEpoch() != schedulerSelectionEpoch)
+    {
+        schedulerSelectionEpoch = schedulerImpl.getSelectionEpoch();
+        for (auto& it : bankMachines)
+            it->markDirty();
+    }
+
     sc_time timeForNextTrigger = sc_max_time();
     sc_time localTime;
     for (auto& it : bankMachines)
     {
-        it->evaluate();
-        auto nextCommand = it->getNextCommand();
+        auto& bankMachine = static_cast<BankMachineType&>(*it);
+        const bool dirty = bankMachine.isDirty();
+        if (dirty)
+        {
+            bankMachine.evaluate();
+            bankMachine.clearDirty();
+        }
+
+        auto nextCommand = bankMachine.getNextCommand();
         if (nextCommand.command != Command::NOP)
         {
-            localTime = checker->timeToSatisfyConstraints(nextCommand.command, *nextCommand.trans);
+            sc_time& readyTime = bankMachineReadyTimes[bankMachine.getBank()];
+            if (dirty || checkerUpdated)
+                readyTime =
+                    checkerImpl.timeToSatisfyConstraints(nextCommand.command, *nextCommand.trans);
+
+            localTime = std::max(readyTime, sc_time_stamp());
             if (!(localTime == sc_time_stamp() && readyCmdBlocked))
                 timeForNextTrigger = std::min(timeForNextTrigger, localTime);
         }
@@ -491,7 +698,7 @@ void Controller::controllerMethod()
         auto nextCommand = it->getNextCommand();
         if (nextCommand.command != Command::NOP)
         {
-            localTime = checker->timeToSatisfyConstraints(nextCommand.command, *nextCommand.trans);
+            localTime = checkerImpl.timeToSatisfyConstraints(nextCommand.command, *nextCommand.trans);
             if (!(localTime == sc_time_stamp() && readyCmdBlocked))
                 timeForNextTrigger = std::min(timeForNextTrigger, localTime);
         }
@@ -506,7 +713,7 @@ void Controller::controllerMethod()
         auto nextCommand = it->getNextCommand();
         if (nextCommand.command != Command::NOP)
         {
-            localTime = checker->timeToSatisfyConstraints(nextCommand.command, *nextCommand.trans);
+            localTime = checkerImpl.timeToSatisfyConstraints(nextCommand.command, *nextCommand.trans);
             if (!(localTime == sc_time_stamp() && readyCmdBlocked))
                 timeForNextTrigger = std::min(timeForNextTrigger, localTime);
         }
@@ -587,6 +794,9 @@ void Controller::manageRequests(const sc_time& delay)
                 idleTimeCollector.end();
             totalNumberOfPayloads++; // seems to be ok
 
+            if (triggerBufferDepth > 0 && totalNumberOfPayloads > triggerBufferDepth)
+                tlmRecorder->trigger("buffer depth");
+
             transToAcquire.payload->acquire();
 
             // The following logic assumes that transactions are naturally aligned
@@ -631,6 +841,8 @@ void Controller::manageRequests(const sc_time& delay)
                                                       Row(decodedAddress.row),
                                                       Column(decodedAddress.column),
                                                       burstLength);
+                ControllerExtension::setTimeOfAcceptance(*transToAcquire.payload,
+                                                         sc_time_stamp());
 
                 Rank rank = Rank(decodedAddress.rank);
                 if (ranksNumberOfPayloads[rank] == 0)
@@ -639,6 +851,8 @@ void Controller::manageRequests(const sc_time& delay)
 
                 scheduler->storeRequest(*transToAcquire.payload);
                 Bank bank = Bank(decodedAddress.bank);
+                storeInScheduler(bank);
+                bankMachines[bank]->markDirty();
                 bankMachines[bank]->evaluate();
             }
             else
@@ -648,6 +862,8 @@ void Controller::manageRequests(const sc_time& delay)
                     transToAcquire.payload->get_extension<ParentExtension>()->getChildTranses();
                 for (auto* childTrans : childTranses)
                 {
+                    ControllerExtension::setTimeOfAcceptance(*childTrans, sc_time_stamp());
+
                     Rank rank = ControllerExtension::getRank(*childTrans);
                     if (ranksNumberOfPayloads[rank] == 0)
                         powerDownManagers[rank]->triggerExit();
@@ -655,6 +871,8 @@ void Controller::manageRequests(const sc_time& delay)
 
                     scheduler->storeRequest(*childTrans);
                     Bank bank = ControllerExtension::getBank(*childTrans);
+                    storeInScheduler(bank);
+                    bankMachines[bank]->markDirty();
                     bankMachines[bank]->evaluate();
                 }
             }
@@ -672,6 +890,40 @@ void Controller::manageRequests(const sc_time& delay)
     }
 }
 
+void Controller::storeInScheduler(Bank bank)
+{
+    accumulateOccupancy();
+
+    if (pendingRequestsOnBank[bank]++ == 0)
+        busyBanks++;
+
+    pendingRequests++;
+    maxPendingRequests = std::max(maxPendingRequests, pendingRequests);
+}
+
+void Controller::removeFromScheduler(Bank bank)
+{
+    accumulateOccupancy();
+
+    if (--pendingRequestsOnBank[bank] == 0)
+        busyBanks--;
+
+    pendingRequests--;
+}
+
+void Controller::accumulateOccupancy()
+{
+    sc_time elapsed = sc_time_stamp() - lastOccupancyChange;
+    lastOccupancyChange = sc_time_stamp();
+
+    if (busyBanks == 0)
+        return;
+
+    pendingRequestsTime += static_cast<double>(pendingRequests) * elapsed;
+    busyBanksTime += static_cast<double>(busyBanks) * elapsed;
+    anyBankBusyTime += elapsed;
+}
+
 void Controller::manageResponses()
 {
     if (transToRelease.payload != nullptr)
@@ -716,6 +968,10 @@ void Controller::processNextTransInRespQueue(tlm::tlm_generic_payload* nextTrans
     }
     else
     {
+        stats.requestLatency.histogram.record(
+            (sc_time_stamp() - ControllerExtension::getTimeOfAcceptance(*nextTransInRespQueue))
+                .value());
+
         transToRelease.payload = nextTransInRespQueue;
         tlm_phase bwPhase = BEGIN_RESP;
         sc_time bwDelay = SC_ZERO_TIME;
@@ -730,6 +986,11 @@ void Controller::processNextChildRespTrans(tlm::tlm_generic_payload* nextTransIn
     tlm_generic_payload& parentTrans = ChildExtension::getParentTrans(*nextTransInRespQueue);
     if (ParentExtension::notifyChildTransCompletion(parentTrans))
     {
+        // All children of a parent are accepted at the same time
+        stats.requestLatency.histogram.record(
+            (sc_time_stamp() - ControllerExtension::getTimeOfAcceptance(*nextTransInRespQueue))
+                .value());
+
         transToRelease.payload = &parentTrans;
         tlm_phase bwPhase = BEGIN_RESP;
         sc_time bwDelay = SC_ZERO_TIME;
@@ -769,7 +1030,7 @@ void Controller::sendToFrontend(tlm_generic_payload& trans, tlm_phase& phase, sc
 
 void Controller::createChildTranses(tlm::tlm_generic_payload& parentTrans)
 {
-    std::vector<tlm_generic_payload*> childTranses;
+    childTranses.clear();
 
     const uint64_t startAddress = parentTrans.get_address();
     unsigned char* const startDataPtr = parentTrans.get_data_ptr();
@@ -817,7 +1078,7 @@ void Controller::createChildTranses(tlm::tlm_generic_payload& parentTrans)
     }
 
     nextChannelPayloadIDToAppend++;
-    ParentExtension::setExtension(parentTrans, std::move(childTranses));
+    ParentExtension::setExtension(parentTrans, childTranses);
 }
 
 void Controller::end_of_simulation()
@@ -884,7 +1145,44 @@ Controller::Stats::Stats(Controller const& controller) :
     averageUtilizationWithoutIdle(addStat<Statistics::ScalarStat>(
         "AverageUtilizationWithoutIdle",
         "Average utilization over simulation duration with idle times being ignored",
-        Statistics::Quantity::Percentage))
+        Statistics::Quantity::Percentage)),
+    commandBusUtilization(addStat<Statistics::VectorStat>(
+        "CommandBusUtilization",
+        "Utilization per command bus over simulation duration (row bus first if separate)",
+        Statistics::Quantity::Percentage)),
+    queueingDelay(addStat<Statistics::HistogramStat>(
+        "QueueingDelay",
+        "Delay from the acceptance of a request until its column command is issued",
+        Statistics::Quantity::Time,
+        sc_get_time_resolution().to_seconds())),
+    requestLatency(addStat<Statistics::HistogramStat>(
+        "RequestLatency",
+        "Latency from the acceptance of a request until its response is sent",
+        Statistics::Quantity::Time,
+        sc_get_time_resolution().to_seconds())),
+    rowHitsPerBank(addStat<Statistics::VectorStat>("RowHitsPerBank",
+                                                   "Requests served from the open row per bank",
+                                                   Statistics::Quantity::Count)),
+    rowMissesPerBank(addStat<Statistics::VectorStat>("RowMissesPerBank",
+                                                     "Requests served from a closed bank per bank",
+                                                     Statistics::Quantity::Count)),
+    rowConflictsPerBank(addStat<Statistics::VectorStat>(
+        "RowConflictsPerBank",
+        "Requests that required another row to be closed per bank",
+        Statistics::Quantity::Count)),
+    averageSchedulerOccupancy(addStat<Statistics::ScalarStat>(
+        "AverageSchedulerOccupancy",
+        "Average number of requests in the scheduler over simulation duration",
+        Statistics::Quantity::Average)),
+    maximumSchedulerOccupancy(
+        addStat<Statistics::ScalarStat>("MaximumSchedulerOccupancy",
+                                        "Maximum number of requests in the scheduler",
+                                        Statistics::Quantity::Count)),
+    bankLevelParallelism(addStat<Statistics::ScalarStat>(
+        "BankLevelParallelism",
+        "Average number of banks with pending requests while at least one bank has one",
+        Statistics::Quantity::Average)),
+    commandStats(this)
 {
     for (std::size_t i = 0; i < controller.memSpec.ranksPerChannel; i++)
     {
@@ -901,10 +1199,29 @@ Controller::Stats::RankStats::RankStats(std::string name, Group *parent) :
     averageUtilization(
         addStat<Statistics::ScalarStat>("AverageUtilization",
                                         "Average utilization per rank over simulation duration",
-                                        Statistics::Quantity::Percentage))
+                                        Statistics::Quantity::Percentage)),
+    rowHits(addStat<Statistics::ScalarStat>(
+        "RowHits", "Requests served from the open row", Statistics::Quantity::Count)),
+    rowMisses(addStat<Statistics::ScalarStat>(
+        "RowMisses", "Requests served from a closed bank", Statistics::Quantity::Count)),
+    rowConflicts(addStat<Statistics::ScalarStat>("RowConflicts",
+                                                 "Requests that required another row to be closed",
+                                                 Statistics::Quantity::Count))
 {
 }
 
+Controller::Stats::CommandStats::CommandStats(Group* parent) : Group("commands", parent)
+{
+    for (unsigned type = Command::NOP + 1; type < Command::END_ENUM; type++)
+    {
+        std::string command = Command(static_cast<Command::Type>(type)).toString();
+        numberOfCommands.push_back(&addStat<Statistics::ScalarStat>(
+            command,
+            fmt::format("Total number of issued {} commands", command),
+            Statistics::Quantity::Count));
+    }
+}
+
 void Controller::updateStats()
 {
     stats.numberOfRequests = static_cast<double>(numberOfRequests);
@@ -927,6 +1244,10 @@ void Controller::updateStats()
     stats.averageUtilization = bandwidth / maxBandwidth;
     stats.averageUtilizationWithoutIdle = bandwidth / maxBandwidth * idleFactor;
 
+    stats.commandBusUtilization.values.resize(commandBusCycles.size());
+    for (std::size_t i = 0; i < commandBusCycles.size(); i++)
+        stats.commandBusUtilization.values[i] = commandBusCycles[i] * memSpec.tCK / sc_time_stamp();
+
     for (std::size_t i = 0; i < stats.rankStats.size(); i++)
     {
         double rankBandwidth = getAverageBandwidthPerRank(i);
@@ -934,6 +1255,36 @@ void Controller::updateStats()
         stats.rankStats[i]->averageBandwidth = rankBandwidth;
         stats.rankStats[i]->averageUtilization = rankUtilization;
     }
+
+    stats.rowHitsPerBank.values.resize(memSpec.banksPerChannel);
+    stats.rowMissesPerBank.values.resize(memSpec.banksPerChannel);
+    stats.rowConflictsPerBank.values.resize(memSpec.banksPerChannel);
+    for (auto& rank : stats.rankStats)
+    {
+        rank->rowHits = 0;
+        rank->rowMisses = 0;
+        rank->rowConflicts = 0;
+    }
+    for (std::size_t i = 0; i < memSpec.banksPerChannel; i++)
+    {
+        Bank bank = Bank(i);
+        auto& rank = *stats.rankStats[i / memSpec.banksPerRank];
+        stats.rowHitsPerBank.values[i] = static_cast<double>(rowHits[bank]);
+        stats.rowMissesPerBank.values[i] = static_cast<double>(rowMisses[bank]);
+        stats.rowConflictsPerBank.values[i] = static_cast<double>(rowConflicts[bank]);
+        rank.rowHits.value += static_cast<double>(rowHits[bank]);
+        rank.rowMisses.value += static_cast<double>(rowMisses[bank]);
+        rank.rowConflicts.value += static_cast<double>(rowConflicts[bank]);
+    }
+
+    for (std::size_t i = Command::NOP + 1; i < numberOfCommands.size(); i++)
+        *stats.commandStats.numberOfCommands[i - 1] = static_cast<double>(numberOfCommands[i]);
+
+    accumulateOccupancy();
+    stats.averageSchedulerOccupancy = pendingRequestsTime / sc_time_stamp();
+    stats.maximumSchedulerOccupancy = static_cast<double>(maxPendingRequests);
+    stats.bankLevelParallelism =
+        anyBankBusyTime == SC_ZERO_TIME ? 0.0 : busyBanksTime / anyBankBusyTime;
 }
 
 void Controller::resetStats()
@@ -944,6 +1295,26 @@ void Controller::resetStats()
 
     for (std::size_t i = 0; i < stats.rankStats.size(); i++)
         numberOfBeatsServed[i] = 0;
+
+    for (auto& cycles : commandBusCycles)
+        cycles = 0;
+
+    stats.queueingDelay.histogram.reset();
+    stats.requestLatency.histogram.reset();
+
+    for (std::size_t i = 0; i < memSpec.banksPerChannel; i++)
+    {
+        rowHits[Bank(i)] = 0;
+        rowMisses[Bank(i)] = 0;
+        rowConflicts[Bank(i)] = 0;
+    }
+    numberOfCommands.fill(0);
+
+    accumulateOccupancy();
+    maxPendingRequests = pendingRequests;
+    pendingRequestsTime = SC_ZERO_TIME;
+    busyBanksTime = SC_ZERO_TIME;
+    anyBankBusyTime = SC_ZERO_TIME;
 }
 
 } // namespace DRAMSys
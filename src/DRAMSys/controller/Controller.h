@@ -58,6 +58,7 @@
 
 #include <DRAMUtils/memspec/MemSpec.h>
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <systemc>
@@ -116,14 +117,38 @@ private:
     sendToFrontend(tlm::tlm_generic_payload& trans, tlm::tlm_phase& phase, sc_core::sc_time& delay);
 
     virtual void controllerMethod();
+
+    /**
+     * @brief The per-cycle controller pipeline. Instantiated with the component interfaces it
+     * serves as the generic implementation, instantiated with final component types the compiler
+     * can resolve and inline all calls on the hot path.
+     */
+    template <typename CheckerType,
+              typename SchedulerType,
+              typename BankMachineType,
+              typename CmdMuxType,
+              typename MemSpecType>
+    void controllerMethodPipeline();
+    void selectPipeline(const DRAMUtils::MemSpec::MemSpecVariant& memSpecVar);
+    void (Controller::*pipeline)() = nullptr;
+
     void recordBufferDepth();
 
+    // Called whenever a request enters or leaves the scheduler buffer
+    void storeInScheduler(Bank bank);
+    void removeFromScheduler(Bank bank);
+    void accumulateOccupancy();
+
     const McConfig& config;
     const MemSpec& memSpec;
     const SimConfig& simConfig;
     const AddressDecoder& addressDecoder;
     TlmRecorder* const tlmRecorder;
 
+    // Flight recorder triggers that depend on the controller state, disabled by default
+    unsigned triggerBufferDepth = 0;
+    bool triggerOnForcedRefresh = false;
+
     std::unique_ptr<SchedulerIF> scheduler;
 
     /**
@@ -138,11 +163,15 @@ private:
     std::vector<double> windowAverageBufferDepth;
 
     std::vector<uint64_t> numberOfBeatsServed;
+    // Occupied cycles per command bus, the row command bus comes first if the buses are separate
+    std::vector<double> commandBusCycles;
     unsigned totalNumberOfPayloads = 0;
     std::function<void()> idleCallback;
     ControllerVector<Rank, unsigned> ranksNumberOfPayloads;
 
     ControllerVector<Bank, std::unique_ptr<BankMachine>> bankMachines;
+    ControllerVector<Bank, sc_core::sc_time> bankMachineReadyTimes;
+    uint64_t schedulerSelectionEpoch = 0;
     ControllerVector<Rank, ControllerVector<Bank, BankMachine*>> bankMachinesOnRank;
     std::unique_ptr<CmdMuxIF> cmdMux;
     std::unique_ptr<CheckerIF> checker;
@@ -150,6 +179,9 @@ private:
     ControllerVector<Rank, std::unique_ptr<RefreshManagerIF>> refreshManagers;
     ControllerVector<Rank, std::unique_ptr<PowerDownManagerIF>> powerDownManagers;
 
+    // Reused in every call of the controller method to avoid allocations on the hot path
+    CmdMuxIF::ReadyCommands readyCommands;
+
     std::function<void(tlm::tlm_generic_payload&)> accessCallback;
     std::function<void(
         tlm::tlm_generic_payload const&, tlm::tlm_phase const&, sc_core::sc_time const&)>
@@ -174,6 +206,7 @@ private:
     MemoryManager memoryManager;
 
     void createChildTranses(tlm::tlm_generic_payload& parentTrans);
+    std::vector<tlm::tlm_generic_payload*> childTranses;
 
     class Stats : public Statistics::Group
     {
@@ -186,17 +219,38 @@ private:
         Statistics::ScalarStat& maximumTheoreticalBandwidth;
         Statistics::ScalarStat& averageUtilization;
         Statistics::ScalarStat& averageUtilizationWithoutIdle;
+        Statistics::VectorStat& commandBusUtilization;
+        Statistics::HistogramStat& queueingDelay;
+        Statistics::HistogramStat& requestLatency;
+        Statistics::VectorStat& rowHitsPerBank;
+        Statistics::VectorStat& rowMissesPerBank;
+        Statistics::VectorStat& rowConflictsPerBank;
+        Statistics::ScalarStat& averageSchedulerOccupancy;
+        Statistics::ScalarStat& maximumSchedulerOccupancy;
+        Statistics::ScalarStat& bankLevelParallelism;
 
         class RankStats : public Statistics::Group
         {
         public:
             Statistics::ScalarStat& averageBandwidth;
             Statistics::ScalarStat& averageUtilization;
+            Statistics::ScalarStat& rowHits;
+            Statistics::ScalarStat& rowMisses;
+            Statistics::ScalarStat& rowConflicts;
 
             RankStats(std::string name, Group* parent);
         };
         std::vector<std::unique_ptr<RankStats>> rankStats;
 
+        // One statistic per command type except NOP, indexed by the command minus one
+        class CommandStats : public Statistics::Group
+        {
+        public:
+            std::vector<Statistics::ScalarStat*> numberOfCommands;
+
+            CommandStats(Group* parent);
+        } commandStats;
+
         Stats(Controller const& controller);
     } stats;
 
@@ -204,6 +258,29 @@ private:
     uint64_t numberOfReadRequests = 0;
     uint64_t numberOfWriteRequests = 0;
 
+    // Row buffer locality, classified when the column command of a request is issued
+    enum class RowAccess : uint8_t
+    {
+        Hit,
+        Miss,
+        Conflict
+    };
+    ControllerVector<Bank, RowAccess> nextRowAccess;
+    ControllerVector<Bank, uint64_t> rowHits;
+    ControllerVector<Bank, uint64_t> rowMisses;
+    ControllerVector<Bank, uint64_t> rowConflicts;
+    std::array<uint64_t, Command::END_ENUM> numberOfCommands{};
+
+    // Scheduler occupancy and bank-level parallelism, integrated over time
+    ControllerVector<Bank, unsigned> pendingRequestsOnBank;
+    unsigned pendingRequests = 0;
+    unsigned maxPendingRequests = 0;
+    unsigned busyBanks = 0;
+    sc_core::sc_time lastOccupancyChange = sc_core::SC_ZERO_TIME;
+    sc_core::sc_time pendingRequestsTime = sc_core::SC_ZERO_TIME;
+    sc_core::sc_time busyBanksTime = sc_core::SC_ZERO_TIME;
+    sc_core::sc_time anyBankBusyTime = sc_core::SC_ZERO_TIME;
+
     class IdleTimeCollector
     {
     public:
@@ -46,7 +46,9 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerDDR3::CheckerDDR3(const MemSpecDDR3& memSpec) : memSpec(memSpec)
+CheckerDDR3::CheckerDDR3(const MemSpecDDR3& memSpec) :
+    memSpec(memSpec),
+    readyTimeCache(memSpec.banksPerChannel, memSpec.ranksPerChannel)
 {
     
     nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
@@ -71,11 +73,15 @@ sc_time CheckerDDR3::timeToSatisfyConstraints(Command command, const tlm_generic
     Rank rank = ControllerExtension::getRank(payload);
     
 
-    sc_time earliestTimeToStart = sc_time_stamp();
+    sc_time earliestTimeToStart;
+    if (!readyTimeCache.lookup(command, bank, rank, earliestTimeToStart))
+    {
+        earliestTimeToStart = nextCommandByBank[command][bank];
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+        readyTimeCache.store(command, bank, rank, earliestTimeToStart);
+    }
 
-    
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+    earliestTimeToStart = std::max(earliestTimeToStart, sc_time_stamp());
     earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnBus);
 
     return earliestTimeToStart;
@@ -1640,6 +1646,13 @@ void CheckerDDR3::insert(Command command, const tlm_generic_payload& payload)
     }
     
     }
+
+    // Column commands also constrain the other ranks of the channel
+    if (command.isCasCommand() && memSpec.ranksPerChannel > 1)
+        readyTimeCache.invalidateAll();
+    else
+        readyTimeCache.invalidateRank(rank);
+
     nextCommandOnBus = std::max(nextCommandOnBus, currentTime + memSpec.getCommandLength(command));
 }
 
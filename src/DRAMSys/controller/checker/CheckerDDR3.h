@@ -38,6 +38,7 @@
 #define CHECKERDDR3_H
 
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/ReadyTimeCache.h"
 #include "DRAMSys/configuration/memspec/MemSpecDDR3.h"
 
 #include <queue>
@@ -77,6 +78,7 @@ private:
     CommandArray<RankVector<sc_core::sc_time>> nextCommandByRank;
     
     RankVector<std::queue<sc_core::sc_time>> last4ActivatesOnRank;
+    ReadyTimeCache readyTimeCache;
     sc_core::sc_time nextCommandOnBus = sc_core::SC_ZERO_TIME;
 };
 
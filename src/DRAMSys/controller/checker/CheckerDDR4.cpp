@@ -46,7 +46,9 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerDDR4::CheckerDDR4(const MemSpecDDR4& memSpec) : memSpec(memSpec)
+CheckerDDR4::CheckerDDR4(const MemSpecDDR4& memSpec) :
+    memSpec(memSpec),
+    readyTimeCache(memSpec.banksPerChannel, memSpec.ranksPerChannel)
 {
     
     nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
@@ -76,12 +78,16 @@ sc_time CheckerDDR4::timeToSatisfyConstraints(Command command, const tlm_generic
     Rank rank = ControllerExtension::getRank(payload);
     
 
-    sc_time earliestTimeToStart = sc_time_stamp();
+    sc_time earliestTimeToStart;
+    if (!readyTimeCache.lookup(command, bank, rank, earliestTimeToStart))
+    {
+        earliestTimeToStart = nextCommandByBank[command][bank];
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[command][bankGroup]);
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+        readyTimeCache.store(command, bank, rank, earliestTimeToStart);
+    }
 
-    
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[command][bankGroup]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+    earliestTimeToStart = std::max(earliestTimeToStart, sc_time_stamp());
     earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnBus);
 
     return earliestTimeToStart;
@@ -1906,6 +1912,13 @@ void CheckerDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     
     }
+
+    // Column commands also constrain the other ranks of the channel
+    if (command.isCasCommand() && memSpec.ranksPerChannel > 1)
+        readyTimeCache.invalidateAll();
+    else
+        readyTimeCache.invalidateRank(rank);
+
     nextCommandOnBus = std::max(nextCommandOnBus, currentTime + memSpec.getCommandLength(command));
 }
 
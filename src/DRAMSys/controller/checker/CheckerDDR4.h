@@ -38,6 +38,7 @@
 #define CHECKERDDR4_H
 
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/ReadyTimeCache.h"
 #include "DRAMSys/configuration/memspec/MemSpecDDR4.h"
 
 #include <queue>
@@ -83,6 +84,7 @@ private:
     CommandArray<RankVector<sc_core::sc_time>> nextCommandByRank;
     
     RankVector<std::queue<sc_core::sc_time>> last4ActivatesOnRank;
+    ReadyTimeCache readyTimeCache;
     sc_core::sc_time nextCommandOnBus = sc_core::SC_ZERO_TIME;
 };
 
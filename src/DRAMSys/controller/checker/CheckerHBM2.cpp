@@ -46,7 +46,9 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerHBM2::CheckerHBM2(const MemSpecHBM2& memSpec) : memSpec(memSpec)
+CheckerHBM2::CheckerHBM2(const MemSpecHBM2& memSpec) :
+    memSpec(memSpec),
+    readyTimeCache(memSpec.banksPerChannel, memSpec.ranksPerChannel)
 {
     
     nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
@@ -75,13 +77,17 @@ sc_time CheckerHBM2::timeToSatisfyConstraints(Command command, const tlm_generic
     Stack stack = ControllerExtension::getStack(payload);
     
 
-    sc_time earliestTimeToStart = sc_time_stamp();
+    sc_time earliestTimeToStart;
+    if (!readyTimeCache.lookup(command, bank, rank, earliestTimeToStart))
+    {
+        earliestTimeToStart = nextCommandByBank[command][bank];
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[command][bankGroup]);
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByStack[command][stack]);
+        readyTimeCache.store(command, bank, rank, earliestTimeToStart);
+    }
 
-    
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[command][bankGroup]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByStack[command][stack]);
+    earliestTimeToStart = std::max(earliestTimeToStart, sc_time_stamp());
     if (command.isRasCommand())
     {
         earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnRasBus);
@@ -1385,6 +1391,13 @@ void CheckerHBM2::insert(Command command, const tlm_generic_payload& payload)
     }
     
     }
+
+    // Column commands also constrain the other stacks of the channel
+    if (command.isCasCommand() && memSpec.stacksPerChannel > 1)
+        readyTimeCache.invalidateAll();
+    else
+        readyTimeCache.invalidateRank(rank);
+
     if (command.isRasCommand())
     {
         nextCommandOnRasBus = std::max(nextCommandOnRasBus, currentTime + memSpec.getCommandLength(command));
@@ -38,6 +38,7 @@
 #define CHECKERHBM2_H
 
 #include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/ReadyTimeCache.h"
 #include "DRAMSys/configuration/memspec/MemSpecHBM2.h"
 
 #include <queue>
@@ -81,6 +82,7 @@ private:
     CommandArray<StackVector<sc_core::sc_time>> nextCommandByStack;
     
     RankVector<std::queue<sc_core::sc_time>> last4ActivatesOnRank;
+    ReadyTimeCache readyTimeCache;
     ControllerVector<Rank, unsigned> bankwiseRefreshCounter;
     sc_core::sc_time nextCommandOnRasBus = sc_core::SC_ZERO_TIME;
     sc_core::sc_time nextCommandOnCasBus = sc_core::SC_ZERO_TIME;
@@ -46,7 +46,9 @@ using namespace tlm;
 namespace DRAMSys
 {
 
-CheckerLPDDR4::CheckerLPDDR4(const MemSpecLPDDR4& memSpec) : memSpec(memSpec)
+CheckerLPDDR4::CheckerLPDDR4(const MemSpecLPDDR4& memSpec) :
+    memSpec(memSpec),
+    readyTimeCache(memSpec.banksPerChannel, memSpec.ranksPerChannel)
 {
     
     nextCommandByBank.fill({BankVector<sc_time>(memSpec.banksPerChannel, SC_ZERO_TIME)});
@@ -77,11 +79,15 @@ sc_time CheckerLPDDR4::timeToSatisfyConstraints(Command command, const tlm_gener
     Rank rank = ControllerExtension::getRank(payload);
     
 
-    sc_time earliestTimeToStart = sc_time_stamp();
+    sc_time earliestTimeToStart;
+    if (!readyTimeCache.lookup(command, bank, rank, earliestTimeToStart))
+    {
+        earliestTimeToStart = nextCommandByBank[command][bank];
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+        readyTimeCache.store(command, bank, rank, earliestTimeToStart);
+    }
 
-    
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[command][bank]);
-    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[command][rank]);
+    earliestTimeToStart = std::max(earliestTimeToStart, sc_time_stamp());
     earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnBus);
 
     return earliestTimeToStart;
@@ -1931,6 +1937,13 @@ void CheckerLPDDR4::insert(Command command, const tlm_generic_payload& payload)
     }
     
     }
+
+    // Column commands also constrain the other ranks of the channel
+    if (command.isCasCommand() && memSpec.ranksPerChannel > 1)
+        readyTimeCache.invalidateAll();
+    else
+        readyTimeCache.invalidateRank(rank);
+
     nextCommandOnBus = std::max(nextCommandOnBus, currentTime + memSpec.getCommandLength(command));
 }
 
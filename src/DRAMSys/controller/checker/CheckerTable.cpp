@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "CheckerTable.h"
+#include "DRAMSys/common/DebugManager.h"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace sc_core;
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+CheckerTable::CheckerTable(const MemSpec& memSpec, const TimingTable& timingTable) :
+    memSpec(memSpec),
+    nextCommandByBank(memSpec.banksPerChannel * rowLength, 0),
+    nextCommandByBankGroup(memSpec.bankGroupsPerChannel * rowLength, 0),
+    nextCommandByRank(memSpec.ranksPerChannel * rowLength, 0),
+    nextCommandByStack(memSpec.stacksPerChannel * rowLength, 0),
+    tFAW(timingTable.tFAW.value()),
+    fourActivateWindowTargets(timingTable.fourActivateWindowTargets),
+    fourActivateWindows(memSpec.ranksPerChannel),
+    bankwiseRefreshCounter(memSpec.ranksPerChannel, 0),
+    separateRasAndCasBus(timingTable.separateRasAndCasBus)
+{
+    for (const auto& constraint : timingTable.constraints)
+    {
+        auto& rows = rowsBySource[constraint.source];
+        auto it = std::find_if(rows.begin(),
+                               rows.end(),
+                               [&constraint](const ConstraintRow& row) {
+                                   return row.scope == constraint.scope &&
+                                          row.condition == constraint.condition;
+                               });
+
+        if (it == rows.end())
+        {
+            rows.push_back({constraint.scope, constraint.condition, {}});
+            it = std::prev(rows.end());
+        }
+
+        // Multiple constraints between the same pair of commands collapse into the strictest one
+        uint64_t& delay = it->delay[constraint.target];
+        delay = std::max(delay, static_cast<uint64_t>(constraint.delay.value()));
+
+        if (constraint.scope == ConstraintScope::BankGroup)
+            usesBankGroups = true;
+        else if (constraint.scope == ConstraintScope::Stack ||
+                 constraint.scope == ConstraintScope::OtherStacks)
+            usesStacks = true;
+    }
+
+    for (Command source : timingTable.fourActivateWindowSources)
+        isFourActivateWindowSource[source] = true;
+}
+
+sc_time CheckerTable::timeToSatisfyConstraints(Command command, const tlm_generic_payload& payload) const
+{
+    const std::size_t bank = static_cast<std::size_t>(ControllerExtension::getBank(payload));
+    const std::size_t rank = static_cast<std::size_t>(ControllerExtension::getRank(payload));
+
+    uint64_t earliestTimeToStart = sc_time_stamp().value();
+
+    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBank[bank * rowLength + command]);
+    earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByRank[rank * rowLength + command]);
+
+    if (usesBankGroups)
+    {
+        const auto bankGroup = static_cast<std::size_t>(ControllerExtension::getBankGroup(payload));
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByBankGroup[bankGroup * rowLength + command]);
+    }
+
+    if (usesStacks)
+    {
+        const auto stack = static_cast<std::size_t>(ControllerExtension::getStack(payload));
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandByStack[stack * rowLength + command]);
+    }
+
+    if (!separateRasAndCasBus || command.isRasCommand())
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnBus);
+
+    if (separateRasAndCasBus && command.isCasCommand())
+        earliestTimeToStart = std::max(earliestTimeToStart, nextCommandOnCasBus);
+
+    return sc_time::from_value(earliestTimeToStart);
+}
+
+void CheckerTable::insert(Command command, const tlm_generic_payload& payload)
+{
+    const Rank rank = ControllerExtension::getRank(payload);
+
+    PRINTDEBUGMESSAGE("CheckerTable", "Changing state on bank " +
+                      std::to_string(static_cast<std::size_t>(ControllerExtension::getBank(payload)))
+                      + " command is " + command.toString());
+
+    const uint64_t currentTime = sc_time_stamp().value();
+    const uint64_t commandLength = memSpec.getCommandLength(command).value();
+
+    if (command == Command::REFPB || command == Command::RFMPB)
+    {
+        bankwiseRefreshCounter[rank] = (bankwiseRefreshCounter[rank] + 1) % memSpec.banksPerRank;
+    }
+
+    for (const auto& row : rowsBySource[command])
+    {
+        if (!conditionHolds(row.condition, payload, rank))
+            continue;
+
+        switch (row.scope)
+        {
+        case ConstraintScope::Bank:
+        {
+            const auto bank = static_cast<std::size_t>(ControllerExtension::getBank(payload));
+            applyRow(&nextCommandByBank[bank * rowLength], row.delay, currentTime);
+            break;
+        }
+        case ConstraintScope::BankGroup:
+        {
+            const auto bankGroup = static_cast<std::size_t>(ControllerExtension::getBankGroup(payload));
+            applyRow(&nextCommandByBankGroup[bankGroup * rowLength], row.delay, currentTime);
+            break;
+        }
+        case ConstraintScope::Rank:
+        {
+            applyRow(&nextCommandByRank[static_cast<std::size_t>(rank) * rowLength], row.delay, currentTime);
+            break;
+        }
+        case ConstraintScope::Stack:
+        {
+            const auto stack = static_cast<std::size_t>(ControllerExtension::getStack(payload));
+            applyRow(&nextCommandByStack[stack * rowLength], row.delay, currentTime);
+            break;
+        }
+        case ConstraintScope::OtherRanks:
+        {
+            for (std::size_t otherRank = 0; otherRank < memSpec.ranksPerChannel; otherRank++)
+            {
+                if (otherRank != static_cast<std::size_t>(rank))
+                    applyRow(&nextCommandByRank[otherRank * rowLength], row.delay, currentTime);
+            }
+            break;
+        }
+        case ConstraintScope::OtherStacks:
+        {
+            const auto stack = static_cast<std::size_t>(ControllerExtension::getStack(payload));
+            for (std::size_t otherStack = 0; otherStack < memSpec.stacksPerChannel; otherStack++)
+            {
+                if (otherStack != stack)
+                    applyRow(&nextCommandByStack[otherStack * rowLength], row.delay, currentTime);
+            }
+            break;
+        }
+        }
+    }
+
+    if (isFourActivateWindowSource[command])
+    {
+        // Ring buffer with the same semantics as a queue that is popped once it holds four entries
+        ActivateWindow& window = fourActivateWindows[rank];
+        window.times[(window.head + window.size) % window.times.size()] = currentTime + commandLength;
+        window.size++;
+
+        if (window.size == window.times.size())
+        {
+            const uint64_t constraint = window.times[window.head] - commandLength + tFAW;
+            for (Command target : fourActivateWindowTargets)
+            {
+                uint64_t& earliestTimeToStart = nextCommandByRank[static_cast<std::size_t>(rank) * rowLength + target];
+                earliestTimeToStart = std::max(earliestTimeToStart, constraint);
+            }
+
+            window.head = (window.head + 1) % window.times.size();
+            window.size--;
+        }
+    }
+
+    if (!separateRasAndCasBus || command.isRasCommand())
+        nextCommandOnBus = std::max(nextCommandOnBus, currentTime + commandLength);
+
+    if (separateRasAndCasBus && command.isCasCommand())
+        nextCommandOnCasBus = std::max(nextCommandOnCasBus, currentTime + commandLength);
+}
+
+void CheckerTable::applyRow(uint64_t* state, const Row& delay, uint64_t currentTime)
+{
+    // Targets without a constraint have a delay of zero, which can never delay a later command
+    for (std::size_t i = 0; i < rowLength; i++)
+        state[i] = std::max(state[i], currentTime + delay[i]);
+}
+
+bool CheckerTable::conditionHolds(ConstraintCondition condition,
+                                  const tlm_generic_payload& payload,
+                                  Rank rank) const
+{
+    switch (condition)
+    {
+    case ConstraintCondition::None:
+        return true;
+    case ConstraintCondition::BurstLength32:
+        return ControllerExtension::getBurstLength(payload) == 32;
+    case ConstraintCondition::NotBurstLength32:
+        return ControllerExtension::getBurstLength(payload) != 32;
+    case ConstraintCondition::RefreshCounterZero:
+        return bankwiseRefreshCounter[rank] == 0;
+    case ConstraintCondition::RefreshCounterNotZero:
+        return bankwiseRefreshCounter[rank] != 0;
+    }
+
+    return true;
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef CHECKERTABLE_H
+#define CHECKERTABLE_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/configuration/memspec/MemSpec.h"
+#include "DRAMSys/controller/checker/CheckerIF.h"
+#include "DRAMSys/controller/checker/TimingTable.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * Table-driven timing checker. The constraints of a standard are grouped into rows of delays
+ * indexed by the target command, so that inserting a command updates all target commands of
+ * a component with a single loop. The earliest start times are stored as raw time values in
+ * one contiguous array per component level.
+ */
+class CheckerTable final : public CheckerIF
+{
+public:
+    CheckerTable(const MemSpec& memSpec, const TimingTable& timingTable);
+    [[nodiscard]] sc_core::sc_time timeToSatisfyConstraints(Command command, const tlm::tlm_generic_payload& payload) const override;
+    void insert(Command command, const tlm::tlm_generic_payload& payload) override;
+
+private:
+    // Row length padded to a multiple of four to allow for vectorized updates
+    static constexpr std::size_t rowLength = (Command::END_ENUM + 3) & ~std::size_t(3);
+    using Row = std::array<uint64_t, rowLength>;
+
+    struct ConstraintRow
+    {
+        ConstraintScope scope;
+        ConstraintCondition condition;
+        Row delay{};
+    };
+
+    struct ActivateWindow
+    {
+        std::array<uint64_t, 4> times{};
+        unsigned head = 0;
+        unsigned size = 0;
+    };
+
+    static void applyRow(uint64_t* state, const Row& delay, uint64_t currentTime);
+    [[nodiscard]] bool conditionHolds(ConstraintCondition condition,
+                                      const tlm::tlm_generic_payload& payload,
+                                      Rank rank) const;
+
+    const MemSpec& memSpec;
+
+    std::array<std::vector<ConstraintRow>, Command::END_ENUM> rowsBySource;
+
+    std::vector<uint64_t> nextCommandByBank;
+    std::vector<uint64_t> nextCommandByBankGroup;
+    std::vector<uint64_t> nextCommandByRank;
+    std::vector<uint64_t> nextCommandByStack;
+
+    bool usesBankGroups = false;
+    bool usesStacks = false;
+
+    uint64_t tFAW;
+    std::array<bool, Command::END_ENUM> isFourActivateWindowSource{};
+    std::vector<Command> fourActivateWindowTargets;
+    ControllerVector<Rank, ActivateWindow> fourActivateWindows;
+
+    ControllerVector<Rank, unsigned> bankwiseRefreshCounter;
+
+    bool separateRasAndCasBus;
+    // Without separate buses all commands are issued on nextCommandOnBus
+    uint64_t nextCommandOnBus = 0;
+    uint64_t nextCommandOnCasBus = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // CHECKERTABLE_H
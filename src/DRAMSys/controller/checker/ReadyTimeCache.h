@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef READYTIMECACHE_H
+#define READYTIMECACHE_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/Command.h"
+
+#include <array>
+#include <cstdint>
+
+#include <systemc>
+
+namespace DRAMSys
+{
+
+/**
+ * Caches the combined bank, bank group, rank and stack constraints of a checker per
+ * (command, bank). The bus constraints change with every inserted command and are therefore
+ * not part of the cache but have to be combined by the checker at query time.
+ *
+ * Every entry is tagged with the epoch of its rank. Invalidating a rank increments its epoch,
+ * which implicitly invalidates all entries of the banks in that rank.
+ */
+class ReadyTimeCache
+{
+public:
+    ReadyTimeCache(unsigned banksPerChannel, unsigned ranksPerChannel) :
+        rankEpoch(ranksPerChannel, 1)
+    {
+        entries.fill(BankVector<Entry>(banksPerChannel));
+    }
+
+    [[nodiscard]] bool lookup(Command command, Bank bank, Rank rank, sc_core::sc_time& time) const
+    {
+        const Entry& entry = entries[command][bank];
+        if (entry.epoch != rankEpoch[rank])
+            return false;
+
+        time = entry.time;
+        return true;
+    }
+
+    void store(Command command, Bank bank, Rank rank, const sc_core::sc_time& time) const
+    {
+        Entry& entry = entries[command][bank];
+        entry.time = time;
+        entry.epoch = rankEpoch[rank];
+    }
+
+    void invalidateRank(Rank rank) { rankEpoch[rank]++; }
+
+    void invalidateAll()
+    {
+        for (auto& epoch : rankEpoch)
+            epoch++;
+    }
+
+private:
+    struct Entry
+    {
+        sc_core::sc_time time = sc_core::SC_ZERO_TIME;
+        uint64_t epoch = 0;
+    };
+
+    template <typename T> using BankVector = ControllerVector<Bank, T>;
+
+    // Entries are filled lazily from const query methods of the checkers.
+    mutable std::array<BankVector<Entry>, Command::END_ENUM> entries;
+    ControllerVector<Rank, uint64_t> rankEpoch;
+};
+
+} // namespace DRAMSys
+
+#endif // READYTIMECACHE_H
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef TIMINGTABLE_H
+#define TIMINGTABLE_H
+
+#include "DRAMSys/controller/Command.h"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <systemc>
+
+namespace DRAMSys
+{
+
+class MemSpecDDR3;
+class MemSpecDDR4;
+class MemSpecLPDDR4;
+class MemSpecHBM2;
+
+enum class ConstraintScope
+{
+    Bank,
+    BankGroup,
+    Rank,
+    Stack,
+    OtherRanks,
+    OtherStacks
+};
+
+enum class ConstraintCondition
+{
+    None,
+    BurstLength32,
+    NotBurstLength32,
+    RefreshCounterZero,
+    RefreshCounterNotZero
+};
+
+/**
+ * A minimum distance between an issued source command and a following target command within
+ * the given scope relative to the component the source command was issued to.
+ */
+struct TimingConstraint
+{
+    Command source;
+    Command target;
+    ConstraintScope scope;
+    sc_core::sc_time delay;
+    ConstraintCondition condition = ConstraintCondition::None;
+};
+
+/**
+ * Complete description of the timing constraints of a standard, interpreted by CheckerTable.
+ */
+struct TimingTable
+{
+    std::vector<TimingConstraint> constraints;
+
+    // Four activate window on rank level
+    sc_core::sc_time tFAW = sc_core::SC_ZERO_TIME;
+    std::vector<Command> fourActivateWindowSources;
+    std::vector<Command> fourActivateWindowTargets;
+
+    bool separateRasAndCasBus = false;
+};
+
+TimingTable createTimingTable(const MemSpecDDR3& memSpec);
+TimingTable createTimingTable(const MemSpecDDR4& memSpec);
+TimingTable createTimingTable(const MemSpecLPDDR4& memSpec);
+TimingTable createTimingTable(const MemSpecHBM2& memSpec);
+
+template <typename T, typename = void>
+struct has_TimingTable : std::false_type
+{
+};
+template <typename T>
+struct has_TimingTable<T, std::void_t<decltype(createTimingTable(std::declval<const T&>()))>>
+    : std::true_type
+{
+};
+template <typename T>
+inline constexpr bool has_TimingTable_v = has_TimingTable<T>::value;
+
+} // namespace DRAMSys
+
+#endif // TIMINGTABLE_H
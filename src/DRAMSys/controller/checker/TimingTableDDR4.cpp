@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "DRAMSys/configuration/memspec/MemSpecDDR4.h"
+#include "DRAMSys/controller/checker/TimingTable.h"
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+TimingTable createTimingTable(const MemSpecDDR4& memSpec)
+{
+    const sc_time tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * memSpec.tCK);
+    const sc_time tRDWR = ((((memSpec.tRL + tBURST) + memSpec.tCK) - memSpec.tWL) + memSpec.tWPRE);
+    const sc_time tRDWR_R = ((((memSpec.tRL + tBURST) + memSpec.tRTRS) - memSpec.tWL) + memSpec.tWPRE);
+    const sc_time tWRRD_S = (((memSpec.tWL + tBURST) + memSpec.tWTR_S) - memSpec.tAL);
+    const sc_time tWRRD_L = (((memSpec.tWL + tBURST) + memSpec.tWTR_L) - memSpec.tAL);
+    const sc_time tWRRD_R = ((((memSpec.tWL + tBURST) + memSpec.tRTRS) - memSpec.tRL) + memSpec.tRPRE);
+    const sc_time tRDAACT = ((memSpec.tAL + memSpec.tRTP) + memSpec.tRP);
+    const sc_time tWRPRE = ((memSpec.tWL + tBURST) + memSpec.tWR);
+    const sc_time tWRAACT = (tWRPRE + memSpec.tRP);
+    const sc_time tRDPDEN = ((memSpec.tRL + tBURST) + memSpec.tCK);
+    const sc_time tWRPDEN = ((memSpec.tWL + tBURST) + memSpec.tWR);
+    const sc_time tWRAPDEN = (((memSpec.tWL + tBURST) + memSpec.tWR) + memSpec.tCK);
+
+    TimingTable table;
+
+    table.constraints = {
+        {Command::RD, Command::PREPB, ConstraintScope::Bank, (memSpec.tAL + memSpec.tRTP)},
+        {Command::RD, Command::RD, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::RD, Command::RDA, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::RD, Command::WR, ConstraintScope::Bank, tRDWR},
+        {Command::RD, Command::MWR, ConstraintScope::Bank, tRDWR},
+        {Command::RD, Command::WRA, ConstraintScope::Bank, tRDWR},
+        {Command::RD, Command::MWRA, ConstraintScope::Bank, tRDWR},
+        {Command::RD, Command::RD, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::RD, Command::RDA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::RD, Command::WR, ConstraintScope::BankGroup, tRDWR},
+        {Command::RD, Command::MWR, ConstraintScope::BankGroup, tRDWR},
+        {Command::RD, Command::WRA, ConstraintScope::BankGroup, tRDWR},
+        {Command::RD, Command::MWRA, ConstraintScope::BankGroup, tRDWR},
+        {Command::RD, Command::PREAB, ConstraintScope::Rank, (memSpec.tAL + memSpec.tRTP)},
+        {Command::RD, Command::PDEA, ConstraintScope::Rank, tRDPDEN},
+        {Command::RD, Command::PDEP, ConstraintScope::Rank, tRDPDEN},
+        {Command::RD, Command::RD, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::RD, Command::RDA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::RD, Command::WR, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::MWR, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::WRA, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::MWRA, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::RD, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RD, Command::RDA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RD, Command::WR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RD, Command::MWR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RD, Command::WRA, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RD, Command::MWRA, ConstraintScope::OtherRanks, tRDWR_R},
+
+        {Command::WR, Command::PREPB, ConstraintScope::Bank, tWRPRE},
+        {Command::WR, Command::WR, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::WR, Command::MWR, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::WR, Command::WRA, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::WR, Command::MWRA, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::WR, Command::RD, ConstraintScope::Bank, tWRRD_L},
+        {Command::WR, Command::RDA, ConstraintScope::Bank, std::max(tWRRD_L, ((tWRPRE - memSpec.tRTP) - memSpec.tAL))},
+        {Command::WR, Command::WR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WR, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WR, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WR, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WR, Command::RD, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::WR, Command::RDA, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::WR, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::WR, Command::PDEA, ConstraintScope::Rank, tWRPDEN},
+        {Command::WR, Command::WR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WR, Command::MWR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WR, Command::WRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WR, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WR, Command::RD, ConstraintScope::Rank, tWRRD_S},
+        {Command::WR, Command::RDA, ConstraintScope::Rank, tWRRD_S},
+        {Command::WR, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::WR, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::MWR, Command::PREPB, ConstraintScope::Bank, tWRPRE},
+        {Command::MWR, Command::WR, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::MWR, Command::MWR, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::MWR, Command::WRA, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::MWR, Command::MWRA, ConstraintScope::Bank, memSpec.tCCD_L},
+        {Command::MWR, Command::RD, ConstraintScope::Bank, tWRRD_L},
+        {Command::MWR, Command::RDA, ConstraintScope::Bank, std::max(tWRRD_L, ((tWRPRE - memSpec.tRTP) - memSpec.tAL))},
+        {Command::MWR, Command::WR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWR, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWR, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWR, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWR, Command::RD, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::MWR, Command::RDA, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::MWR, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::MWR, Command::PDEA, ConstraintScope::Rank, tWRPDEN},
+        {Command::MWR, Command::WR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWR, Command::MWR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWR, Command::WRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWR, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWR, Command::RD, ConstraintScope::Rank, tWRRD_S},
+        {Command::MWR, Command::RDA, ConstraintScope::Rank, tWRRD_S},
+        {Command::MWR, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::MWR, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::RDA, Command::ACT, ConstraintScope::Bank, tRDAACT},
+        {Command::RDA, Command::RD, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::RDA, Command::RDA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::RDA, Command::WR, ConstraintScope::BankGroup, tRDWR},
+        {Command::RDA, Command::MWR, ConstraintScope::BankGroup, tRDWR},
+        {Command::RDA, Command::WRA, ConstraintScope::BankGroup, tRDWR},
+        {Command::RDA, Command::MWRA, ConstraintScope::BankGroup, tRDWR},
+        {Command::RDA, Command::PDEA, ConstraintScope::Rank, tRDPDEN},
+        {Command::RDA, Command::PDEP, ConstraintScope::Rank, tRDPDEN},
+        {Command::RDA, Command::RD, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::RDA, Command::RDA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::RDA, Command::WR, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::MWR, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::WRA, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::MWRA, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::PREAB, ConstraintScope::Rank, (memSpec.tAL + memSpec.tRTP)},
+        {Command::RDA, Command::REFAB, ConstraintScope::Rank, tRDAACT},
+        {Command::RDA, Command::SREFEN, ConstraintScope::Rank, std::max(tRDPDEN, ((memSpec.tAL + memSpec.tRTP) + memSpec.tRP))},
+        {Command::RDA, Command::WR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::MWR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::WRA, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::MWRA, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::RD, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RDA, Command::RDA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+
+        {Command::WRA, Command::ACT, ConstraintScope::Bank, tWRAACT},
+        {Command::WRA, Command::WR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WRA, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WRA, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WRA, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::WRA, Command::RD, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::WRA, Command::RDA, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::WRA, Command::PDEA, ConstraintScope::Rank, tWRAPDEN},
+        {Command::WRA, Command::PDEP, ConstraintScope::Rank, tWRAPDEN},
+        {Command::WRA, Command::WR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WRA, Command::MWR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WRA, Command::WRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WRA, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::WRA, Command::RD, ConstraintScope::Rank, tWRRD_S},
+        {Command::WRA, Command::RDA, ConstraintScope::Rank, tWRRD_S},
+        {Command::WRA, Command::REFAB, ConstraintScope::Rank, (tWRPRE + memSpec.tRP)},
+        {Command::WRA, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::WRA, Command::SREFEN, ConstraintScope::Rank, std::max(tWRAPDEN, (tWRPRE + memSpec.tRP))},
+        {Command::WRA, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::WRA, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::MWRA, Command::WR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWRA, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWRA, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWRA, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCD_L},
+        {Command::MWRA, Command::RD, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::MWRA, Command::RDA, ConstraintScope::BankGroup, tWRRD_L},
+        {Command::MWRA, Command::PDEA, ConstraintScope::Rank, tWRAPDEN},
+        {Command::MWRA, Command::PDEP, ConstraintScope::Rank, tWRAPDEN},
+        {Command::MWRA, Command::WR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWRA, Command::MWR, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWRA, Command::WRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWRA, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD_S},
+        {Command::MWRA, Command::RD, ConstraintScope::Rank, tWRRD_S},
+        {Command::MWRA, Command::RDA, ConstraintScope::Rank, tWRRD_S},
+        {Command::MWRA, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::MWRA, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::ACT, Command::PREPB, ConstraintScope::Bank, memSpec.tRAS},
+        {Command::ACT, Command::PREAB, ConstraintScope::Rank, memSpec.tRAS},
+        {Command::ACT, Command::RD, ConstraintScope::Bank, (memSpec.tRCD - memSpec.tAL)},
+        {Command::ACT, Command::WR, ConstraintScope::Bank, (memSpec.tRCD - memSpec.tAL)},
+        {Command::ACT, Command::MWR, ConstraintScope::Bank, (memSpec.tRCD - memSpec.tAL)},
+        {Command::ACT, Command::RDA, ConstraintScope::Bank, (memSpec.tRCD - memSpec.tAL)},
+        {Command::ACT, Command::WRA, ConstraintScope::Bank, (memSpec.tRCD - memSpec.tAL)},
+        {Command::ACT, Command::MWRA, ConstraintScope::Bank, (memSpec.tRCD - memSpec.tAL)},
+        {Command::ACT, Command::ACT, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::ACT, ConstraintScope::Rank, memSpec.tRRD_S},
+        {Command::ACT, Command::ACT, ConstraintScope::BankGroup, memSpec.tRRD_L},
+        {Command::ACT, Command::PDEA, ConstraintScope::Rank, memSpec.tACTPDEN},
+        {Command::ACT, Command::REFAB, ConstraintScope::Rank, memSpec.tRC},
+        {Command::ACT, Command::SREFEN, ConstraintScope::Rank, memSpec.tRC},
+
+        {Command::PREPB, Command::ACT, ConstraintScope::Bank, memSpec.tRP},
+        {Command::PREPB, Command::REFAB, ConstraintScope::Rank, memSpec.tRP},
+        {Command::PREPB, Command::PDEA, ConstraintScope::Rank, memSpec.tPRPDEN},
+        {Command::PREPB, Command::PDEP, ConstraintScope::Rank, memSpec.tPRPDEN},
+        {Command::PREPB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRP},
+
+        {Command::PREAB, Command::ACT, ConstraintScope::Rank, memSpec.tRP},
+        {Command::PREAB, Command::REFAB, ConstraintScope::Rank, memSpec.tRP},
+        {Command::PREAB, Command::PDEP, ConstraintScope::Rank, memSpec.tPRPDEN},
+        {Command::PREAB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRP},
+
+        {Command::REFAB, Command::ACT, ConstraintScope::Rank, memSpec.tRFC},
+        {Command::REFAB, Command::REFAB, ConstraintScope::Rank, memSpec.tRFC},
+        {Command::REFAB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRFC},
+        {Command::REFAB, Command::PDEP, ConstraintScope::Rank, memSpec.tREFPDEN},
+
+        {Command::PDEA, Command::PDXA, ConstraintScope::Rank, memSpec.tPD},
+
+        {Command::PDEP, Command::PDXP, ConstraintScope::Rank, memSpec.tPD},
+
+        {Command::PDXA, Command::PDEA, ConstraintScope::Rank, memSpec.tCKE},
+        {Command::PDXA, Command::ACT, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::PREPB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::PREAB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::RD, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::RDA, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::WR, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::MWR, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::WRA, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::MWRA, ConstraintScope::Rank, memSpec.tXP},
+
+        {Command::PDXP, Command::PDEP, ConstraintScope::Rank, memSpec.tCKE},
+        {Command::PDXP, Command::REFAB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::SREFEN, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::ACT, ConstraintScope::Rank, memSpec.tXP},
+
+        {Command::SREFEX, Command::ACT, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::REFAB, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::PDEP, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::SREFEN, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::RD, ConstraintScope::Rank, memSpec.tXSDLL},
+        {Command::SREFEX, Command::RDA, ConstraintScope::Rank, memSpec.tXSDLL},
+        {Command::SREFEX, Command::WR, ConstraintScope::Rank, memSpec.tXSDLL},
+        {Command::SREFEX, Command::MWR, ConstraintScope::Rank, memSpec.tXSDLL},
+        {Command::SREFEX, Command::WRA, ConstraintScope::Rank, memSpec.tXSDLL},
+        {Command::SREFEX, Command::MWRA, ConstraintScope::Rank, memSpec.tXSDLL},
+        {Command::SREFEX, Command::SREFEX, ConstraintScope::Rank, memSpec.tCKESR},
+    };
+
+    table.tFAW = memSpec.tFAW;
+    table.fourActivateWindowSources = {Command::ACT};
+    table.fourActivateWindowTargets = {Command::ACT};
+
+    return table;
+}
+
+} // namespace DRAMSys
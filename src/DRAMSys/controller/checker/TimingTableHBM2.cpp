@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "DRAMSys/configuration/memspec/MemSpecHBM2.h"
+#include "DRAMSys/controller/checker/TimingTable.h"
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+TimingTable createTimingTable(const MemSpecHBM2& memSpec)
+{
+    const sc_time tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * memSpec.tCK);
+    const sc_time tRDPDE = (((memSpec.tRL + memSpec.tPL) + tBURST) + memSpec.tCK);
+    const sc_time tRDSRE = tRDPDE;
+    const sc_time tWRPRE = ((memSpec.tWL + tBURST) + memSpec.tWR);
+    const sc_time tWRPDE = ((((memSpec.tWL + memSpec.tPL) + tBURST) + memSpec.tCK) + memSpec.tWR);
+    const sc_time tWRAPDE = ((((memSpec.tWL + memSpec.tPL) + tBURST) + memSpec.tCK) + memSpec.tWR);
+    const sc_time tWRRDS = ((memSpec.tWL + tBURST) + memSpec.tWTRS);
+    const sc_time tWRRDL = ((memSpec.tWL + tBURST) + memSpec.tWTRL);
+
+    TimingTable table;
+
+    table.constraints = {
+        {Command::RD, Command::PREPB, ConstraintScope::Bank, memSpec.tRTP},
+        {Command::RD, Command::RD, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::RD, Command::RDA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::RD, Command::PREAB, ConstraintScope::Rank, memSpec.tRTP},
+        {Command::RD, Command::PDEA, ConstraintScope::Rank, tRDPDE},
+        {Command::RD, Command::PDEP, ConstraintScope::Rank, tRDPDE},
+        {Command::RD, Command::RD, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::RD, Command::RDA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::RD, Command::WR, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RD, Command::MWR, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RD, Command::WRA, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RD, Command::MWRA, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RD, Command::RD, ConstraintScope::OtherStacks, memSpec.tCCDR},
+        {Command::RD, Command::RDA, ConstraintScope::OtherStacks, memSpec.tCCDR},
+
+        {Command::WR, Command::PREPB, ConstraintScope::Bank, tWRPRE},
+        {Command::WR, Command::RDA, ConstraintScope::Bank, ((memSpec.tWL + tBURST) + std::max((memSpec.tWR - memSpec.tRTP), memSpec.tWTRL))},
+        {Command::WR, Command::WR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WR, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WR, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WR, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WR, Command::RD, ConstraintScope::BankGroup, tWRRDL},
+        {Command::WR, Command::RDA, ConstraintScope::BankGroup, tWRRDL},
+        {Command::WR, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::WR, Command::PDEA, ConstraintScope::Rank, tWRPDE},
+        {Command::WR, Command::WR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WR, Command::MWR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WR, Command::WRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WR, Command::MWRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WR, Command::RD, ConstraintScope::Rank, tWRRDS},
+        {Command::WR, Command::RDA, ConstraintScope::Rank, tWRRDS},
+
+        {Command::MWR, Command::PREPB, ConstraintScope::Bank, tWRPRE},
+        {Command::MWR, Command::RDA, ConstraintScope::Bank, ((memSpec.tWL + tBURST) + std::max((memSpec.tWR - memSpec.tRTP), memSpec.tWTRL))},
+        {Command::MWR, Command::WR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWR, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWR, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWR, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWR, Command::RD, ConstraintScope::BankGroup, tWRRDL},
+        {Command::MWR, Command::RDA, ConstraintScope::BankGroup, tWRRDL},
+        {Command::MWR, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::MWR, Command::PDEA, ConstraintScope::Rank, tWRPDE},
+        {Command::MWR, Command::WR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWR, Command::MWR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWR, Command::WRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWR, Command::MWRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWR, Command::RD, ConstraintScope::Rank, tWRRDS},
+        {Command::MWR, Command::RDA, ConstraintScope::Rank, tWRRDS},
+
+        {Command::RDA, Command::ACT, ConstraintScope::Bank, ((memSpec.tRTP + memSpec.tRP) - memSpec.tCK)},
+        {Command::RDA, Command::REFPB, ConstraintScope::Bank, (memSpec.tRTP + memSpec.tRP)},
+        {Command::RDA, Command::RD, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::RDA, Command::RDA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::RDA, Command::PDEA, ConstraintScope::Rank, tRDPDE},
+        {Command::RDA, Command::PDEP, ConstraintScope::Rank, tRDPDE},
+        {Command::RDA, Command::RD, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::RDA, Command::RDA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::RDA, Command::WR, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RDA, Command::MWR, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RDA, Command::WRA, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RDA, Command::MWRA, ConstraintScope::Rank, memSpec.tRTW},
+        {Command::RDA, Command::REFAB, ConstraintScope::Rank, (memSpec.tRTP + memSpec.tRP)},
+        {Command::RDA, Command::PREAB, ConstraintScope::Rank, memSpec.tRTP},
+        {Command::RDA, Command::SREFEN, ConstraintScope::Rank, std::max((memSpec.tRTP + memSpec.tRP), tRDSRE)},
+        {Command::RDA, Command::RD, ConstraintScope::OtherStacks, memSpec.tCCDR},
+        {Command::RDA, Command::RDA, ConstraintScope::OtherStacks, memSpec.tCCDR},
+
+        {Command::WRA, Command::ACT, ConstraintScope::Bank, ((tWRPRE + memSpec.tRP) - memSpec.tCK)},
+        {Command::WRA, Command::REFPB, ConstraintScope::Bank, (tWRPRE + memSpec.tRP)},
+        {Command::WRA, Command::WR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WRA, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WRA, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WRA, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::WRA, Command::RD, ConstraintScope::BankGroup, tWRRDL},
+        {Command::WRA, Command::RDA, ConstraintScope::BankGroup, tWRRDL},
+        {Command::WRA, Command::PDEA, ConstraintScope::Rank, tWRAPDE},
+        {Command::WRA, Command::PDEP, ConstraintScope::Rank, tWRAPDE},
+        {Command::WRA, Command::WR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WRA, Command::MWR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WRA, Command::WRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WRA, Command::MWRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::WRA, Command::RD, ConstraintScope::Rank, tWRRDS},
+        {Command::WRA, Command::RDA, ConstraintScope::Rank, tWRRDS},
+        {Command::WRA, Command::REFAB, ConstraintScope::Rank, (tWRPRE + memSpec.tRP)},
+        {Command::WRA, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::WRA, Command::SREFEN, ConstraintScope::Rank, (tWRPRE + memSpec.tRP)},
+
+        {Command::MWRA, Command::ACT, ConstraintScope::Bank, ((tWRPRE + memSpec.tRP) - memSpec.tCK)},
+        {Command::MWRA, Command::REFPB, ConstraintScope::Bank, (tWRPRE + memSpec.tRP)},
+        {Command::MWRA, Command::WR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWRA, Command::MWR, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWRA, Command::WRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWRA, Command::MWRA, ConstraintScope::BankGroup, memSpec.tCCDL},
+        {Command::MWRA, Command::RD, ConstraintScope::BankGroup, tWRRDL},
+        {Command::MWRA, Command::RDA, ConstraintScope::BankGroup, tWRRDL},
+        {Command::MWRA, Command::PDEA, ConstraintScope::Rank, tWRAPDE},
+        {Command::MWRA, Command::PDEP, ConstraintScope::Rank, tWRAPDE},
+        {Command::MWRA, Command::WR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWRA, Command::MWR, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWRA, Command::WRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWRA, Command::MWRA, ConstraintScope::Rank, memSpec.tCCDS},
+        {Command::MWRA, Command::RD, ConstraintScope::Rank, tWRRDS},
+        {Command::MWRA, Command::RDA, ConstraintScope::Rank, tWRRDS},
+        {Command::MWRA, Command::REFAB, ConstraintScope::Rank, (tWRPRE + memSpec.tRP)},
+        {Command::MWRA, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::MWRA, Command::SREFEN, ConstraintScope::Rank, (tWRPRE + memSpec.tRP)},
+
+        {Command::ACT, Command::PREPB, ConstraintScope::Bank, (memSpec.tRAS + memSpec.tCK)},
+        {Command::ACT, Command::RD, ConstraintScope::Bank, (memSpec.tRCDRD + memSpec.tCK)},
+        {Command::ACT, Command::RDA, ConstraintScope::Bank, (memSpec.tRCDRD + memSpec.tCK)},
+        {Command::ACT, Command::WR, ConstraintScope::Bank, (memSpec.tRCDWR + memSpec.tCK)},
+        {Command::ACT, Command::MWR, ConstraintScope::Bank, (memSpec.tRCDWR + memSpec.tCK)},
+        {Command::ACT, Command::WRA, ConstraintScope::Bank, (memSpec.tRCDWR + memSpec.tCK)},
+        {Command::ACT, Command::MWRA, ConstraintScope::Bank, (memSpec.tRCDWR + memSpec.tCK)},
+        {Command::ACT, Command::ACT, ConstraintScope::Bank, memSpec.tRC},
+        {Command::ACT, Command::REFPB, ConstraintScope::Bank, (memSpec.tRC + memSpec.tCK)},
+        {Command::ACT, Command::ACT, ConstraintScope::BankGroup, memSpec.tRRDL},
+        {Command::ACT, Command::REFPB, ConstraintScope::BankGroup, (memSpec.tRRDL + memSpec.tCK)},
+        {Command::ACT, Command::ACT, ConstraintScope::Rank, memSpec.tRRDS},
+        {Command::ACT, Command::REFAB, ConstraintScope::Rank, (memSpec.tRC + memSpec.tCK)},
+        {Command::ACT, Command::SREFEN, ConstraintScope::Rank, (memSpec.tRC + memSpec.tCK)},
+        {Command::ACT, Command::PREAB, ConstraintScope::Rank, (memSpec.tRAS + memSpec.tCK)},
+        {Command::ACT, Command::REFPB, ConstraintScope::Rank, (memSpec.tRRDS + memSpec.tCK)},
+
+        {Command::PREPB, Command::ACT, ConstraintScope::Bank, (memSpec.tRP - memSpec.tCK)},
+        {Command::PREPB, Command::REFPB, ConstraintScope::Bank, memSpec.tRP},
+        {Command::PREPB, Command::REFAB, ConstraintScope::Rank, memSpec.tRP},
+        {Command::PREPB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRP},
+
+        {Command::REFPB, Command::ACT, ConstraintScope::Bank, (memSpec.tRFCSB - memSpec.tCK)},
+        {Command::REFPB, Command::REFPB, ConstraintScope::Bank, memSpec.tRFCSB},
+        {Command::REFPB, Command::REFPB, ConstraintScope::BankGroup, memSpec.tRREFD},
+        {Command::REFPB, Command::REFAB, ConstraintScope::BankGroup, memSpec.tRFCSB},
+        {Command::REFPB, Command::PREAB, ConstraintScope::BankGroup, memSpec.tRFCSB},
+        {Command::REFPB, Command::SREFEN, ConstraintScope::BankGroup, memSpec.tRFCSB},
+        {Command::REFPB, Command::ACT, ConstraintScope::Rank, (memSpec.tRREFD - memSpec.tCK)},
+        {Command::REFPB, Command::REFPB, ConstraintScope::Rank, memSpec.tRFCSB, ConstraintCondition::RefreshCounterZero},
+        {Command::REFPB, Command::REFPB, ConstraintScope::Rank, memSpec.tRREFD, ConstraintCondition::RefreshCounterNotZero},
+
+        {Command::PREAB, Command::ACT, ConstraintScope::Rank, (memSpec.tRP - memSpec.tCK)},
+        {Command::PREAB, Command::REFAB, ConstraintScope::Rank, memSpec.tRP},
+        {Command::PREAB, Command::REFPB, ConstraintScope::Rank, memSpec.tRP},
+        {Command::PREAB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRP},
+
+        {Command::REFAB, Command::ACT, ConstraintScope::Rank, (memSpec.tRFC - memSpec.tCK)},
+        {Command::REFAB, Command::REFAB, ConstraintScope::Rank, memSpec.tRFC},
+        {Command::REFAB, Command::REFPB, ConstraintScope::Rank, memSpec.tRFC},
+        {Command::REFAB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRFC},
+
+        {Command::PDEA, Command::PDXA, ConstraintScope::Rank, memSpec.tPD},
+
+        {Command::PDEP, Command::PDXP, ConstraintScope::Rank, memSpec.tPD},
+
+        {Command::PDXA, Command::PDEA, ConstraintScope::Rank, memSpec.tCKE},
+        {Command::PDXA, Command::REFPB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::PREPB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::PREAB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::RD, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::RDA, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::WR, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::WRA, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::ACT, ConstraintScope::Rank, (memSpec.tXP - memSpec.tCK)},
+
+        {Command::PDXP, Command::PDEP, ConstraintScope::Rank, memSpec.tCKE},
+        {Command::PDXP, Command::REFAB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::REFPB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::SREFEN, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::ACT, ConstraintScope::Rank, (memSpec.tXP - memSpec.tCK)},
+
+        {Command::SREFEX, Command::ACT, ConstraintScope::Rank, (memSpec.tXS - memSpec.tCK)},
+        {Command::SREFEX, Command::REFPB, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::REFAB, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::PDEP, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::SREFEN, ConstraintScope::Rank, memSpec.tXS},
+        {Command::SREFEX, Command::SREFEX, ConstraintScope::Rank, memSpec.tCKESR},
+    };
+
+    table.tFAW = memSpec.tFAW;
+    table.fourActivateWindowSources = {Command::ACT, Command::REFPB};
+    table.fourActivateWindowTargets = {Command::ACT, Command::REFPB};
+
+    table.separateRasAndCasBus = true;
+
+    return table;
+}
+
+} // namespace DRAMSys
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "DRAMSys/configuration/memspec/MemSpecLPDDR4.h"
+#include "DRAMSys/controller/checker/TimingTable.h"
+
+#include <cmath>
+
+using namespace sc_core;
+
+namespace DRAMSys
+{
+
+TimingTable createTimingTable(const MemSpecLPDDR4& memSpec)
+{
+    const sc_time tBURST = ((memSpec.defaultBurstLength / memSpec.dataRate) * memSpec.tCK);
+    const sc_time tRDWR = (((((memSpec.tRL + memSpec.tDQSCK) + tBURST) - memSpec.tWL) + memSpec.tWPRE) + memSpec.tRPST);
+    const sc_time tRDWR_R = (((memSpec.tRL + tBURST) + memSpec.tRTRS) - memSpec.tWL);
+    const sc_time tWRRD = (((memSpec.tWL + memSpec.tCK) + tBURST) + memSpec.tWTR);
+    const sc_time tWRRD_R = (((memSpec.tWL + tBURST) + memSpec.tRTRS) - memSpec.tRL);
+    const sc_time tRDPRE = ((memSpec.tRTP + tBURST) - (memSpec.tCK * 6));
+    const sc_time tRDAACT = (((memSpec.tRTP + memSpec.tRPpb) + tBURST) - (memSpec.tCK * 8));
+    const sc_time tWRPRE = (((((memSpec.tCK * 2) + memSpec.tWL) + memSpec.tCK) + tBURST) + memSpec.tWR);
+    const sc_time tWRAACT = ((((memSpec.tWL + tBURST) + memSpec.tWR) + memSpec.tCK) + memSpec.tRPpb);
+    const sc_time tACTPDEN = ((memSpec.tCK * 3) + memSpec.tCMDCKE);
+    const sc_time tPRPDEN = (memSpec.tCK + memSpec.tCMDCKE);
+    const sc_time tRDPDEN = (((((memSpec.tCK * 3) + memSpec.tRL) + memSpec.tDQSCK) + tBURST) + memSpec.tRPST);
+    const sc_time tWRPDEN = (((((memSpec.tCK * 3) + memSpec.tWL) + ((std::ceil((memSpec.tDQSS / memSpec.tCK)) + std::ceil((memSpec.tDQS2DQ / memSpec.tCK))) * memSpec.tCK)) + tBURST) + memSpec.tWR);
+    const sc_time tWRAPDEN = ((((((memSpec.tCK * 3) + memSpec.tWL) + ((std::ceil((memSpec.tDQSS / memSpec.tCK)) + std::ceil((memSpec.tDQS2DQ / memSpec.tCK))) * memSpec.tCK)) + tBURST) + memSpec.tWR) + (memSpec.tCK * 2));
+    const sc_time tREFPDEN = (memSpec.tCK + memSpec.tCMDCKE);
+
+    TimingTable table;
+
+    table.constraints = {
+        {Command::RD, Command::PREPB, ConstraintScope::Bank, (memSpec.tRRD + (memSpec.tCK * 2))},
+        {Command::RD, Command::PREAB, ConstraintScope::Rank, tRDPRE},
+        {Command::RD, Command::PDEA, ConstraintScope::Rank, tRDPDEN},
+        {Command::RD, Command::PDEP, ConstraintScope::Rank, tRDPDEN},
+        {Command::RD, Command::RD, ConstraintScope::Rank, memSpec.tCCD},
+        {Command::RD, Command::RDA, ConstraintScope::Rank, memSpec.tCCD},
+        {Command::RD, Command::WR, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::MWR, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::WRA, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::MWRA, ConstraintScope::Rank, tRDWR},
+        {Command::RD, Command::RD, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RD, Command::RDA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RD, Command::WR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RD, Command::MWR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RD, Command::WRA, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RD, Command::MWRA, ConstraintScope::OtherRanks, tRDWR_R},
+
+        {Command::WR, Command::PREPB, ConstraintScope::Bank, tWRPRE},
+        {Command::WR, Command::MWR, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::WR, Command::MWRA, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::WR, Command::MWR, ConstraintScope::Bank, (memSpec.tCCDMW + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WR, Command::MWRA, ConstraintScope::Bank, (memSpec.tCCDMW + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WR, Command::RDA, ConstraintScope::Bank, std::max(tWRRD, (tWRPRE - tRDPRE))},
+        {Command::WR, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::WR, Command::PDEA, ConstraintScope::Rank, tWRPDEN},
+        {Command::WR, Command::WR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WR, Command::MWR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WR, Command::WRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WR, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WR, Command::WR, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WR, Command::MWR, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WR, Command::WRA, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WR, Command::MWRA, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WR, Command::RD, ConstraintScope::Rank, tWRRD},
+        {Command::WR, Command::RDA, ConstraintScope::Rank, tWRRD},
+        {Command::WR, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WR, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::WR, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::MWR, Command::PREPB, ConstraintScope::Bank, tWRPRE},
+        {Command::MWR, Command::MWR, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::MWR, Command::MWRA, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::MWR, Command::RDA, ConstraintScope::Bank, std::max(tWRRD, (tWRPRE - tRDPRE))},
+        {Command::MWR, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::MWR, Command::PDEA, ConstraintScope::Rank, tWRPDEN},
+        {Command::MWR, Command::WR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWR, Command::MWR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWR, Command::WRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWR, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWR, Command::RD, ConstraintScope::Rank, tWRRD},
+        {Command::MWR, Command::RDA, ConstraintScope::Rank, tWRRD},
+        {Command::MWR, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWR, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::MWR, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::RDA, Command::ACT, ConstraintScope::Bank, tRDAACT},
+        {Command::RDA, Command::REFPB, ConstraintScope::Bank, (tRDPRE + memSpec.tRPpb)},
+        {Command::RDA, Command::PREAB, ConstraintScope::Rank, tRDPRE},
+        {Command::RDA, Command::PDEA, ConstraintScope::Rank, tRDPDEN},
+        {Command::RDA, Command::PDEP, ConstraintScope::Rank, tRDPDEN},
+        {Command::RDA, Command::RD, ConstraintScope::Rank, memSpec.tCCD},
+        {Command::RDA, Command::RDA, ConstraintScope::Rank, memSpec.tCCD},
+        {Command::RDA, Command::WR, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::MWR, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::WRA, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::MWRA, ConstraintScope::Rank, tRDWR},
+        {Command::RDA, Command::REFAB, ConstraintScope::Rank, (tRDPRE + memSpec.tRPpb)},
+        {Command::RDA, Command::SREFEN, ConstraintScope::Rank, std::max(tRDPDEN, (tRDPRE + memSpec.tRPpb))},
+        {Command::RDA, Command::RD, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RDA, Command::RDA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::RDA, Command::WR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::MWR, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::WRA, ConstraintScope::OtherRanks, tRDWR_R},
+        {Command::RDA, Command::MWRA, ConstraintScope::OtherRanks, tRDWR_R},
+
+        {Command::WRA, Command::MWR, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::WRA, Command::MWRA, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::WRA, Command::MWR, ConstraintScope::Bank, (memSpec.tCCDMW + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WRA, Command::MWRA, ConstraintScope::Bank, (memSpec.tCCDMW + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WRA, Command::ACT, ConstraintScope::Bank, tWRAACT},
+        {Command::WRA, Command::REFPB, ConstraintScope::Bank, (tWRPRE + memSpec.tRPpb)},
+        {Command::WRA, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::WRA, Command::PDEA, ConstraintScope::Rank, tWRAPDEN},
+        {Command::WRA, Command::PDEP, ConstraintScope::Rank, tWRAPDEN},
+        {Command::WRA, Command::WR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WRA, Command::MWR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WRA, Command::WRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WRA, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::WRA, Command::WR, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WRA, Command::MWR, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WRA, Command::WRA, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WRA, Command::MWRA, ConstraintScope::Rank, (memSpec.tCCD + (memSpec.tCK * 8)), ConstraintCondition::BurstLength32},
+        {Command::WRA, Command::RD, ConstraintScope::Rank, tWRRD},
+        {Command::WRA, Command::RDA, ConstraintScope::Rank, tWRRD},
+        {Command::WRA, Command::REFAB, ConstraintScope::Rank, (tWRPRE + memSpec.tRPpb)},
+        {Command::WRA, Command::SREFEN, ConstraintScope::Rank, std::max(tWRAPDEN, (tWRPRE + memSpec.tRPpb))},
+        {Command::WRA, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::WRA, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::WRA, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::MWRA, Command::MWR, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::MWRA, Command::MWRA, ConstraintScope::Bank, memSpec.tCCDMW, ConstraintCondition::NotBurstLength32},
+        {Command::MWRA, Command::ACT, ConstraintScope::Bank, tWRAACT},
+        {Command::MWRA, Command::REFPB, ConstraintScope::Bank, (tWRPRE + memSpec.tRPpb)},
+        {Command::MWRA, Command::PREAB, ConstraintScope::Rank, tWRPRE},
+        {Command::MWRA, Command::PDEA, ConstraintScope::Rank, tWRAPDEN},
+        {Command::MWRA, Command::PDEP, ConstraintScope::Rank, tWRAPDEN},
+        {Command::MWRA, Command::WR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWRA, Command::MWR, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWRA, Command::WRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWRA, Command::MWRA, ConstraintScope::Rank, memSpec.tCCD, ConstraintCondition::NotBurstLength32},
+        {Command::MWRA, Command::RD, ConstraintScope::Rank, tWRRD},
+        {Command::MWRA, Command::RDA, ConstraintScope::Rank, tWRRD},
+        {Command::MWRA, Command::REFAB, ConstraintScope::Rank, (tWRPRE + memSpec.tRPpb)},
+        {Command::MWRA, Command::SREFEN, ConstraintScope::Rank, std::max(tWRAPDEN, (tWRPRE + memSpec.tRPpb))},
+        {Command::MWRA, Command::WR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::MWR, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::WRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::MWRA, ConstraintScope::OtherRanks, (tBURST + memSpec.tRTRS)},
+        {Command::MWRA, Command::RD, ConstraintScope::OtherRanks, tWRRD_R},
+        {Command::MWRA, Command::RDA, ConstraintScope::OtherRanks, tWRRD_R},
+
+        {Command::ACT, Command::PREPB, ConstraintScope::Bank, (memSpec.tRAS + (memSpec.tCK * 2))},
+        {Command::ACT, Command::RD, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::WR, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::MWR, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::RDA, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::WRA, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::MWRA, ConstraintScope::Bank, memSpec.tRCD},
+        {Command::ACT, Command::ACT, ConstraintScope::Bank, memSpec.tRCpb},
+        {Command::ACT, Command::REFPB, ConstraintScope::Bank, (memSpec.tRCpb + (memSpec.tCK * 2))},
+        {Command::ACT, Command::PREAB, ConstraintScope::Rank, (memSpec.tRAS + (memSpec.tCK * 2))},
+        {Command::ACT, Command::ACT, ConstraintScope::Rank, memSpec.tRRD},
+        {Command::ACT, Command::REFAB, ConstraintScope::Rank, (memSpec.tRCpb + (memSpec.tCK * 2))},
+        {Command::ACT, Command::SREFEN, ConstraintScope::Rank, (memSpec.tRCpb + (memSpec.tCK * 2))},
+        {Command::ACT, Command::REFPB, ConstraintScope::Rank, (memSpec.tRRD + (memSpec.tCK * 2))},
+        {Command::ACT, Command::PDEA, ConstraintScope::Rank, tACTPDEN},
+
+        {Command::PREPB, Command::ACT, ConstraintScope::Bank, (memSpec.tRPpb - (memSpec.tCK * 2))},
+        {Command::PREPB, Command::REFPB, ConstraintScope::Bank, memSpec.tRPpb},
+        {Command::PREPB, Command::PREPB, ConstraintScope::Rank, memSpec.tPPD},
+        {Command::PREPB, Command::PREAB, ConstraintScope::Rank, memSpec.tPPD},
+        {Command::PREPB, Command::REFAB, ConstraintScope::Rank, memSpec.tRPpb},
+        {Command::PREPB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRPpb},
+        {Command::PREPB, Command::PDEA, ConstraintScope::Rank, tPRPDEN},
+        {Command::PREPB, Command::PDEP, ConstraintScope::Rank, tPRPDEN},
+
+        {Command::REFPB, Command::ACT, ConstraintScope::Bank, (memSpec.tRFCpb - (memSpec.tCK * 2))},
+        {Command::REFPB, Command::REFAB, ConstraintScope::Rank, memSpec.tRFCpb},
+        {Command::REFPB, Command::REFPB, ConstraintScope::Rank, memSpec.tRFCpb},
+        {Command::REFPB, Command::ACT, ConstraintScope::Rank, (memSpec.tRRD - (memSpec.tCK * 2))},
+        {Command::REFPB, Command::PREAB, ConstraintScope::Rank, memSpec.tRFCpb},
+        {Command::REFPB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRFCpb},
+        {Command::REFPB, Command::PDEA, ConstraintScope::Rank, tREFPDEN},
+        {Command::REFPB, Command::PDEP, ConstraintScope::Rank, tREFPDEN},
+
+        {Command::PREAB, Command::ACT, ConstraintScope::Rank, (memSpec.tRPab - (memSpec.tCK * 2))},
+        {Command::PREAB, Command::REFAB, ConstraintScope::Rank, memSpec.tRPab},
+        {Command::PREAB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRPab},
+        {Command::PREAB, Command::REFPB, ConstraintScope::Rank, memSpec.tRPab},
+        {Command::PREAB, Command::PDEP, ConstraintScope::Rank, tPRPDEN},
+
+        {Command::REFAB, Command::ACT, ConstraintScope::Rank, (memSpec.tRFCab - (memSpec.tCK * 2))},
+        {Command::REFAB, Command::PDEP, ConstraintScope::Rank, tREFPDEN},
+        {Command::REFAB, Command::REFAB, ConstraintScope::Rank, memSpec.tRFCab},
+        {Command::REFAB, Command::REFPB, ConstraintScope::Rank, memSpec.tRFCab},
+        {Command::REFAB, Command::SREFEN, ConstraintScope::Rank, memSpec.tRFCab},
+
+        {Command::PDEA, Command::PDXA, ConstraintScope::Rank, memSpec.tCKE},
+
+        {Command::PDEP, Command::PDXP, ConstraintScope::Rank, memSpec.tCKE},
+
+        {Command::SREFEN, Command::SREFEX, ConstraintScope::Rank, memSpec.tSR},
+
+        {Command::PDXA, Command::PDEA, ConstraintScope::Rank, memSpec.tCKE},
+        {Command::PDXA, Command::ACT, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::PREPB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::PREAB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::RD, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::RDA, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::WR, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::WRA, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXA, Command::REFPB, ConstraintScope::Rank, memSpec.tXP},
+
+        {Command::PDXP, Command::PDEP, ConstraintScope::Rank, memSpec.tCKE},
+        {Command::PDXP, Command::REFAB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::REFPB, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::SREFEN, ConstraintScope::Rank, memSpec.tXP},
+        {Command::PDXP, Command::ACT, ConstraintScope::Rank, memSpec.tXP},
+
+        {Command::SREFEX, Command::ACT, ConstraintScope::Rank, (memSpec.tXSR - (memSpec.tCK * 2))},
+        {Command::SREFEX, Command::REFAB, ConstraintScope::Rank, memSpec.tXSR},
+        {Command::SREFEX, Command::REFPB, ConstraintScope::Rank, memSpec.tXSR},
+        {Command::SREFEX, Command::PDEP, ConstraintScope::Rank, memSpec.tXSR},
+        {Command::SREFEX, Command::SREFEN, ConstraintScope::Rank, memSpec.tXSR},
+    };
+
+    table.tFAW = memSpec.tFAW;
+    table.fourActivateWindowSources = {Command::ACT, Command::REFPB};
+    table.fourActivateWindowTargets = {Command::ACT, Command::REFPB};
+
+    return table;
+}
+
+} // namespace DRAMSys
@@ -37,6 +37,7 @@
 
 #include "DRAMSys/controller/Command.h"
 
+#include <array>
 #include <optional>
 
 namespace DRAMSys
@@ -52,12 +53,25 @@ protected:
 
 public:
     using ReadyCommands = std::vector<ReadyCommand>;
+    using SelectedCommands = std::array<std::optional<ReadyCommand>, 2>;
 
     CmdMuxIF() = default;
     virtual ~CmdMuxIF() = default;
 
     [[nodiscard]] virtual std::optional<ReadyCommand>
     selectCommand(const ReadyCommands& readyCommands) const = 0;
+
+    /**
+     * @brief Selects the command to issue in this cycle like selectCommand. Command multiplexers
+     * of standards with separate row and column command buses additionally return the best
+     * candidate on the other bus, which may be issued in the same cycle if it is still ready
+     * after the first command.
+     */
+    [[nodiscard]] virtual SelectedCommands
+    selectCommands(const ReadyCommands& readyCommands) const
+    {
+        return {selectCommand(readyCommands), std::nullopt};
+    }
     virtual void update([[maybe_unused]] Command command) {}
 };
 
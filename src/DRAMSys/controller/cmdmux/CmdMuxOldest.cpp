@@ -81,101 +81,67 @@ CmdMuxOldestRasCas::CmdMuxOldestRasCas(const MemSpec& memSpec) : memSpec(memSpec
 std::optional<ReadyCommand>
 CmdMuxOldestRasCas::selectCommand(const ReadyCommands& readyCommands) const
 {
-    ReadyCommands readyRasCommands;
-    ReadyCommands readyCasCommands;
-
-    for (auto it : readyCommands)
-    {
-        if (it.command.isRasCommand())
-            readyRasCommands.emplace_back(it);
-        else
-            readyCasCommands.emplace_back(it);
-    }
+    return selectCommands(readyCommands)[0];
+}
 
-    uint64_t lastPayloadID = UINT64_MAX;
+CmdMuxIF::SelectedCommands
+CmdMuxOldestRasCas::selectCommands(const ReadyCommands& readyCommands) const
+{
+    // Select the oldest RAS and the oldest CAS command in a single pass without copying them
+    const ReadyCommand* resultRas = nullptr;
+    const ReadyCommand* resultCas = nullptr;
+    uint64_t lastRasPayloadID = UINT64_MAX;
+    uint64_t lastCasPayloadID = UINT64_MAX;
+    sc_time lastRasTimestamp = sc_max_time();
+    sc_time lastCasTimestamp = sc_max_time();
     uint64_t newPayloadID = 0;
-    sc_time lastTimestamp = sc_max_time();
     sc_time newTimestamp;
 
-    auto resultRas = readyRasCommands.cend();
-
-    for (auto it = readyRasCommands.cbegin(); it != readyRasCommands.cend(); it++)
+    for (const auto& it : readyCommands)
     {
-        newTimestamp = it->readyTime + memSpec.getCommandLength(it->command);
-        newPayloadID = ControllerExtension::getChannelPayloadID(*it->trans);
-
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            resultRas = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
-        {
-            lastPayloadID = newPayloadID;
-            resultRas = it;
-        }
-    }
-
-    lastPayloadID = UINT64_MAX;
-    lastTimestamp = sc_max_time();
-
-    auto resultCas = readyCasCommands.cend();
+        newTimestamp = it.readyTime + memSpec.getCommandLength(it.command);
+        newPayloadID = ControllerExtension::getChannelPayloadID(*it.trans);
 
-    for (auto it = readyCasCommands.cbegin(); it != readyCasCommands.cend(); it++)
-    {
-        newTimestamp = it->readyTime + memSpec.getCommandLength(it->command);
-        newPayloadID = ControllerExtension::getChannelPayloadID(*it->trans);
+        const bool isRas = it.command.isRasCommand();
+        const ReadyCommand*& result = isRas ? resultRas : resultCas;
+        uint64_t& lastPayloadID = isRas ? lastRasPayloadID : lastCasPayloadID;
+        sc_time& lastTimestamp = isRas ? lastRasTimestamp : lastCasTimestamp;
 
         if (newTimestamp < lastTimestamp)
         {
             lastTimestamp = newTimestamp;
             lastPayloadID = newPayloadID;
-            resultCas = it;
+            result = &it;
         }
         else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
         {
             lastPayloadID = newPayloadID;
-            resultCas = it;
+            result = &it;
         }
     }
 
-    ReadyCommands readyRasCasCommands;
-
-    if (resultRas != readyRasCommands.cend())
-        readyRasCasCommands.emplace_back(*resultRas);
-    if (resultCas != readyCasCommands.cend())
-        readyRasCasCommands.emplace_back(*resultCas);
-
-    lastPayloadID = UINT64_MAX;
-    lastTimestamp = sc_max_time();
-
-    auto result = readyCommands.cend();
-
-    for (auto it = readyRasCasCommands.cbegin(); it != readyRasCasCommands.cend(); it++)
+    // Of both candidates, the RAS command wins ties unless the CAS command is older
+    const ReadyCommand* result = resultRas;
+    if (resultCas != nullptr &&
+        (result == nullptr || resultCas->readyTime < result->readyTime ||
+         (resultCas->readyTime == result->readyTime &&
+          ControllerExtension::getChannelPayloadID(*resultCas->trans) <
+              ControllerExtension::getChannelPayloadID(*result->trans))))
     {
-        newTimestamp = it->readyTime;
-        newPayloadID = ControllerExtension::getChannelPayloadID(*it->trans);
-
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
-        {
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
+        result = resultCas;
     }
 
-    assert(result != readyRasCasCommands.cend());
+    assert(result != nullptr);
 
     if (result->readyTime != sc_time_stamp())
-        return std::nullopt;
+        return {std::nullopt, std::nullopt};
 
-    return *result;
+    // The candidate on the other command bus may be issued in the same cycle
+    const ReadyCommand* other = result == resultRas ? resultCas : resultRas;
+    if (other == nullptr || other->readyTime != sc_time_stamp())
+        return {*result, std::nullopt};
+
+    return {*result, *other};
 }
 
 } // namespace DRAMSys
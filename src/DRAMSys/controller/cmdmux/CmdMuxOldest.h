@@ -41,7 +41,7 @@
 namespace DRAMSys
 {
 
-class CmdMuxOldest : public CmdMuxIF
+class CmdMuxOldest final : public CmdMuxIF
 {
 public:
     explicit CmdMuxOldest(const MemSpec& memSpec);
@@ -52,12 +52,14 @@ private:
     const MemSpec& memSpec;
 };
 
-class CmdMuxOldestRasCas : public CmdMuxIF
+class CmdMuxOldestRasCas final : public CmdMuxIF
 {
 public:
     explicit CmdMuxOldestRasCas(const MemSpec& memSpec);
     [[nodiscard]] std::optional<ReadyCommand>
     selectCommand(const ReadyCommands& readyCommands) const override;
+    [[nodiscard]] SelectedCommands
+    selectCommands(const ReadyCommands& readyCommands) const override;
 
 private:
     const MemSpec& memSpec;
@@ -93,89 +93,67 @@ CmdMuxStrictRasCas::CmdMuxStrictRasCas(const MemSpec& memSpec) : memSpec(memSpec
 std::optional<ReadyCommand>
 CmdMuxStrictRasCas::selectCommand(const ReadyCommands& readyCommands) const
 {
-    ReadyCommands readyRasCommands;
-    ReadyCommands readyCasCommands;
-
-    for (auto it : readyCommands)
-    {
-        if (it.command.isRasCommand())
-            readyRasCommands.emplace_back(it);
-        else
-            readyCasCommands.emplace_back(it);
-    }
+    return selectCommands(readyCommands)[0];
+}
 
+CmdMuxIF::SelectedCommands
+CmdMuxStrictRasCas::selectCommands(const ReadyCommands& readyCommands) const
+{
+    // Select the oldest RAS command and the next CAS command in order in a single pass without
+    // copying them
+    const ReadyCommand* resultRas = nullptr;
+    const ReadyCommand* resultCas = nullptr;
     uint64_t lastPayloadID = UINT64_MAX;
     uint64_t newPayloadID = 0;
     sc_time lastTimestamp = sc_max_time();
     sc_time newTimestamp;
 
-    auto resultRas = readyRasCommands.cend();
-
-    for (auto it = readyRasCommands.cbegin(); it != readyRasCommands.cend(); it++)
+    for (const auto& it : readyCommands)
     {
-        newTimestamp = it->readyTime + memSpec.getCommandLength(it->command);
-        newPayloadID = ControllerExtension::getChannelPayloadID(*it->trans);
-
-        if (newTimestamp < lastTimestamp)
+        if (it.command.isRasCommand())
         {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            resultRas = it;
+            newTimestamp = it.readyTime + memSpec.getCommandLength(it.command);
+            newPayloadID = ControllerExtension::getChannelPayloadID(*it.trans);
+
+            if (newTimestamp < lastTimestamp)
+            {
+                lastTimestamp = newTimestamp;
+                lastPayloadID = newPayloadID;
+                resultRas = &it;
+            }
+            else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
+            {
+                lastPayloadID = newPayloadID;
+                resultRas = &it;
+            }
         }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
+        else if (resultCas == nullptr &&
+                 ControllerExtension::getChannelPayloadID(*it.trans) == nextPayloadID)
         {
-            lastPayloadID = newPayloadID;
-            resultRas = it;
+            resultCas = &it;
         }
     }
 
-    auto resultCas = readyCasCommands.cend();
-
-    for (auto it = readyCasCommands.cbegin(); it != readyCasCommands.cend(); it++)
+    // Of both candidates, the RAS command wins ties unless the CAS command is older
+    const ReadyCommand* result = resultRas;
+    if (resultCas != nullptr &&
+        (result == nullptr || resultCas->readyTime < result->readyTime ||
+         (resultCas->readyTime == result->readyTime &&
+          ControllerExtension::getChannelPayloadID(*resultCas->trans) <
+              ControllerExtension::getChannelPayloadID(*result->trans))))
     {
-        newPayloadID = ControllerExtension::getChannelPayloadID(*it->trans);
-
-        if (newPayloadID == nextPayloadID)
-        {
-            resultCas = it;
-            break;
-        }
+        result = resultCas;
     }
 
-    ReadyCommands readyRasCasCommands;
-
-    if (resultRas != readyRasCommands.cend())
-        readyRasCasCommands.emplace_back(*resultRas);
-    if (resultCas != readyCasCommands.cend())
-        readyRasCasCommands.emplace_back(*resultCas);
+    if (result == nullptr)
+        return {std::nullopt, std::nullopt};
 
-    lastPayloadID = UINT64_MAX;
-    lastTimestamp = sc_max_time();
+    // The candidate on the other command bus may be issued in the same cycle
+    const ReadyCommand* other = result == resultRas ? resultCas : resultRas;
+    if (other == nullptr || other->readyTime != sc_time_stamp())
+        return {*result, std::nullopt};
 
-    auto result = readyCommands.cend();
-
-    for (auto it = readyRasCasCommands.cbegin(); it != readyRasCasCommands.cend(); it++)
-    {
-        newTimestamp = it->readyTime;
-        newPayloadID = ControllerExtension::getChannelPayloadID(*it->trans);
-
-        if (newTimestamp < lastTimestamp)
-        {
-            lastTimestamp = newTimestamp;
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
-        else if ((newTimestamp == lastTimestamp) && (newPayloadID < lastPayloadID))
-        {
-            lastPayloadID = newPayloadID;
-            result = it;
-        }
-    }
-
-    if (result == readyCommands.cend())
-        return std::nullopt;
-
-    return *result;
+    return {*result, *other};
 }
 
 void CmdMuxStrictRasCas::update(Command command)
@@ -41,7 +41,7 @@
 namespace DRAMSys
 {
 
-class CmdMuxStrict : public CmdMuxIF
+class CmdMuxStrict final : public CmdMuxIF
 {
 public:
     explicit CmdMuxStrict(const MemSpec& memSpec);
@@ -54,12 +54,14 @@ private:
     const MemSpec& memSpec;
 };
 
-class CmdMuxStrictRasCas : public CmdMuxIF
+class CmdMuxStrictRasCas final : public CmdMuxIF
 {
 public:
     explicit CmdMuxStrictRasCas(const MemSpec& memSpec);
     [[nodiscard]] std::optional<ReadyCommand>
     selectCommand(const ReadyCommands& readyCommands) const override;
+    [[nodiscard]] SelectedCommands
+    selectCommands(const ReadyCommands& readyCommands) const override;
     void update(Command command) override;
 
 private:
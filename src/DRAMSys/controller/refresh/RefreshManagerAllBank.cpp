@@ -242,6 +242,12 @@ sc_time RefreshManagerAllBank::getTimeForNextTrigger()
     return timeForNextTrigger;
 }
 
+bool RefreshManagerAllBank::isRefreshForced() const
+{
+    // Same condition as the forced branch in evaluate()
+    return state == State::Regular && !sleeping && flexibilityCounter == maxPostponed;
+}
+
 void RefreshManagerAllBank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
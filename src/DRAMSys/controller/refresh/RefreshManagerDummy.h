@@ -51,6 +51,7 @@ public:
     void evaluate() override {}
     void update([[maybe_unused]] Command command) override {}
     sc_core::sc_time getTimeForNextTrigger() override { return sc_core::sc_max_time(); }
+    [[nodiscard]] bool isRefreshForced() const override { return false; }
 
     void serialize([[maybe_unused]] std::ostream& stream) const override {}
     void deserialize([[maybe_unused]] std::istream& stream) override {}
@@ -53,6 +53,10 @@ class RefreshManagerIF : public ManagerIF, public Serialize, public Deserialize
 public:
     virtual sc_core::sc_time getTimeForNextTrigger() = 0;
 
+    // True if the maximum number of refreshes is postponed and the next refresh cannot be delayed,
+    // pulled-in refreshes and the refresh after a self-refresh exit are never forced
+    [[nodiscard]] virtual bool isRefreshForced() const = 0;
+
 protected:
     static sc_core::sc_time getTimeForFirstTrigger(const sc_core::sc_time& tCK,
                                                    const sc_core::sc_time& refreshInterval,
@@ -266,6 +266,12 @@ sc_time RefreshManagerPer2Bank::getTimeForNextTrigger()
     return timeForNextTrigger;
 }
 
+bool RefreshManagerPer2Bank::isRefreshForced() const
+{
+    // Same condition as the forced branch in evaluate()
+    return state == State::Regular && !sleeping && flexibilityCounter == maxPostponed;
+}
+
 void RefreshManagerPer2Bank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
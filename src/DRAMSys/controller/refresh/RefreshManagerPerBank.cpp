@@ -215,6 +215,12 @@ sc_time RefreshManagerPerBank::getTimeForNextTrigger()
     return timeForNextTrigger;
 }
 
+bool RefreshManagerPerBank::isRefreshForced() const
+{
+    // Same condition as the forced branch in evaluate()
+    return state == State::Regular && !sleeping && flexibilityCounter == maxPostponed;
+}
+
 void RefreshManagerPerBank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
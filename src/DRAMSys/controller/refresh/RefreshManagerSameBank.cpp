@@ -339,6 +339,12 @@ sc_time RefreshManagerSameBank::getTimeForNextTrigger()
     return timeForNextTrigger;
 }
 
+bool RefreshManagerSameBank::isRefreshForced() const
+{
+    // Same condition as the forced branch in evaluate()
+    return state == State::Regular && !sleeping && flexibilityCounter == maxPostponed;
+}
+
 void RefreshManagerSameBank::serialize(std::ostream& stream) const
 {
     stream.write(reinterpret_cast<char const*>(&timeForNextTrigger), sizeof(timeForNextTrigger));
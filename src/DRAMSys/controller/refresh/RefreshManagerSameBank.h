@@ -65,6 +65,7 @@ public:
     void evaluate() override;
     void update(Command command) override;
     sc_core::sc_time getTimeForNextTrigger() override;
+    [[nodiscard]] bool isRefreshForced() const override;
 
     void serialize(std::ostream& stream) const override;
     void deserialize(std::istream& stream) override;
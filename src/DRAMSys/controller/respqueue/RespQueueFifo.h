@@ -35,9 +35,9 @@
 #ifndef RESPQUEUEFIFO_H
 #define RESPQUEUEFIFO_H
 
+#include "DRAMSys/common/RingBuffer.h"
 #include "DRAMSys/controller/respqueue/RespQueueIF.h"
 
-#include <queue>
 #include <systemc>
 #include <tlm>
 #include <utility>
@@ -53,7 +53,7 @@ public:
     [[nodiscard]] sc_core::sc_time getTriggerTime() const override;
 
 private:
-    std::queue<std::pair<tlm::tlm_generic_payload*, sc_core::sc_time>> buffer;
+    RingBuffer<std::pair<tlm::tlm_generic_payload*, sc_core::sc_time>> buffer;
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef INTRUSIVEREQUESTQUEUE_H
+#define INTRUSIVEREQUESTQUEUE_H
+
+#include "DRAMSys/common/dramExtensions.h"
+
+#include <cstddef>
+#include <iterator>
+#include <tlm>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Doubly linked queue of payloads in insertion order. The links are stored in the
+ * ControllerExtension of each payload, so storing and removing a payload never allocates.
+ * The template parameter selects which of the SchedulerLinks is used, so that a payload can be
+ * part of two queues at the same time.
+ */
+template <SchedulerLinks::Link SchedulerLinks::*link> class IntrusiveRequestQueue
+{
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = tlm::tlm_generic_payload*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type const*;
+        using reference = value_type const&;
+
+        const_iterator() = default;
+        explicit const_iterator(tlm::tlm_generic_payload* payload) : payload(payload) {}
+
+        reference operator*() const { return payload; }
+
+        const_iterator& operator++()
+        {
+            payload = getLink(*payload).next;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const { return payload == other.payload; }
+        bool operator!=(const const_iterator& other) const { return payload != other.payload; }
+
+    private:
+        tlm::tlm_generic_payload* payload = nullptr;
+    };
+
+    void push_back(tlm::tlm_generic_payload& payload)
+    {
+        SchedulerLinks::Link& links = getLink(payload);
+        links.previous = tail;
+        links.next = nullptr;
+
+        if (tail != nullptr)
+            getLink(*tail).next = &payload;
+        else
+            head = &payload;
+
+        tail = &payload;
+        count++;
+    }
+
+    void remove(tlm::tlm_generic_payload& payload)
+    {
+        SchedulerLinks::Link& links = getLink(payload);
+
+        if (links.previous != nullptr)
+            getLink(*links.previous).next = links.next;
+        else
+            head = links.next;
+
+        if (links.next != nullptr)
+            getLink(*links.next).previous = links.previous;
+        else
+            tail = links.previous;
+
+        links = {};
+        count--;
+    }
+
+    [[nodiscard]] bool empty() const { return count == 0; }
+    [[nodiscard]] std::size_t size() const { return count; }
+    [[nodiscard]] tlm::tlm_generic_payload* front() const { return head; }
+    [[nodiscard]] const_iterator begin() const { return const_iterator(head); }
+    [[nodiscard]] const_iterator end() const { return const_iterator(); }
+
+private:
+    static SchedulerLinks::Link& getLink(tlm::tlm_generic_payload& payload)
+    {
+        return ControllerExtension::getSchedulerLinks(payload).*link;
+    }
+
+    tlm::tlm_generic_payload* head = nullptr;
+    tlm::tlm_generic_payload* tail = nullptr;
+    std::size_t count = 0;
+};
+
+} // namespace DRAMSys
+
+#endif // INTRUSIVEREQUESTQUEUE_H
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "RequestBuffer.h"
+
+#include <cstdint>
+#include <utility>
+
+using namespace tlm;
+
+namespace DRAMSys
+{
+
+void RequestBuffer::push_back(tlm_generic_payload& payload)
+{
+    const Row row = ControllerExtension::getRow(payload);
+
+    // Keep the load factor of the row index at or below one half
+    if (2 * (numberOfRows + 1) > rowSlots.size())
+        grow();
+
+    std::size_t slot = findSlot(row);
+    if (rowSlots[slot].queue.empty())
+    {
+        rowSlots[slot].row = row;
+        numberOfRows++;
+        cacheValid = false;
+    }
+
+    requests.push_back(payload);
+    rowSlots[slot].queue.push_back(payload);
+}
+
+void RequestBuffer::remove(tlm_generic_payload& payload)
+{
+    std::size_t slot = findSlot(ControllerExtension::getRow(payload));
+
+    requests.remove(payload);
+    rowSlots[slot].queue.remove(payload);
+
+    if (rowSlots[slot].queue.empty())
+    {
+        eraseSlot(slot);
+        numberOfRows--;
+        cacheValid = false;
+    }
+}
+
+const RequestBuffer::RowQueue* RequestBuffer::getRowHits(Row row) const
+{
+    if (!cacheValid || cachedRow != row)
+    {
+        const RowQueue* rowHits = nullptr;
+        if (numberOfRows > 0)
+        {
+            const RowSlot& rowSlot = rowSlots[findSlot(row)];
+            if (!rowSlot.queue.empty())
+                rowHits = &rowSlot.queue;
+        }
+
+        cachedRow = row;
+        cachedRowHits = rowHits;
+        cacheValid = true;
+    }
+
+    return cachedRowHits;
+}
+
+tlm_generic_payload* RequestBuffer::getOldestRowHit(Row row) const
+{
+    const RowQueue* rowHits = getRowHits(row);
+    return rowHits != nullptr ? rowHits->front() : nullptr;
+}
+
+std::size_t RequestBuffer::getNumberOfRowHits(Row row) const
+{
+    const RowQueue* rowHits = getRowHits(row);
+    return rowHits != nullptr ? rowHits->size() : 0;
+}
+
+std::size_t RequestBuffer::getHomeSlot(Row row) const
+{
+    // Fibonacci hashing, the upper bits of the product are well distributed
+    return static_cast<std::size_t>((static_cast<uint64_t>(row) * UINT64_C(0x9E3779B97F4A7C15)) >>
+                                    (64 - rowSlotBits));
+}
+
+std::size_t RequestBuffer::findSlot(Row row) const
+{
+    const std::size_t mask = rowSlots.size() - 1;
+    std::size_t slot = getHomeSlot(row);
+
+    while (!rowSlots[slot].queue.empty() && rowSlots[slot].row != row)
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+void RequestBuffer::eraseSlot(std::size_t slot)
+{
+    // Backward shift deletion keeps all probe sequences intact without tombstones
+    const std::size_t mask = rowSlots.size() - 1;
+    std::size_t next = slot;
+
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (rowSlots[next].queue.empty())
+            break;
+
+        // Only move the entry if the free slot lies on its probe sequence
+        const std::size_t home = getHomeSlot(rowSlots[next].row);
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            rowSlots[slot] = rowSlots[next];
+            slot = next;
+        }
+    }
+
+    rowSlots[slot] = RowSlot();
+}
+
+void RequestBuffer::grow()
+{
+    std::vector<RowSlot> oldRowSlots = std::move(rowSlots);
+
+    rowSlotBits = rowSlotBits == 0 ? 4 : rowSlotBits + 1;
+    rowSlots = std::vector<RowSlot>(std::size_t(1) << rowSlotBits);
+
+    for (const RowSlot& rowSlot : oldRowSlots)
+    {
+        if (!rowSlot.queue.empty())
+            rowSlots[findSlot(rowSlot.row)] = rowSlot;
+    }
+
+    cacheValid = false;
+}
+
+} // namespace DRAMSys
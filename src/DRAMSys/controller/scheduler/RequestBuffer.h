@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef REQUESTBUFFER_H
+#define REQUESTBUFFER_H
+
+#include "DRAMSys/common/dramExtensions.h"
+#include "DRAMSys/controller/scheduler/IntrusiveRequestQueue.h"
+
+#include <cstddef>
+#include <tlm>
+#include <vector>
+
+namespace DRAMSys
+{
+
+/**
+ * @brief Request buffer of a single bank. Besides the age order of all requests, the requests
+ * are indexed by their row, so that row hits can be found and counted without scanning the
+ * whole buffer. The requests of a row are kept in age order as well.
+ *
+ * Both orders are intrusive queues linked through the ControllerExtension. The row index is an
+ * open addressing table that only grows with the number of distinct pending rows, so storing
+ * and removing requests does not allocate once the buffer has been filled.
+ */
+class RequestBuffer
+{
+public:
+    using RequestQueue = IntrusiveRequestQueue<&SchedulerLinks::age>;
+    using RowQueue = IntrusiveRequestQueue<&SchedulerLinks::row>;
+
+    void push_back(tlm::tlm_generic_payload& payload);
+    void remove(tlm::tlm_generic_payload& payload);
+
+    [[nodiscard]] bool empty() const { return requests.empty(); }
+    [[nodiscard]] std::size_t size() const { return requests.size(); }
+    [[nodiscard]] tlm::tlm_generic_payload* front() const { return requests.front(); }
+    [[nodiscard]] RequestQueue::const_iterator begin() const { return requests.begin(); }
+    [[nodiscard]] RequestQueue::const_iterator end() const { return requests.end(); }
+
+    /**
+     * @brief Returns all pending requests to the given row in age order or nullptr if there are
+     * none. The result of the last lookup is cached, as the bank machines repeatedly query
+     * their open row.
+     */
+    [[nodiscard]] const RowQueue* getRowHits(Row row) const;
+    [[nodiscard]] tlm::tlm_generic_payload* getOldestRowHit(Row row) const;
+    [[nodiscard]] std::size_t getNumberOfRowHits(Row row) const;
+
+private:
+    // A slot is free if its queue is empty
+    struct RowSlot
+    {
+        Row row = Row(0);
+        RowQueue queue;
+    };
+
+    [[nodiscard]] std::size_t getHomeSlot(Row row) const;
+    [[nodiscard]] std::size_t findSlot(Row row) const;
+    void eraseSlot(std::size_t slot);
+    void grow();
+
+    RequestQueue requests;
+    std::vector<RowSlot> rowSlots;
+    unsigned rowSlotBits = 0;
+    std::size_t numberOfRows = 0;
+
+    mutable Row cachedRow = Row(0);
+    mutable const RowQueue* cachedRowHits = nullptr;
+    mutable bool cacheValid = false;
+};
+
+} // namespace DRAMSys
+
+#endif // REQUESTBUFFER_H
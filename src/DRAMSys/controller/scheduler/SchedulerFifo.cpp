@@ -45,7 +45,7 @@ namespace DRAMSys
 
 SchedulerFifo::SchedulerFifo(const McConfig& config, const MemSpec& memSpec)
 {
-    buffer = ControllerVector<Bank, std::deque<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    buffer = ControllerVector<Bank, RequestBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -64,13 +64,13 @@ bool SchedulerFifo::hasBufferSpace(unsigned entries) const
 
 void SchedulerFifo::storeRequest(tlm_generic_payload& payload)
 {
-    buffer[ControllerExtension::getBank(payload)].push_back(&payload);
+    buffer[ControllerExtension::getBank(payload)].push_back(payload);
     bufferCounter->storeRequest(payload);
 }
 
 void SchedulerFifo::removeRequest(tlm_generic_payload& payload)
 {
-    buffer[ControllerExtension::getBank(payload)].pop_front();
+    buffer[ControllerExtension::getBank(payload)].remove(payload);
     bufferCounter->removeRequest(payload);
 }
 
@@ -87,7 +87,7 @@ bool SchedulerFifo::hasFurtherRowHit(Bank bank, Row row, [[maybe_unused]] tlm_co
 {
     if (buffer[bank].size() >= 2)
     {
-        tlm_generic_payload& nextRequest = *buffer[bank][1];
+        tlm_generic_payload& nextRequest = **std::next(buffer[bank].begin());
         if (ControllerExtension::getRow(nextRequest) == row)
             return true;
     }
@@ -38,10 +38,10 @@
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/RequestBuffer.h"
 #include "DRAMSys/controller/scheduler/SchedulerIF.h"
 #include "DRAMSys/controller/McConfig.h"
 
-#include <deque>
 #include <memory>
 #include <tlm>
 #include <vector>
@@ -64,7 +64,7 @@ public:
     [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
 
 private:
-    ControllerVector<Bank, std::deque<tlm::tlm_generic_payload*>> buffer;
+    ControllerVector<Bank, RequestBuffer> buffer;
     std::unique_ptr<BufferCounterIF> bufferCounter;
 };
 
@@ -45,7 +45,7 @@ namespace DRAMSys
 
 SchedulerFrFcfsGrp::SchedulerFrFcfsGrp(const McConfig& config, const MemSpec& memSpec)
 {
-    buffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    buffer = ControllerVector<Bank, RequestBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -64,23 +64,19 @@ bool SchedulerFrFcfsGrp::hasBufferSpace(unsigned entries) const
 
 void SchedulerFrFcfsGrp::storeRequest(tlm_generic_payload& trans)
 {
-    buffer[ControllerExtension::getBank(trans)].push_back(&trans);
+    buffer[ControllerExtension::getBank(trans)].push_back(trans);
     bufferCounter->storeRequest(trans);
 }
 
 void SchedulerFrFcfsGrp::removeRequest(tlm_generic_payload& trans)
 {
     bufferCounter->removeRequest(trans);
-    lastCommand = trans.get_command();
-    Bank bank = ControllerExtension::getBank(trans);
-    for (auto it = buffer[bank].begin(); it != buffer[bank].end(); it++)
+    if (lastCommand != trans.get_command())
     {
-        if (*it == &trans)
-        {
-            buffer[bank].erase(it);
-            break;
-        }
+        lastCommand = trans.get_command();
+        selectionEpoch++;
     }
+    buffer[ControllerExtension::getBank(trans)].remove(trans);
 }
 
 tlm_generic_payload* SchedulerFrFcfsGrp::getNextRequest(const BankMachine& bankMachine) const
@@ -90,23 +86,17 @@ tlm_generic_payload* SchedulerFrFcfsGrp::getNextRequest(const BankMachine& bankM
     {
         if (bankMachine.isActivated())
         {
-            // Filter all row hits
-            Row openRow = bankMachine.getOpenRow();
-            std::list<tlm_generic_payload*> rowHits;
-            for (auto* it : buffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    rowHits.push_back(it);
-            }
+            // All row hits in age order
+            const auto* rowHits = buffer[bank].getRowHits(bankMachine.getOpenRow());
 
-            if (!rowHits.empty())
+            if (rowHits != nullptr)
             {
-                for (auto outerIt = rowHits.begin(); outerIt != rowHits.end(); outerIt++)
+                for (auto outerIt = rowHits->begin(); outerIt != rowHits->end(); outerIt++)
                 {
                     if ((*outerIt)->get_command() == lastCommand)
                     {
                         bool hazardDetected = false;
-                        for (auto innerIt = rowHits.begin(); *innerIt != *outerIt; innerIt++)
+                        for (auto innerIt = rowHits->begin(); *innerIt != *outerIt; innerIt++)
                         {
                             if ((*outerIt)->get_address() == (*innerIt)->get_address())
                             {
@@ -119,7 +109,7 @@ tlm_generic_payload* SchedulerFrFcfsGrp::getNextRequest(const BankMachine& bankM
                     }
                 }
                 // no rd/wr hit found -> take first row hit
-                return *rowHits.begin();
+                return rowHits->front();
             }
         }
         // No row hit found or bank precharged
@@ -132,17 +122,7 @@ bool SchedulerFrFcfsGrp::hasFurtherRowHit(Bank bank,
                                           Row row,
                                           [[maybe_unused]] tlm_command command) const
 {
-    unsigned rowHitCounter = 0;
-    for (auto* it : buffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
-    return false;
+    return buffer[bank].getNumberOfRowHits(row) >= 2;
 }
 
 bool SchedulerFrFcfsGrp::hasFurtherRequest(Bank bank, [[maybe_unused]] tlm_command command) const
@@ -155,4 +135,9 @@ const std::vector<unsigned>& SchedulerFrFcfsGrp::getBufferDepth() const
     return bufferCounter->getBufferDepth();
 }
 
+uint64_t SchedulerFrFcfsGrp::getSelectionEpoch() const
+{
+    return selectionEpoch;
+}
+
 } // namespace DRAMSys
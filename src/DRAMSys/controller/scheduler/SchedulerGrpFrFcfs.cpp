@@ -45,8 +45,8 @@ namespace DRAMSys
 
 SchedulerGrpFrFcfs::SchedulerGrpFrFcfs(const McConfig& config, const MemSpec& memSpec)
 {
-    readBuffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
-    writeBuffer = ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    readBuffer = ControllerVector<Bank, RequestBuffer>(memSpec.banksPerChannel);
+    writeBuffer = ControllerVector<Bank, RequestBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -68,22 +68,26 @@ bool SchedulerGrpFrFcfs::hasBufferSpace(unsigned entries) const
 void SchedulerGrpFrFcfs::storeRequest(tlm_generic_payload& payload)
 {
     if (payload.is_read())
-        readBuffer[ControllerExtension::getBank(payload)].push_back(&payload);
+        readBuffer[ControllerExtension::getBank(payload)].push_back(payload);
     else
-        writeBuffer[ControllerExtension::getBank(payload)].push_back(&payload);
+        writeBuffer[ControllerExtension::getBank(payload)].push_back(payload);
     bufferCounter->storeRequest(payload);
 }
 
 void SchedulerGrpFrFcfs::removeRequest(tlm_generic_payload& payload)
 {
     bufferCounter->removeRequest(payload);
-    lastCommand = payload.get_command();
+    if (lastCommand != payload.get_command())
+    {
+        lastCommand = payload.get_command();
+        selectionEpoch++;
+    }
     Bank bank = ControllerExtension::getBank(payload);
 
     if (payload.is_read())
-        readBuffer[bank].remove(&payload);
+        readBuffer[bank].remove(payload);
     else
-        writeBuffer[bank].remove(&payload);
+        writeBuffer[bank].remove(payload);
 }
 
 tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankMachine) const
@@ -99,12 +103,8 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
-                for (auto* it : readBuffer[bank])
-                {
-                    if (ControllerExtension::getRow(*it) == openRow)
-                        return it;
-                }
+                if (auto* rowHit = readBuffer[bank].getOldestRowHit(bankMachine.getOpenRow()))
+                    return rowHit;
             }
             // No read row hit found or bank precharged
             return readBuffer[bank].front();
@@ -114,12 +114,8 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
             if (bankMachine.isActivated())
             {
                 // Search for write row hit
-                Row openRow = bankMachine.getOpenRow();
-                for (auto* it : writeBuffer[bank])
-                {
-                    if (ControllerExtension::getRow(*it) == openRow)
-                        return it;
-                }
+                if (auto* rowHit = writeBuffer[bank].getOldestRowHit(bankMachine.getOpenRow()))
+                    return rowHit;
             }
             // No write row hit found or bank precharged
             return writeBuffer[bank].front();
@@ -132,12 +128,8 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
         if (bankMachine.isActivated())
         {
             // Search for write row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : writeBuffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            if (auto* rowHit = writeBuffer[bank].getOldestRowHit(bankMachine.getOpenRow()))
+                return rowHit;
         }
         // No write row hit found or bank precharged
         return writeBuffer[bank].front();
@@ -147,12 +139,8 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
         if (bankMachine.isActivated())
         {
             // Search for read row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : readBuffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            if (auto* rowHit = readBuffer[bank].getOldestRowHit(bankMachine.getOpenRow()))
+                return rowHit;
         }
         // No read row hit found or bank precharged
         return readBuffer[bank].front();
@@ -163,32 +151,10 @@ tlm_generic_payload* SchedulerGrpFrFcfs::getNextRequest(const BankMachine& bankM
 bool SchedulerGrpFrFcfs::hasFurtherRowHit(Bank bank, Row row, tlm_command command) const
 {
     // TODO: do this based on current RD/WR mode
-    unsigned rowHitCounter = 0;
     if (command == tlm::TLM_READ_COMMAND)
-    {
-        for (auto* it : readBuffer[bank])
-        {
-            if (ControllerExtension::getRow(*it) == row)
-            {
-                rowHitCounter++;
-                if (rowHitCounter == 2)
-                    return true;
-            }
-        }
-        return false;
-    }
-
-    for (auto* it : writeBuffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
+        return readBuffer[bank].getNumberOfRowHits(row) >= 2;
 
-    return false;
+    return writeBuffer[bank].getNumberOfRowHits(row) >= 2;
 }
 
 bool SchedulerGrpFrFcfs::hasFurtherRequest(Bank bank, tlm_command command) const
@@ -206,4 +172,9 @@ const std::vector<unsigned>& SchedulerGrpFrFcfs::getBufferDepth() const
     return bufferCounter->getBufferDepth();
 }
 
+uint64_t SchedulerGrpFrFcfs::getSelectionEpoch() const
+{
+    return selectionEpoch;
+}
+
 } // namespace DRAMSys
@@ -47,10 +47,8 @@ SchedulerGrpFrFcfsWm::SchedulerGrpFrFcfsWm(const McConfig& config, const MemSpec
     lowWatermark(config.lowWatermark),
     highWatermark(config.highWatermark)
 {
-    readBuffer =
-        ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
-    writeBuffer =
-        ControllerVector<Bank, std::list<tlm_generic_payload*>>(memSpec.banksPerChannel);
+    readBuffer = ControllerVector<Bank, RequestBuffer>(memSpec.banksPerChannel);
+    writeBuffer = ControllerVector<Bank, RequestBuffer>(memSpec.banksPerChannel);
 
     if (config.schedulerBuffer == Config::SchedulerBufferType::Bankwise)
         bufferCounter = std::make_unique<BufferCounterBankwise>(config.requestBufferSize,
@@ -75,9 +73,9 @@ bool SchedulerGrpFrFcfsWm::hasBufferSpace(unsigned entries) const
 void SchedulerGrpFrFcfsWm::storeRequest(tlm_generic_payload& payload)
 {
     if (payload.is_read())
-        readBuffer[ControllerExtension::getBank(payload)].push_back(&payload);
+        readBuffer[ControllerExtension::getBank(payload)].push_back(payload);
     else
-        writeBuffer[ControllerExtension::getBank(payload)].push_back(&payload);
+        writeBuffer[ControllerExtension::getBank(payload)].push_back(payload);
     bufferCounter->storeRequest(payload);
     evaluateWriteMode();
 }
@@ -88,9 +86,9 @@ void SchedulerGrpFrFcfsWm::removeRequest(tlm_generic_payload& payload)
     Bank bank = ControllerExtension::getBank(payload);
 
     if (payload.is_read())
-        readBuffer[bank].remove(&payload);
+        readBuffer[bank].remove(payload);
     else
-        writeBuffer[bank].remove(&payload);
+        writeBuffer[bank].remove(payload);
 
     evaluateWriteMode();
 }
@@ -106,12 +104,8 @@ tlm_generic_payload* SchedulerGrpFrFcfsWm::getNextRequest(const BankMachine& ban
             if (bankMachine.isActivated())
             {
                 // Search for read row hit
-                Row openRow = bankMachine.getOpenRow();
-                for (auto* it : readBuffer[bank])
-                {
-                    if (ControllerExtension::getRow(*it) == openRow)
-                        return it;
-                }
+                if (auto* rowHit = readBuffer[bank].getOldestRowHit(bankMachine.getOpenRow()))
+                    return rowHit;
             }
             // No read row hit found or bank precharged
             return readBuffer[bank].front();
@@ -124,12 +118,8 @@ tlm_generic_payload* SchedulerGrpFrFcfsWm::getNextRequest(const BankMachine& ban
         if (bankMachine.isActivated())
         {
             // Search for write row hit
-            Row openRow = bankMachine.getOpenRow();
-            for (auto* it : writeBuffer[bank])
-            {
-                if (ControllerExtension::getRow(*it) == openRow)
-                    return it;
-            }
+            if (auto* rowHit = writeBuffer[bank].getOldestRowHit(bankMachine.getOpenRow()))
+                return rowHit;
         }
         // No row hit found or bank precharged
         return writeBuffer[bank].front();
@@ -142,32 +132,10 @@ bool SchedulerGrpFrFcfsWm::hasFurtherRowHit(Bank bank,
                                             Row row,
                                             [[maybe_unused]] tlm::tlm_command command) const
 {
-    unsigned rowHitCounter = 0;
     if (!writeMode)
-    {
-        for (const auto* it : readBuffer[bank])
-        {
-            if (ControllerExtension::getRow(*it) == row)
-            {
-                rowHitCounter++;
-                if (rowHitCounter == 2)
-                    return true;
-            }
-        }
-        return false;
-    }
-
-    for (auto* it : writeBuffer[bank])
-    {
-        if (ControllerExtension::getRow(*it) == row)
-        {
-            rowHitCounter++;
-            if (rowHitCounter == 2)
-                return true;
-        }
-    }
+        return readBuffer[bank].getNumberOfRowHits(row) >= 2;
 
-    return false;
+    return writeBuffer[bank].getNumberOfRowHits(row) >= 2;
 }
 
 bool SchedulerGrpFrFcfsWm::hasFurtherRequest(Bank bank,
@@ -186,19 +154,30 @@ const std::vector<unsigned>& SchedulerGrpFrFcfsWm::getBufferDepth() const
     return bufferCounter->getBufferDepth();
 }
 
+uint64_t SchedulerGrpFrFcfsWm::getSelectionEpoch() const
+{
+    return selectionEpoch;
+}
+
 void SchedulerGrpFrFcfsWm::evaluateWriteMode()
 {
     if (writeMode)
     {
         if (bufferCounter->getNumWriteRequests() <= lowWatermark &&
             bufferCounter->getNumReadRequests() != 0)
+        {
             writeMode = false;
+            selectionEpoch++;
+        }
     }
     else
     {
         if (bufferCounter->getNumWriteRequests() > highWatermark ||
             bufferCounter->getNumReadRequests() == 0)
+        {
             writeMode = true;
+            selectionEpoch++;
+        }
     }
 }
 
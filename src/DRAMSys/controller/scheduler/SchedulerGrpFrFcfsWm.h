@@ -38,9 +38,9 @@
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/BankMachine.h"
 #include "DRAMSys/controller/scheduler/BufferCounterIF.h"
+#include "DRAMSys/controller/scheduler/RequestBuffer.h"
 #include "DRAMSys/controller/scheduler/SchedulerIF.h"
 
-#include <list>
 #include <memory>
 #include <tlm>
 #include <vector>
@@ -61,16 +61,18 @@ public:
     hasFurtherRowHit(Bank bank, Row row, tlm::tlm_command command) const override;
     [[nodiscard]] bool hasFurtherRequest(Bank bank, tlm::tlm_command command) const override;
     [[nodiscard]] const std::vector<unsigned>& getBufferDepth() const override;
+    [[nodiscard]] uint64_t getSelectionEpoch() const override;
 
 private:
     void evaluateWriteMode();
 
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> readBuffer;
-    ControllerVector<Bank, std::list<tlm::tlm_generic_payload*>> writeBuffer;
+    ControllerVector<Bank, RequestBuffer> readBuffer;
+    ControllerVector<Bank, RequestBuffer> writeBuffer;
     std::unique_ptr<BufferCounterIF> bufferCounter;
     const unsigned lowWatermark;
     const unsigned highWatermark;
     bool writeMode = false;
+    uint64_t selectionEpoch = 0;
 };
 
 } // namespace DRAMSys
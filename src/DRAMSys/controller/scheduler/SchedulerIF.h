@@ -37,6 +37,7 @@
 
 #include "DRAMSys/common/dramExtensions.h"
 
+#include <cstdint>
 #include <tlm>
 #include <vector>
 
@@ -66,6 +67,12 @@ public:
     hasFurtherRowHit(Bank bank, Row row, tlm::tlm_command command) const = 0;
     [[nodiscard]] virtual bool hasFurtherRequest(Bank bank, tlm::tlm_command command) const = 0;
     [[nodiscard]] virtual const std::vector<unsigned>& getBufferDepth() const = 0;
+
+    /**
+     * @brief Returns a counter that is incremented whenever a scheduler-wide state (e.g., the
+     * current read/write mode) changes, which can alter the request selection of all banks.
+     */
+    [[nodiscard]] virtual uint64_t getSelectionEpoch() const { return 0; }
 };
 
 } // namespace DRAMSys
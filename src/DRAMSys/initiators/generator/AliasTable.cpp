@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "AliasTable.h"
+
+#include <numeric>
+#include <stdexcept>
+
+namespace DRAMSys::Initiators
+{
+
+AliasTable::AliasTable(std::vector<double> const& weights) : columns(weights.size())
+{
+    double sum = std::accumulate(weights.cbegin(), weights.cend(), 0.0);
+    if (weights.empty() || !(sum > 0.0))
+        throw std::invalid_argument("The weights must have a positive sum");
+
+    // Scale the weights so that the average column is exactly full
+    std::vector<double> scaled(weights.size());
+    std::vector<std::size_t> small;
+    std::vector<std::size_t> large;
+    for (std::size_t index = 0; index < weights.size(); index++)
+    {
+        if (weights[index] < 0.0)
+            throw std::invalid_argument("The weights must not be negative");
+
+        scaled[index] = weights[index] * static_cast<double>(weights.size()) / sum;
+        (scaled[index] < 1.0 ? small : large).push_back(index);
+    }
+
+    // Fill every underfull column with the remainder of an overfull one
+    while (!small.empty() && !large.empty())
+    {
+        std::size_t less = small.back();
+        small.pop_back();
+        std::size_t more = large.back();
+
+        columns[less] = {Xoshiro256::probabilityThreshold(scaled[less]), less, more};
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0)
+        {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // The remaining columns are full except for rounding errors
+    for (std::size_t index : large)
+        columns[index] = {Xoshiro256::probabilityThreshold(1.0), index, index};
+    for (std::size_t index : small)
+        columns[index] = {Xoshiro256::probabilityThreshold(1.0), index, index};
+}
+
+} // namespace DRAMSys::Initiators
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#pragma once
+
+#include <DRAMSys/initiators/generator/Xoshiro256.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace DRAMSys::Initiators
+{
+
+/**
+ * Samples from a discrete distribution in constant time using Vose's alias method. The table is
+ * built once from the (not necessarily normalized) weights, every sample then needs one bounded
+ * random number and one comparison.
+ */
+class AliasTable
+{
+public:
+    explicit AliasTable(std::vector<double> const& weights);
+
+    [[nodiscard]] std::size_t size() const { return columns.size(); }
+
+    std::size_t sample(Xoshiro256& generator) const
+    {
+        const Column& column = columns[generator.nextBelow(columns.size())];
+        return generator.nextBernoulli(column.threshold) ? column.index : column.alias;
+    }
+
+private:
+    struct Column
+    {
+        uint64_t threshold = 0;
+        std::size_t index = 0;
+        std::size_t alias = 0;
+    };
+
+    std::vector<Column> columns;
+};
+
+} // namespace DRAMSys::Initiators
@@ -37,6 +37,8 @@
 
 #include <DRAMSys/initiators/request/Request.h>
 
+#include <cstddef>
+
 namespace DRAMSys::Initiators
 {
 
@@ -53,6 +55,14 @@ public:
     virtual ~GeneratorState() = default;
 
     virtual Request nextRequest() = 0;
+
+    // Generates the next count requests at once, states override this with a tight loop
+    virtual void nextRequests(Request* requests, std::size_t count)
+    {
+        for (std::size_t index = 0; index < count; index++)
+            requests[index] = nextRequest();
+    }
+
     virtual uint64_t totalRequests() = 0;
     virtual void reset() {}
 };
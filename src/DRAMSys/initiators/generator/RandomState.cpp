@@ -35,6 +35,7 @@
 
 #include "RandomState.h"
 
+#include <algorithm>
 #include <systemc>
 
 namespace DRAMSys::Initiators
@@ -50,11 +51,14 @@ RandomState::RandomState(uint64_t numRequests,
                          unsigned int dataAlignment) :
     numberOfRequests(numRequests),
     seed(seed),
-    rwRatio(rwRatio),
+    rwRatio(std::clamp(rwRatio, 0.0, 1.0)),
     dataLength(dataLength),
     dataAlignment(dataAlignment),
     randomGenerator(this->seed),
-    randomAddressDistribution(minAddress.value_or(0), maxAddress.value_or((memorySize)-dataLength))
+    readThreshold(Xoshiro256::probabilityThreshold(this->rwRatio)),
+    minAddress(minAddress.value_or(0)),
+    // The range of the addresses is inclusive, a range of 0 covers the whole 64 bit space
+    addressRange(maxAddress.value_or(memorySize - dataLength) - this->minAddress + 1)
 {
     if (minAddress > memorySize - 1)
         SC_REPORT_FATAL("TrafficGenerator", "minAddress is out of range.");
@@ -65,22 +69,37 @@ RandomState::RandomState(uint64_t numRequests,
     if (maxAddress < minAddress)
         SC_REPORT_FATAL("TrafficGenerator", "maxAddress is smaller than minAddress.");
 
-    rwRatio = std::clamp(rwRatio, 0.0, 1.0);
+    if (dataAlignment != 0 && (dataAlignment & (dataAlignment - 1)) == 0)
+        alignmentMask = ~static_cast<uint64_t>(dataAlignment - 1);
 }
 
-Request RandomState::nextRequest()
+Request RandomState::generateRequest()
 {
     Request request;
-    request.address = randomAddressDistribution(randomGenerator);
+    request.address = minAddress + randomGenerator.nextBelow(addressRange);
 
     // Align address
-    request.address = request.address - (request.address % dataAlignment);
+    if (alignmentMask.has_value())
+        request.address &= *alignmentMask;
+    else
+        request.address = request.address - (request.address % dataAlignment);
 
-    request.command = readWriteDistribution(randomGenerator) < rwRatio ? Request::Command::Read
-                                                                       : Request::Command::Write;
+    request.command = randomGenerator.nextBernoulli(readThreshold) ? Request::Command::Read
+                                                                   : Request::Command::Write;
     request.length = dataLength;
 
     return request;
 }
 
+Request RandomState::nextRequest()
+{
+    return generateRequest();
+}
+
+void RandomState::nextRequests(Request* requests, std::size_t count)
+{
+    for (std::size_t index = 0; index < count; index++)
+        requests[index] = generateRequest();
+}
+
 } // namespace DRAMSys::Initiators
@@ -36,9 +36,9 @@
 #pragma once
 
 #include <DRAMSys/initiators/generator/GeneratorState.h>
+#include <DRAMSys/initiators/generator/Xoshiro256.h>
 
 #include <optional>
-#include <random>
 
 namespace DRAMSys::Initiators
 {
@@ -56,6 +56,7 @@ public:
                 unsigned int dataAlignment);
 
     Request nextRequest() override;
+    void nextRequests(Request* requests, std::size_t count) override;
     uint64_t totalRequests() override { return numberOfRequests; }
 
     uint64_t numberOfRequests;
@@ -64,9 +65,16 @@ public:
     unsigned int dataLength;
     unsigned int dataAlignment;
 
-    std::default_random_engine randomGenerator;
-    std::uniform_real_distribution<double> readWriteDistribution{0.0, 1.0};
-    std::uniform_int_distribution<uint64_t> randomAddressDistribution;
+private:
+    Request generateRequest();
+
+    Xoshiro256 randomGenerator;
+    uint64_t readThreshold;
+    uint64_t minAddress;
+    uint64_t addressRange;
+
+    // Only used if the alignment is a power of two, otherwise the remainder is subtracted
+    std::optional<uint64_t> alignmentMask;
 };
 
 } // namespace DRAMSys::Initiators
@@ -35,6 +35,7 @@
 
 #include "SequentialState.h"
 
+#include <algorithm>
 #include <systemc>
 
 namespace DRAMSys::Initiators
@@ -53,9 +54,11 @@ SequentialState::SequentialState(uint64_t numRequests,
     minAddress(minAddress.value_or(0)),
     maxAddress(maxAddress.value_or(memorySize - 1)),
     seed(seed),
-    rwRatio(rwRatio),
+    rwRatio(std::clamp(rwRatio, 0.0, 1.0)),
     dataLength(dataLength),
-    randomGenerator(this->seed)
+    randomGenerator(this->seed),
+    readThreshold(Xoshiro256::probabilityThreshold(this->rwRatio)),
+    addressRange(this->maxAddress - this->minAddress)
 {
     if (this->minAddress > memorySize - 1)
         SC_REPORT_FATAL("TrafficGenerator", "minAddress is out of range.");
@@ -66,19 +69,36 @@ SequentialState::SequentialState(uint64_t numRequests,
     if (this->maxAddress < this->minAddress)
         SC_REPORT_FATAL("TrafficGenerator", "maxAddress is smaller than minAddress.");
 
-    rwRatio = std::clamp(rwRatio, 0.0, 1.0);
+    if (addressRange == 0)
+        SC_REPORT_FATAL("TrafficGenerator", "maxAddress is equal to minAddress.");
+
+    wrappedIncrement = addressRange != 0 ? this->addressIncrement % addressRange : 0;
 }
 
-Request SequentialState::nextRequest()
+Request SequentialState::generateRequest()
 {
     Request request;
-    request.address = generatedRequests * addressIncrement % (maxAddress - minAddress) + minAddress;
-    request.command = readWriteDistribution(randomGenerator) < rwRatio ? Request::Command::Read
-                                                                       : Request::Command::Write;
+    request.address = addressOffset + minAddress;
+    request.command = randomGenerator.nextBernoulli(readThreshold) ? Request::Command::Read
+                                                                   : Request::Command::Write;
     request.length = dataLength;
 
-    generatedRequests++;
+    addressOffset += wrappedIncrement;
+    if (addressOffset >= addressRange)
+        addressOffset -= addressRange;
+
     return request;
 }
 
+Request SequentialState::nextRequest()
+{
+    return generateRequest();
+}
+
+void SequentialState::nextRequests(Request* requests, std::size_t count)
+{
+    for (std::size_t index = 0; index < count; index++)
+        requests[index] = generateRequest();
+}
+
 } // namespace DRAMSys::Initiators
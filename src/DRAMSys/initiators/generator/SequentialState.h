@@ -36,9 +36,9 @@
 #pragma once
 
 #include <DRAMSys/initiators/generator/GeneratorState.h>
+#include <DRAMSys/initiators/generator/Xoshiro256.h>
 
 #include <optional>
-#include <random>
 
 namespace DRAMSys::Initiators
 {
@@ -56,8 +56,9 @@ public:
                     unsigned int dataLength);
 
     Request nextRequest() override;
+    void nextRequests(Request* requests, std::size_t count) override;
     uint64_t totalRequests() override { return numberOfRequests; }
-    void reset() override { generatedRequests = 0; }
+    void reset() override { addressOffset = 0; }
 
     uint64_t numberOfRequests;
     uint64_t addressIncrement;
@@ -67,10 +68,16 @@ public:
     double rwRatio;
     unsigned int dataLength;
 
-    std::default_random_engine randomGenerator;
-    std::uniform_real_distribution<double> readWriteDistribution{0.0, 1.0};
+private:
+    Request generateRequest();
 
-    uint64_t generatedRequests = 0;
+    Xoshiro256 randomGenerator;
+    uint64_t readThreshold;
+
+    // The offset wraps around at the address range, which replaces a modulo per request
+    uint64_t addressRange;
+    uint64_t wrappedIncrement;
+    uint64_t addressOffset = 0;
 };
 
 } // namespace DRAMSys::Initiators
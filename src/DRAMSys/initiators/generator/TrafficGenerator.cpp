@@ -38,13 +38,30 @@
 #include "RandomState.h"
 #include "SequentialState.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace DRAMSys::Initiators
 {
 
+namespace
+{
+
+Xoshiro256 transitionGenerator(uint64_t seed)
+{
+    // Jump ahead so that the transitions do not reuse the random numbers of the states
+    Xoshiro256 generator(seed);
+    generator.jump();
+    return generator;
+}
+
+} // namespace
+
 TrafficGenerator::TrafficGenerator(::DRAMSys::Config::TrafficGeneratorStateMachine const& config,
                                    uint64_t memorySize) :
-    stateTransistions(config.transitions),
-    generatorPeriod(sc_core::sc_time(1.0 / static_cast<double>(config.clkMhz), sc_core::SC_US))
+    generatorPeriod(sc_core::sc_time(1.0 / static_cast<double>(config.clkMhz), sc_core::SC_US)),
+    initialRandomGenerator(transitionGenerator(config.seed.value_or(0))),
+    randomGenerator(initialRandomGenerator)
 {
     unsigned int dataLength = config.dataLength;
     unsigned int dataAlignment = config.dataAlignment.value_or(dataLength);
@@ -97,11 +114,46 @@ TrafficGenerator::TrafficGenerator(::DRAMSys::Config::TrafficGeneratorStateMachi
             },
             state);
     }
+
+    // Group the transitions by their source state and precompute their alias tables
+    std::unordered_map<unsigned int, std::pair<std::vector<double>, std::vector<unsigned int>>>
+        transitionsFrom;
+    for (auto const& transition : config.transitions)
+    {
+        if (producers.find(transition.to) == producers.cend() &&
+            idleStateClks.find(transition.to) == idleStateClks.cend())
+            SC_REPORT_FATAL("TrafficGenerator", "Transition to an undefined state.");
+
+        auto& [probabilities, targets] = transitionsFrom[transition.from];
+        probabilities.push_back(transition.probability);
+        targets.push_back(transition.to);
+    }
+
+    for (auto& [from, transitions] : transitionsFrom)
+    {
+        try
+        {
+            stateTransitions.emplace(
+                from,
+                Transitions{AliasTable(transitions.first), std::move(transitions.second)});
+        }
+        catch (std::invalid_argument const&)
+        {
+            SC_REPORT_FATAL("TrafficGenerator", "Invalid transition probabilities.");
+        }
+    }
+
+    if (producers.find(0) == producers.cend())
+        SC_REPORT_FATAL("TrafficGenerator", "The initial state 0 must be an active state.");
+
+    enterState(0);
 }
 
 TrafficGenerator::TrafficGenerator(::DRAMSys::Config::TrafficGenerator const& config,
                                    uint64_t memorySize) :
-    generatorPeriod(sc_core::sc_time(1.0 / static_cast<double>(config.clkMhz), sc_core::SC_US))
+    generatorPeriod(sc_core::sc_time(1.0 / static_cast<double>(config.clkMhz), sc_core::SC_US)),
+    initialRandomGenerator(transitionGenerator(config.seed.value_or(0))),
+    randomGenerator(initialRandomGenerator)
 {
     unsigned int dataLength = config.dataLength;
     unsigned int dataAlignment = config.dataAlignment.value_or(dataLength);
@@ -130,100 +182,117 @@ TrafficGenerator::TrafficGenerator(::DRAMSys::Config::TrafficGenerator const& co
                                                           dataLength);
         producers.emplace(0, std::move(producer));
     }
+
+    enterState(0);
 }
 
 Request TrafficGenerator::nextRequest()
 {
-    if (currentState == STOP_STATE)
-        return Request{Request::Command::Stop, 0, 0, {}};
+    if (batchBegin == batchEnd)
+        fillBatch();
 
-    Request request = producers[currentState]->nextRequest();
-    requestsInState++;
+    if (batchBegin == batchEnd)
+        return Request{Request::Command::Stop, 0, 0};
 
-    // Switch state if necessary
-    unsigned ticksToIdle = 0;
-    if (requestsInState >= producers[currentState]->totalRequests())
+    nextTriggerTime = batchTriggers[batchBegin];
+    return batch[batchBegin++];
+}
+
+void TrafficGenerator::fillBatch()
+{
+    batchBegin = 0;
+    batchEnd = 0;
+
+    while (batchEnd < BATCH_SIZE && currentState != STOP_STATE)
     {
+        uint64_t requestsOfState = currentProducer->totalRequests();
+        auto count = static_cast<std::size_t>(
+            std::min<uint64_t>(BATCH_SIZE - batchEnd, requestsOfState - requestsInState));
+
+        currentProducer->nextRequests(&batch[batchEnd], count);
+        std::fill_n(&batchTriggers[batchEnd], count, generatorPeriod);
+        batchEnd += count;
+        requestsInState += count;
+
+        if (requestsInState < requestsOfState)
+            continue;
+
         // Reset current producer to its initial state
-        producers[currentState]->reset();
+        currentProducer->reset();
 
-        auto newState = stateTransition(currentState);
+        // Idle states and active states without requests only delay the next request
+        unsigned ticksToIdle = 0;
+        auto newState = stateTransition(currentState, randomGenerator);
+        while (newState != STOP_STATE)
+        {
+            auto idleStateIt = idleStateClks.find(newState);
+            if (idleStateIt != idleStateClks.cend())
+                ticksToIdle += idleStateIt->second;
+            else if (producers.at(newState)->totalRequests() != 0)
+                break;
 
-        auto idleStateIt = idleStateClks.find(newState);
-        while (idleStateIt != idleStateClks.cend())
+            newState = stateTransition(newState, randomGenerator);
+        }
+
+        if (batchEnd > 0)
         {
-            ticksToIdle += idleStateIt->second;
-            newState = stateTransition(newState);
-            idleStateIt = idleStateClks.find(newState);
+            if (newState == STOP_STATE)
+                // Allow the issuer to finish before the response comes back
+                batchTriggers[batchEnd - 1] = sc_core::SC_ZERO_TIME;
+            else
+                batchTriggers[batchEnd - 1] = generatorPeriod * (1 + ticksToIdle);
         }
 
-        currentState = newState;
-        requestsInState = 0;
+        enterState(newState);
     }
+}
 
-    if (currentState == STOP_STATE)
-        // Allow the issuer to finish before the response comes back
-        nextTriggerTime = sc_core::SC_ZERO_TIME;
-    else
-        nextTriggerTime = generatorPeriod * (1 + ticksToIdle);
-
-    return request;
+void TrafficGenerator::enterState(unsigned int state)
+{
+    currentState = state;
+    requestsInState = 0;
+    currentProducer = state != STOP_STATE ? producers.at(state).get() : nullptr;
 }
 
 uint64_t TrafficGenerator::totalRequests()
 {
-    // Store current state of random generator
-    std::default_random_engine tempGenerator(randomGenerator);
+    if (numberOfRequests.has_value())
+        return *numberOfRequests;
 
-    // Reset generator to initial state
-    randomGenerator.seed();
+    // Replay the state transitions from the initial state of the random generator
+    Xoshiro256 generator(initialRandomGenerator);
 
     uint64_t totalRequests = 0;
-    unsigned int currentState = 0;
+    unsigned int state = 0;
 
-    if (producers.find(currentState) != producers.cend())
-        totalRequests += producers.at(currentState)->totalRequests();
+    if (producers.find(state) != producers.cend())
+        totalRequests += producers.at(state)->totalRequests();
 
-    while (currentState != STOP_STATE)
+    while (state != STOP_STATE)
     {
-        currentState = stateTransition(currentState);
+        state = stateTransition(state, generator);
 
-        if (producers.find(currentState) != producers.cend())
-            totalRequests += producers.at(currentState)->totalRequests();
+        if (producers.find(state) != producers.cend())
+            totalRequests += producers.at(state)->totalRequests();
     }
 
-    // Restore state of random generator
-    randomGenerator = tempGenerator;
-
+    numberOfRequests = totalRequests;
     return totalRequests;
 }
 
 unsigned int TrafficGenerator::stateTransition(unsigned int from)
 {
-    using Transition = DRAMSys::Config::TrafficGeneratorStateTransition;
-
-    std::vector<Transition> relevantTransitions;
-    std::copy_if(stateTransistions.cbegin(),
-                 stateTransistions.cend(),
-                 std::back_inserter(relevantTransitions),
-                 [from](Transition transition) { return transition.from == from; });
+    return stateTransition(from, randomGenerator);
+}
 
-    if (relevantTransitions.empty())
+unsigned int TrafficGenerator::stateTransition(unsigned int from, Xoshiro256& generator) const
+{
+    auto transitionsIt = stateTransitions.find(from);
+    if (transitionsIt == stateTransitions.cend())
         return STOP_STATE;
 
-    std::vector<double> propabilities;
-    std::for_each(relevantTransitions.cbegin(),
-                  relevantTransitions.cend(),
-                  [&propabilities](Transition transition)
-                  { propabilities.push_back(transition.probability); });
-
-    assert(propabilities.size() == relevantTransitions.size());
-
-    std::discrete_distribution<std::size_t> stateTransitionDistribution(propabilities.cbegin(),
-                                                                        propabilities.cend());
-
-    std::size_t index = stateTransitionDistribution(randomGenerator);
-    return relevantTransitions[index].to;
+    Transitions const& transitions = transitionsIt->second;
+    return transitions.targets[transitions.table.sample(generator)];
 }
 
 } // namespace DRAMSys::Initiators
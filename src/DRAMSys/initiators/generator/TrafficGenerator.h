@@ -38,15 +38,27 @@
 #include "GeneratorState.h"
 
 #include <DRAMSys/configuration/json/DRAMSysConfiguration.h>
+#include <DRAMSys/initiators/generator/AliasTable.h>
+#include <DRAMSys/initiators/generator/Xoshiro256.h>
 #include <DRAMSys/initiators/request/RequestProducer.h>
 
-#include <random>
+#include <array>
+#include <climits>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace DRAMSys::Initiators
 {
 
 class RequestProducer;
 
+/**
+ * The requests are generated in batches into a buffer that is then consumed request by request
+ * by the RequestIssuer. A batch only calls into the producer of the current state once, the
+ * state transitions are sampled from precomputed alias tables.
+ */
 class TrafficGenerator : public RequestProducer
 {
 public:
@@ -61,20 +73,41 @@ public:
 
     unsigned int stateTransition(unsigned int from);
 
+    static constexpr std::size_t BATCH_SIZE = 256;
+
 private:
     static constexpr unsigned int STOP_STATE = UINT_MAX;
 
+    struct Transitions
+    {
+        AliasTable table;
+        std::vector<unsigned int> targets;
+    };
+
+    unsigned int stateTransition(unsigned int from, Xoshiro256& generator) const;
+    void fillBatch();
+    void enterState(unsigned int state);
+
     uint64_t requestsInState = 0;
     unsigned int currentState = 0;
+    GeneratorState* currentProducer = nullptr;
     sc_core::sc_time nextTriggerTime = sc_core::SC_ZERO_TIME;
-    std::vector<::DRAMSys::Config::TrafficGeneratorStateTransition> stateTransistions;
+    std::unordered_map<unsigned int, Transitions> stateTransitions;
 
     std::unordered_map<unsigned int, unsigned int> idleStateClks;
     sc_core::sc_time generatorPeriod;
 
-    std::default_random_engine randomGenerator;
+    // The transitions use their own sequence so that they do not correlate with the states
+    Xoshiro256 initialRandomGenerator;
+    Xoshiro256 randomGenerator;
+    std::optional<uint64_t> numberOfRequests;
 
     std::unordered_map<unsigned int, std::unique_ptr<GeneratorState>> producers;
+
+    std::array<Request, BATCH_SIZE> batch;
+    std::array<sc_core::sc_time, BATCH_SIZE> batchTriggers;
+    std::size_t batchBegin = 0;
+    std::size_t batchEnd = 0;
 };
 
 } // namespace DRAMSys::Initiators
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace DRAMSys::Initiators
+{
+
+/**
+ * The xoshiro256** pseudo random number generator by Blackman and Vigna. It is considerably
+ * faster than the standard library engines and produces the same sequence for a given seed on
+ * every platform. Satisfies the UniformRandomBitGenerator requirements.
+ */
+class Xoshiro256
+{
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256(uint64_t seed = 0)
+    {
+        // The state is expanded from the seed with SplitMix64, as recommended by the authors
+        for (auto& word : state)
+        {
+            seed += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31U);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()()
+    {
+        const uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17U;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotateLeft(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * Returns an unbiased number in the range [0, range) using Lemire's multiply-and-shift
+     * method, which in contrast to a modulo rarely needs a division. A range of 0 returns the
+     * full 64 bit number.
+     */
+    uint64_t nextBelow(uint64_t range)
+    {
+        if (range == 0)
+            return (*this)();
+
+        uint64_t low = 0;
+        uint64_t high = multiply((*this)(), range, low);
+        if (low < range)
+        {
+            const uint64_t threshold = (0 - range) % range;
+            while (low < threshold)
+                high = multiply((*this)(), range, low);
+        }
+
+        return high;
+    }
+
+    /**
+     * Returns true with the given probability in units of 2^-53, see probabilityThreshold().
+     */
+    bool nextBernoulli(uint64_t threshold) { return ((*this)() >> 11U) < threshold; }
+
+    static uint64_t probabilityThreshold(double probability)
+    {
+        constexpr double SCALE = 9007199254740992.0; // 2^53
+
+        if (!(probability > 0.0))
+            return 0;
+        if (probability >= 1.0)
+            return static_cast<uint64_t>(SCALE);
+
+        return static_cast<uint64_t>(probability * SCALE);
+    }
+
+    /**
+     * Advances the generator by 2^128 steps, which yields a sequence that does not overlap with
+     * the one of the original generator.
+     */
+    void jump()
+    {
+        static constexpr std::array<uint64_t, 4> JUMP = {
+            0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL,
+            0x39ABDC4529B1661CULL};
+
+        std::array<uint64_t, 4> jumped{};
+        for (uint64_t word : JUMP)
+        {
+            for (unsigned bit = 0; bit < 64; bit++)
+            {
+                if ((word & (uint64_t{1} << bit)) != 0)
+                {
+                    for (std::size_t i = 0; i < state.size(); i++)
+                        jumped[i] ^= state[i];
+                }
+                (*this)();
+            }
+        }
+
+        state = jumped;
+    }
+
+private:
+    static uint64_t rotateLeft(uint64_t x, unsigned k) { return (x << k) | (x >> (64U - k)); }
+
+    // Returns the high half of the 128 bit product and stores the low half in low
+    static uint64_t multiply(uint64_t a, uint64_t b, uint64_t& low)
+    {
+#ifdef __SIZEOF_INT128__
+        __extension__ typedef unsigned __int128 uint128;
+        uint128 product = static_cast<uint128>(a) * b;
+        low = static_cast<uint64_t>(product);
+        return static_cast<uint64_t>(product >> 64U);
+#else
+        const uint64_t aLow = a & 0xFFFFFFFFU;
+        const uint64_t aHigh = a >> 32U;
+        const uint64_t bLow = b & 0xFFFFFFFFU;
+        const uint64_t bHigh = b >> 32U;
+
+        const uint64_t lowLow = aLow * bLow;
+        const uint64_t highLow = aHigh * bLow;
+        const uint64_t lowHigh = aLow * bHigh;
+        const uint64_t cross = (lowLow >> 32U) + (highLow & 0xFFFFFFFFU) + lowHigh;
+
+        low = (cross << 32U) | (lowLow & 0xFFFFFFFFU);
+        return aHigh * bHigh + (highLow >> 32U) + (cross >> 32U);
+#endif
+    }
+
+    std::array<uint64_t, 4> state{};
+};
+
+} // namespace DRAMSys::Initiators
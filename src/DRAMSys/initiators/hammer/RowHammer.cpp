@@ -49,7 +49,7 @@ RowHammer::RowHammer(::DRAMSys::Config::RowHammer const& config) :
 Request RowHammer::nextRequest()
 {
     if (generatedRequests >= numberOfRequests)
-        return Request{Request::Command::Stop, 0, 0, {}};
+        return Request{Request::Command::Stop, 0, 0};
 
     generatedRequests++;
 
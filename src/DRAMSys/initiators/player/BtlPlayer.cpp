@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "BtlPlayer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace DRAMSys::Initiators
+{
+
+BtlPlayer::BtlPlayer(::DRAMSys::Config::TracePlayer const& config,
+                     std::filesystem::path const& trace,
+                     bool storageEnabled) :
+    storageEnabled(storageEnabled),
+    playerPeriod(sc_core::sc_time(1.0 / static_cast<double>(config.clkMhz), sc_core::SC_US)),
+    defaultDataLength(config.dataLength)
+{
+    try
+    {
+        reader = std::make_unique<BinaryTraceReader>(trace.string());
+
+        if (config.startRequest.has_value() && config.startCycle.has_value())
+            SC_REPORT_FATAL("BtlPlayer", "Only one of startRequest and startCycle may be set");
+
+        if (config.startRequest.has_value())
+            reader->seekToRecord(*config.startRequest);
+        else if (config.startCycle.has_value())
+            reader->seekToCycle(*config.startCycle);
+
+        numberOfRequests = reader->getNumberOfRecords() - reader->getPosition();
+        fetchRecord();
+    }
+    catch (const std::runtime_error& error)
+    {
+        SC_REPORT_FATAL("BtlPlayer", error.what());
+    }
+
+    if (!hasRecord)
+        SC_REPORT_FATAL("BtlPlayer", (std::string("Empty trace ") + trace.string()).c_str());
+
+    // A playback that starts within an absolute trace begins with its first request, otherwise
+    // the timestamps are kept as in the StlPlayer. The delays of relative traces do not depend on
+    // the start of the playback.
+    bool seeked = config.startRequest.has_value() || config.startCycle.has_value();
+    if (seeked && !reader->isRelative())
+        cycleOffset = record.cycle;
+}
+
+void BtlPlayer::fetchRecord()
+{
+    hasRecord = reader->next(record);
+}
+
+Request BtlPlayer::nextRequest()
+{
+    if (!hasRecord)
+    {
+        // The file is read in completely. Nothing more to do.
+        return Request{Request::Command::Stop, 0, 0};
+    }
+
+    auto command = record.command == BinaryTrace::Command::Read ? Request::Command::Read
+                                                                 : Request::Command::Write;
+    auto dataLength = record.length != 0 ? record.length : defaultDataLength;
+
+    Request request{command, record.address, dataLength};
+    if (storageEnabled && record.command == BinaryTrace::Command::Write && record.data == nullptr)
+        SC_REPORT_FATAL("BtlPlayer", "Missing data of a write request in storage mode");
+
+    requestData = record.data;
+    requestDataSize = record.dataSize;
+
+    try
+    {
+        fetchRecord();
+    }
+    catch (const std::runtime_error& error)
+    {
+        SC_REPORT_FATAL("BtlPlayer", error.what());
+    }
+
+    return request;
+}
+
+void BtlPlayer::writeData(unsigned char* data, std::size_t length)
+{
+    // The data is copied straight from the mapped trace into the payload
+    std::size_t size = std::min(requestDataSize, length);
+    std::copy(requestData, requestData + size, data);
+    std::fill(data + size, data + length, 0);
+}
+
+sc_core::sc_time BtlPlayer::nextTrigger()
+{
+    if (!hasRecord)
+        return sc_core::SC_ZERO_TIME;
+
+    if (reader->isRelative())
+        return static_cast<double>(record.delta) * playerPeriod;
+
+    // Requests before the start of the playback in unordered traces are issued immediately
+    uint64_t cycle = record.cycle > cycleOffset ? record.cycle - cycleOffset : 0;
+    sc_core::sc_time cycleTime = static_cast<double>(cycle) * playerPeriod;
+    bool behindSchedule = sc_core::sc_time_stamp() > cycleTime;
+    return behindSchedule ? sc_core::SC_ZERO_TIME : cycleTime - sc_core::sc_time_stamp();
+}
+
+} // namespace DRAMSys::Initiators
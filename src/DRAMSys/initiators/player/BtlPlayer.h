@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#pragma once
+
+#include <DRAMSys/common/BinaryTraceReader.h>
+#include <DRAMSys/configuration/json/TraceSetup.h>
+#include <DRAMSys/initiators/request/RequestProducer.h>
+
+#include <systemc>
+
+#include <filesystem>
+#include <memory>
+
+namespace DRAMSys::Initiators
+{
+
+/**
+ * @brief Plays a binary trace (.btl), the binary counterpart of the StlPlayer.
+ *
+ * The playback can start at any request or cycle of the trace. In absolute traces the time
+ * stamps are shifted so that the first played request is issued at the start of the simulation.
+ */
+class BtlPlayer : public RequestProducer
+{
+public:
+    BtlPlayer(::DRAMSys::Config::TracePlayer const& config,
+              std::filesystem::path const& trace,
+              bool storageEnabled);
+
+    Request nextRequest() override;
+    void writeData(unsigned char* data, std::size_t length) override;
+    sc_core::sc_time nextTrigger() override;
+    uint64_t totalRequests() override { return numberOfRequests; }
+
+private:
+    void fetchRecord();
+
+    bool storageEnabled;
+    sc_core::sc_time playerPeriod;
+    unsigned int defaultDataLength;
+
+    std::unique_ptr<BinaryTraceReader> reader;
+    uint64_t numberOfRequests = 0;
+    uint64_t cycleOffset = 0;
+
+    BinaryTrace::Record record;
+    bool hasRecord = false;
+
+    // Data of the last returned request, points into the trace
+    const uint8_t* requestData = nullptr;
+    std::size_t requestDataSize = 0;
+};
+
+} // namespace DRAMSys::Initiators
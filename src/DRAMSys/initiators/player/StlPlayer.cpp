@@ -40,7 +40,8 @@
 
 #include "StlPlayer.h"
 
-#include <sstream>
+#include <algorithm>
+#include <stdexcept>
 
 namespace DRAMSys::Initiators
 {
@@ -50,66 +51,60 @@ StlPlayer::StlPlayer(::DRAMSys::Config::TracePlayer const& config,
                      TraceType traceType,
                      bool storageEnabled) :
     traceType(traceType),
-    storageEnabled(storageEnabled),
     playerPeriod(sc_core::sc_time(1.0 / static_cast<double>(config.clkMhz), sc_core::SC_US)),
-    defaultDataLength(config.dataLength),
-    traceFile(trace)
+    defaultDataLength(config.dataLength)
 {
-    if (!traceFile.is_open())
-        SC_REPORT_FATAL("StlPlayer",
-                        (std::string("Could not open trace ") + trace.string()).c_str());
-
+    try
     {
-        std::string line;
-        while (std::getline(traceFile, line))
-        {
-            if (line.size() > 1 && line[0] != '#')
-                numberOfLines++;
-        }
-        if (numberOfLines == 0)
-            SC_REPORT_FATAL("StlPlayer", (std::string("Empty trace ") + trace.string()).c_str());
-        traceFile.clear();
-        traceFile.seekg(0);
+        parser = std::make_unique<StlTraceParser>(trace, storageEnabled);
+    }
+    catch (const std::runtime_error& error)
+    {
+        SC_REPORT_FATAL("StlPlayer", error.what());
     }
 
-    parseTraceFile();
-    swapBuffers();
-    readoutIt = lineBuffers.at(consumeIndex).cbegin();
+    fetchBlock();
+    if (block == nullptr)
+        SC_REPORT_FATAL("StlPlayer", (std::string("Empty trace ") + trace.string()).c_str());
 }
 
-void StlPlayer::incrementLine()
+void StlPlayer::fetchBlock()
 {
-    readoutIt++;
-
-    if (readoutIt == lineBuffers.at(consumeIndex).cend())
+    try
     {
-        swapBuffers();
-        readoutIt = lineBuffers.at(consumeIndex).cbegin();
-
-        if (lineBuffers.at(consumeIndex).empty())
-        {
-            if (parserThread.joinable())
-                parserThread.join();
-        }
+        block = parser->nextBlock();
+        blockIndex = 0;
     }
+    catch (const std::runtime_error& error)
+    {
+        SC_REPORT_FATAL("StlPlayer", error.what());
+    }
+}
+
+void StlPlayer::incrementLine()
+{
+    blockIndex++;
+
+    if (blockIndex == block->size)
+        fetchBlock();
 }
 
-std::optional<StlPlayer::LineContent> StlPlayer::currentLine() const
+StlPlayer::LineContent* StlPlayer::currentLine() const
 {
-    if (readoutIt == lineBuffers.at(consumeIndex).cend())
-        return std::nullopt;
+    if (block == nullptr)
+        return nullptr;
 
-    return *readoutIt;
+    return &block->lines[blockIndex];
 }
 
 Request StlPlayer::nextRequest()
 {
-    auto currentLineContent = currentLine();
+    LineContent* currentLineContent = currentLine();
 
-    if (!currentLineContent.has_value())
+    if (currentLineContent == nullptr)
     {
         // The file is read in completely. Nothing more to do.
-        return Request{Request::Command::Stop, 0, 0, {}};
+        return Request{Request::Command::Stop, 0, 0};
     }
 
     auto command = currentLineContent->command == LineContent::Command::Read
@@ -119,129 +114,45 @@ Request StlPlayer::nextRequest()
                           ? currentLineContent->dataLength.value()
                           : defaultDataLength;
 
-    Request request{command, currentLineContent->address, dataLength, currentLineContent->data};
+    Request request{command, currentLineContent->address, dataLength};
+
+    // The line may be released by the parser before the data is written
+    std::swap(requestData, currentLineContent->data);
 
     incrementLine();
 
     return request;
 }
 
+void StlPlayer::writeData(unsigned char* data, std::size_t length)
+{
+    std::size_t size = std::min(requestData.size(), length);
+    std::copy_n(requestData.begin(), size, data);
+    std::fill(data + size, data + length, 0);
+}
+
 sc_core::sc_time StlPlayer::nextTrigger()
 {
-    auto currentLineContent = currentLine();
+    const LineContent* currentLineContent = currentLine();
     sc_core::sc_time nextTrigger = sc_core::SC_ZERO_TIME;
-    if (currentLineContent.has_value())
+    if (currentLineContent != nullptr)
     {
+        auto cycle = static_cast<double>(currentLineContent->cycle);
+
         if (traceType == TraceType::Absolute)
         {
-            sc_core::sc_time cycleTime = currentLineContent->cycle * playerPeriod;
+            sc_core::sc_time cycleTime = cycle * playerPeriod;
             bool behindSchedule = sc_core::sc_time_stamp() > cycleTime;
             nextTrigger =
                 behindSchedule ? sc_core::SC_ZERO_TIME : cycleTime - sc_core::sc_time_stamp();
         }
         else // if (traceType == TraceType::Relative)
         {
-            nextTrigger = currentLineContent->cycle * playerPeriod;
+            nextTrigger = cycle * playerPeriod;
         }
     }
 
     return nextTrigger;
 }
 
-void StlPlayer::parseTraceFile()
-{
-    unsigned parsedLines = 0;
-    auto& parseBuffer = lineBuffers.at(parseIndex);
-    parseBuffer.clear();
-
-    static constexpr std::size_t LINE_BUFFER_SIZE = 10000;
-    while (traceFile && !traceFile.eof() && parsedLines < LINE_BUFFER_SIZE)
-    {
-        // Get a new line from the input file.
-        std::string line;
-        std::getline(traceFile, line);
-        currentParsedLine++;
-
-        // If the line is empty (\n or \r\n) or starts with '#' (comment) the transaction is
-        // ignored.
-        if (line.size() <= 1 || line.at(0) == '#')
-            continue;
-
-        parsedLines++;
-        parseBuffer.emplace_back();
-        LineContent& content = parseBuffer.back();
-
-        // Trace files MUST provide timestamp, command and address for every
-        // transaction. The data information depends on the storage mode
-        // configuration.
-        std::string element;
-        std::istringstream iss;
-
-        iss.str(line);
-
-        try
-        {
-            // Get the timestamp for the transaction.
-            iss >> element;
-            content.cycle = std::stoull(element);
-
-            // Get the optional burst length and command
-            iss >> element;
-
-            if (element.at(0) == '(')
-            {
-                element.erase(0, 1);
-                content.dataLength = std::stoul(element);
-                iss >> element;
-            }
-
-            if (element == "read")
-                content.command = LineContent::Command::Read;
-            else if (element == "write")
-                content.command = LineContent::Command::Write;
-            else
-                throw std::runtime_error("Unable to parse command");
-
-            // Get the address.
-            iss >> element;
-            static constexpr unsigned HEX = 16;
-            content.address = std::stoull(element, nullptr, HEX);
-
-            // Get the data if necessary.
-            if (storageEnabled && content.command == LineContent::Command::Write)
-            {
-                // The input trace file must provide the data to be stored into the memory.
-                iss >> element;
-
-                // We need two characters to represent 1 byte in hexadecimal.
-                // Start at the last byte (LSB), end with offset for 0x prefix.
-                for (std::size_t i = element.length() - 2; i >= 2; i -= 2)
-                {
-                    uint8_t byte = std::stoi(element.substr(i, 2), nullptr, HEX);
-                    content.data.push_back(byte);
-                }
-            }
-        }
-        catch (...)
-        {
-            SC_REPORT_FATAL(
-                "StlPlayer",
-                ("Malformed trace file line " + std::to_string(currentParsedLine) + ".").c_str());
-        }
-    }
-}
-
-void StlPlayer::swapBuffers()
-{
-    // Wait for parser to finish
-    if (parserThread.joinable())
-        parserThread.join();
-
-    // Swap buffers
-    std::swap(parseIndex, consumeIndex);
-
-    // Start new parser thread
-    parserThread = std::thread(&StlPlayer::parseTraceFile, this);
-}
-
 } // namespace DRAMSys::Initiators
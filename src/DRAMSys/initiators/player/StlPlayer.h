@@ -41,16 +41,14 @@
 #pragma once
 
 #include <DRAMSys/configuration/json/TraceSetup.h>
+#include <DRAMSys/initiators/player/StlTraceParser.h>
 #include <DRAMSys/initiators/request/RequestProducer.h>
 
 #include <systemc>
 #include <tlm>
 
-#include <array>
 #include <filesystem>
-#include <fstream>
-#include <optional>
-#include <thread>
+#include <memory>
 #include <vector>
 
 namespace DRAMSys::Initiators
@@ -70,53 +68,33 @@ public:
               TraceType traceType,
               bool storageEnabled);
 
-    // TODO temporary fix
-    ~StlPlayer()
-    {
-        if (parserThread.joinable())
-            parserThread.join();
-    }
-
     Request nextRequest() override;
+    void writeData(unsigned char* data, std::size_t length) override;
     sc_core::sc_time nextTrigger() override;
-    uint64_t totalRequests() override { return numberOfLines; }
+
+    // The trace is not read in advance, the number of requests is estimated from its size and
+    // refined while it is played
+    uint64_t totalRequests() override { return parser->estimateNumberOfLines(); }
 
 private:
-    struct LineContent
-    {
-        unsigned cycle{};
-        enum class Command : uint8_t
-        {
-            Read,
-            Write
-        } command{};
-        uint64_t address{};
-        std::optional<unsigned> dataLength;
-        std::vector<uint8_t> data;
-    };
+    using LineContent = StlTraceParser::LineContent;
 
-    std::optional<LineContent> currentLine() const;
+    [[nodiscard]] LineContent* currentLine() const;
 
-    void parseTraceFile();
-    void swapBuffers();
+    void fetchBlock();
     void incrementLine();
 
     TraceType traceType;
-    bool storageEnabled;
     sc_core::sc_time playerPeriod;
     unsigned int defaultDataLength;
 
-    std::ifstream traceFile;
-    uint64_t currentParsedLine = 0;
-    uint64_t numberOfLines = 0;
-
-    std::array<std::vector<LineContent>, 2> lineBuffers;
-    std::size_t parseIndex = 0;
-    std::size_t consumeIndex = 1;
+    std::unique_ptr<StlTraceParser> parser;
 
-    std::vector<LineContent>::const_iterator readoutIt;
+    StlTraceParser::Block* block = nullptr;
+    std::size_t blockIndex = 0;
 
-    std::thread parserThread;
+    // Data of the last returned request, swapped with the data of its line
+    std::vector<uint8_t> requestData;
 };
 
 } // namespace DRAMSys::Initiators
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "StlTraceParser.h"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+namespace DRAMSys::Initiators
+{
+
+namespace
+{
+
+constexpr int DEC = 10;
+constexpr int HEX = 16;
+
+constexpr std::size_t DECOMPRESSION_BUFFER_SIZE = 1U << 20U;
+
+bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Removes the next whitespace-separated token from the line
+std::string_view nextToken(std::string_view& line)
+{
+    std::size_t begin = 0;
+    while (begin < line.size() && isSpace(line[begin]))
+        begin++;
+
+    std::size_t end = begin;
+    while (end < line.size() && !isSpace(line[end]))
+        end++;
+
+    std::string_view token = line.substr(begin, end - begin);
+    line.remove_prefix(end);
+    return token;
+}
+
+std::string_view stripHexPrefix(std::string_view token)
+{
+    if (token.size() >= 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X'))
+        token.remove_prefix(2);
+
+    return token;
+}
+
+// Parses the leading digits of the token, trailing characters like the colon are ignored
+template <typename T> T parseNumber(std::string_view token, int base)
+{
+    T value{};
+    auto [end, errorCode] = std::from_chars(token.data(), token.data() + token.size(), value, base);
+    if (errorCode != std::errc() || end == token.data())
+        throw std::runtime_error("Unable to parse number");
+
+    return value;
+}
+
+uint8_t parseHexDigit(char c)
+{
+    static constexpr uint8_t TEN = 10;
+
+    if (c >= '0' && c <= '9')
+        return static_cast<uint8_t>(c - '0');
+    if (c >= 'a' && c <= 'f')
+        return static_cast<uint8_t>(c - 'a' + TEN);
+    if (c >= 'A' && c <= 'F')
+        return static_cast<uint8_t>(c - 'A' + TEN);
+
+    throw std::runtime_error("Unable to parse data");
+}
+
+constexpr uint64_t BYTES_01 = 0x0101010101010101ULL;
+constexpr uint64_t BYTES_7F = 0x7F7F7F7F7F7F7F7FULL;
+constexpr uint64_t BYTES_80 = 0x8080808080808080ULL;
+
+// Sets the most significant bit of every byte of x that is strictly between low and high
+constexpr uint64_t bytesBetween(uint64_t x, uint64_t low, uint64_t high)
+{
+    uint64_t lower7 = x & BYTES_7F;
+    return (BYTES_01 * (127 + high) - lower7) & ~x & (lower7 + BYTES_01 * (127 - low)) & BYTES_80;
+}
+
+/**
+ * Decodes eight hex digits, which are loaded in little-endian order, into four bytes. The byte
+ * of the n-th digit pair is stored in the n-th 16 bit lane of the result. Returns false if one
+ * of the characters is not a hex digit.
+ */
+bool decodeHexDigits(uint64_t digits, uint64_t& lanes)
+{
+    uint64_t isDigit = bytesBetween(digits, '0' - 1, '9' + 1);
+    uint64_t isLetter =
+        bytesBetween(digits, 'A' - 1, 'F' + 1) | bytesBetween(digits, 'a' - 1, 'f' + 1);
+    if ((isDigit | isLetter) != BYTES_80)
+        return false;
+
+    // The low nibble of a letter is its value minus 9
+    uint64_t nibbles = (digits & (BYTES_01 * 0x0F)) + (isLetter >> 7U) * 9;
+
+    // The first digit of every pair is the high nibble
+    constexpr uint64_t LOW_BYTES = 0x00FF00FF00FF00FFULL;
+    lanes = ((nibbles & LOW_BYTES) << 4U) | ((nibbles >> 8U) & LOW_BYTES);
+    return true;
+}
+
+/**
+ * Decodes the hex digits of a data field into bytes, the last two digits form the first byte.
+ * Eight digits are decoded at once.
+ */
+void decodeHexData(std::string_view hex, uint8_t* data)
+{
+    constexpr std::size_t DIGITS_PER_STEP = 8;
+    constexpr std::size_t BYTES_PER_STEP = DIGITS_PER_STEP / 2;
+
+    std::size_t numberOfBytes = hex.size() / 2;
+    std::size_t offset = 0;
+
+    for (; offset + DIGITS_PER_STEP <= hex.size(); offset += DIGITS_PER_STEP)
+    {
+        uint64_t digits = 0;
+        for (std::size_t index = 0; index < DIGITS_PER_STEP; index++)
+            digits |= static_cast<uint64_t>(static_cast<uint8_t>(hex[offset + index]))
+                      << (8 * index);
+
+        uint64_t lanes = 0;
+        if (!decodeHexDigits(digits, lanes))
+            throw std::runtime_error("Unable to parse data");
+
+        // The digits describe the bytes in descending order
+        uint8_t* bytes = data + numberOfBytes - offset / 2 - BYTES_PER_STEP;
+        for (std::size_t index = 0; index < BYTES_PER_STEP; index++)
+            bytes[BYTES_PER_STEP - 1 - index] = static_cast<uint8_t>(lanes >> (16 * index));
+    }
+
+    for (; offset < hex.size(); offset += 2)
+    {
+        auto high = static_cast<unsigned>(parseHexDigit(hex[offset]));
+        auto low = static_cast<unsigned>(parseHexDigit(hex[offset + 1]));
+        data[numberOfBytes - offset / 2 - 1] = static_cast<uint8_t>(high << 4U | low);
+    }
+}
+
+} // namespace
+
+StlTraceParser::StlTraceParser(std::filesystem::path const& trace, bool storageEnabled) :
+    storageEnabled(storageEnabled),
+    ring(NUMBER_OF_BLOCKS)
+{
+    if (auto format = CompressedFile::getFormat(trace))
+    {
+        compressedFile = std::make_unique<CompressedFile>(trace.string(), *format);
+        inputSize = compressedFile->size();
+        buffer.resize(DECOMPRESSION_BUFFER_SIZE);
+    }
+    else
+    {
+        file = std::make_unique<MappedFile>(trace.string());
+        inputSize = file->size();
+    }
+
+    worker = std::thread(&StlTraceParser::run, this);
+}
+
+StlTraceParser::~StlTraceParser()
+{
+    stop = true;
+    notify(blockReleased);
+    worker.join();
+}
+
+StlTraceParser::Block* StlTraceParser::nextBlock()
+{
+    if (holdingBlock)
+    {
+        ring.pop();
+        holdingBlock = false;
+        notify(blockReleased);
+    }
+
+    Block* block = ring.front();
+    if (block == nullptr)
+    {
+        std::unique_lock lock(mutex);
+        blockPublished.wait(lock,
+                            [this, &block]()
+                            {
+                                block = ring.front();
+                                return block != nullptr ||
+                                       finished.load(std::memory_order_acquire);
+                            });
+    }
+
+    // The last block may have been published right before the parser finished
+    if (block == nullptr)
+        block = ring.front();
+
+    if (block == nullptr)
+    {
+        if (error)
+            std::rethrow_exception(error);
+
+        return nullptr;
+    }
+
+    holdingBlock = true;
+    consumedLines += block->size;
+    consumedBytes = block->endOffset;
+    return block;
+}
+
+uint64_t StlTraceParser::estimateNumberOfLines() const
+{
+    if (consumedBytes == 0 || consumedBytes == inputSize)
+        return consumedLines;
+
+    return static_cast<uint64_t>(static_cast<double>(consumedLines) *
+                                 static_cast<double>(inputSize) /
+                                 static_cast<double>(consumedBytes));
+}
+
+bool StlTraceParser::parseLine(std::string_view line, bool storageEnabled, LineContent& content)
+{
+    // If the line is empty (\n or \r\n) or starts with '#' (comment) the transaction is ignored.
+    if (line.size() <= 1 || line[0] == '#')
+        return false;
+
+    // Trace files MUST provide timestamp, command and address for every transaction. The data
+    // information depends on the storage mode configuration.
+    content.cycle = parseNumber<uint64_t>(nextToken(line), DEC);
+
+    // Get the optional burst length and command
+    std::string_view element = nextToken(line);
+    if (!element.empty() && element.front() == '(')
+    {
+        content.dataLength = parseNumber<unsigned>(element.substr(1), DEC);
+        element = nextToken(line);
+    }
+    else
+        content.dataLength.reset();
+
+    if (element == "read")
+        content.command = LineContent::Command::Read;
+    else if (element == "write")
+        content.command = LineContent::Command::Write;
+    else
+        throw std::runtime_error("Unable to parse command");
+
+    content.address = parseNumber<uint64_t>(stripHexPrefix(nextToken(line)), HEX);
+
+    content.data.clear();
+    if (storageEnabled && content.command == LineContent::Command::Write)
+    {
+        // The input trace file must provide the data to be stored into the memory.
+        element = nextToken(line);
+        if (element.size() < 2)
+            throw std::runtime_error("Missing data");
+
+        // We need two characters to represent 1 byte in hexadecimal. The first byte (LSB) is
+        // given by the last two characters, a leading odd digit after the 0x prefix is ignored.
+        std::size_t numberOfBytes = (element.size() - 2) / 2;
+        content.data.resize(numberOfBytes);
+        decodeHexData(element.substr(element.size() - 2 * numberOfBytes), content.data.data());
+    }
+
+    return true;
+}
+
+bool StlTraceParser::nextPart(std::string_view& part)
+{
+    if (compressedFile == nullptr)
+    {
+        // The whole mapping is a single part
+        if (partSize != 0 || file->size() == 0)
+            return false;
+
+        partSize = file->size();
+        part = file->view();
+        return true;
+    }
+
+    // Move the incomplete last line of the previous part to the front
+    std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(partSize),
+              buffer.begin() + static_cast<std::ptrdiff_t>(bufferSize),
+              buffer.begin());
+    bufferSize -= partSize;
+    partInputBegin = partInputEnd;
+
+    while (true)
+    {
+        // A single line does not fit into the buffer
+        if (bufferSize == buffer.size())
+            buffer.resize(2 * buffer.size());
+
+        std::size_t decompressed =
+            compressedFile->read(buffer.data() + bufferSize, buffer.size() - bufferSize);
+        bufferSize += decompressed;
+
+        std::string_view decompressedPart(buffer.data(), bufferSize);
+        std::size_t lastLineEnd = decompressedPart.rfind('\n');
+
+        if (decompressed == 0)
+            partSize = bufferSize;
+        else if (lastLineEnd != std::string_view::npos)
+            partSize = lastLineEnd + 1;
+        else
+            continue;
+
+        part = decompressedPart.substr(0, partSize);
+        partInputEnd = compressedFile->getOffset();
+        return partSize != 0;
+    }
+}
+
+std::size_t StlTraceParser::getInputOffset(std::size_t partOffset) const
+{
+    if (compressedFile == nullptr)
+        return partOffset;
+
+    if (partSize == 0)
+        return partInputEnd;
+
+    // The compressed bytes are assumed to be evenly distributed over the part
+    double fraction = static_cast<double>(partOffset) / static_cast<double>(partSize);
+    return partInputBegin +
+           static_cast<std::size_t>(fraction * static_cast<double>(partInputEnd - partInputBegin));
+}
+
+void StlTraceParser::run()
+{
+    std::string_view part;
+    std::size_t offset = 0;
+    bool partsLeft = true;
+    bool readingPart = false;
+    uint64_t lineNumber = 0;
+
+    try
+    {
+        while (partsLeft)
+        {
+            Block* block = ring.tryAcquire();
+            if (block == nullptr)
+            {
+                std::unique_lock lock(mutex);
+                blockReleased.wait(lock,
+                                   [this, &block]()
+                                   {
+                                       block = ring.tryAcquire();
+                                       return block != nullptr || stop;
+                                   });
+            }
+
+            if (stop)
+                return;
+
+            block->size = 0;
+            while (block->size < BLOCK_SIZE)
+            {
+                if (offset == part.size())
+                {
+                    readingPart = true;
+                    partsLeft = nextPart(part);
+                    readingPart = false;
+
+                    if (!partsLeft)
+                        break;
+
+                    offset = 0;
+                }
+
+                std::size_t end = std::min(part.find('\n', offset), part.size());
+                std::string_view line = part.substr(offset, end - offset);
+                offset = std::min(end + 1, part.size());
+                lineNumber++;
+
+                if (block->size == block->lines.size())
+                    block->lines.emplace_back();
+
+                if (parseLine(line, storageEnabled, block->lines[block->size]))
+                    block->size++;
+            }
+
+            block->endOffset = getInputOffset(offset);
+            if (block->size > 0)
+            {
+                ring.publish();
+                notify(blockPublished);
+            }
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        // Errors of the decompression are passed on unchanged
+        if (readingPart)
+            error = std::current_exception();
+        else
+            error = std::make_exception_ptr(std::runtime_error(
+                "Malformed trace file line " + std::to_string(lineNumber) + "."));
+    }
+    catch (...)
+    {
+        // Other errors, e.g. a failed allocation, must not escape the thread either
+        error = std::current_exception();
+    }
+
+    finished.store(true, std::memory_order_release);
+    notify(blockPublished);
+}
+
+void StlTraceParser::notify(std::condition_variable& condition)
+{
+    // Taking the lock orders the notification after the predicate check of a waiting thread
+    {
+        std::lock_guard lock(mutex);
+    }
+    condition.notify_one();
+}
+
+} // namespace DRAMSys::Initiators
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#pragma once
+
+#include <DRAMSys/common/CompressedFile.h>
+#include <DRAMSys/common/MappedFile.h>
+#include <DRAMSys/common/SpscRing.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace DRAMSys::Initiators
+{
+
+/**
+ * @brief Parser for STL traces (.stl and .rstl) that runs on one persistent background thread.
+ *
+ * The trace is memory-mapped and tokenized in place. Compressed traces (.gz, .zst) are
+ * decompressed by the same thread into a reused buffer right before they are parsed, so that no
+ * temporary files are required. The parsed lines are handed over to the consumer in blocks
+ * through a lock-free ring, both sides only sleep if the ring is full or empty. The blocks and
+ * the data vectors of their lines are reused, so that the parser does not allocate once the
+ * ring is warmed up.
+ */
+class StlTraceParser
+{
+public:
+    struct LineContent
+    {
+        uint64_t cycle{};
+        enum class Command : uint8_t
+        {
+            Read,
+            Write
+        } command{};
+        uint64_t address{};
+        std::optional<unsigned> dataLength;
+        std::vector<uint8_t> data;
+    };
+
+    struct Block
+    {
+        // Only the first size lines are valid, the others are kept for their data buffers
+        std::vector<LineContent> lines;
+        std::size_t size = 0;
+
+        // Offset behind the last parsed line in the trace, in compressed bytes for compressed
+        // traces
+        std::size_t endOffset = 0;
+    };
+
+    static constexpr std::size_t BLOCK_SIZE = 10000;
+    static constexpr std::size_t NUMBER_OF_BLOCKS = 4;
+
+    /**
+     * Throws std::runtime_error if the trace cannot be opened.
+     */
+    StlTraceParser(std::filesystem::path const& trace, bool storageEnabled);
+    StlTraceParser(const StlTraceParser&) = delete;
+    StlTraceParser(StlTraceParser&&) = delete;
+    StlTraceParser& operator=(const StlTraceParser&) = delete;
+    StlTraceParser& operator=(StlTraceParser&&) = delete;
+    ~StlTraceParser();
+
+    /**
+     * Releases the previously returned block and returns the next one, which stays valid until
+     * the next call. Returns nullptr at the end of the trace. Throws std::runtime_error if a
+     * line of the trace is malformed, other errors of the parser thread are rethrown as well.
+     *
+     * The consumer may take over the data vectors of the lines by swapping them with its own
+     * vectors, whose capacity is then reused by the parser.
+     */
+    Block* nextBlock();
+
+    /**
+     * Returns the exact number of lines once the whole trace has been consumed, otherwise an
+     * estimate that is extrapolated from the average (compressed) length of the consumed lines.
+     */
+    [[nodiscard]] uint64_t estimateNumberOfLines() const;
+
+    /**
+     * Parses one line of the trace into content. Returns false for empty lines and comments,
+     * which do not describe a request. Throws std::runtime_error if the line is malformed.
+     */
+    static bool parseLine(std::string_view line, bool storageEnabled, LineContent& content);
+
+private:
+    void run();
+    void notify(std::condition_variable& condition);
+
+    /**
+     * Provides the next part of the trace, which only contains complete lines. Returns false at
+     * the end of the trace.
+     */
+    bool nextPart(std::string_view& part);
+
+    // Offset in the trace behind the given offset in the current part
+    [[nodiscard]] std::size_t getInputOffset(std::size_t partOffset) const;
+
+    const bool storageEnabled;
+    std::unique_ptr<MappedFile> file;
+    std::unique_ptr<CompressedFile> compressedFile;
+    std::size_t inputSize;
+
+    // Decompressed part of a compressed trace, the incomplete last line is kept for the next part
+    std::vector<char> buffer;
+    std::size_t bufferSize = 0;
+    std::size_t partSize = 0;
+
+    // Range of compressed bytes that the current part was decompressed from
+    std::size_t partInputBegin = 0;
+    std::size_t partInputEnd = 0;
+
+    SpscRing<Block> ring;
+    bool holdingBlock = false;
+    uint64_t consumedLines = 0;
+    std::size_t consumedBytes = 0;
+
+    std::mutex mutex;
+    std::condition_variable blockPublished;
+    std::condition_variable blockReleased;
+    std::atomic<bool> finished{false};
+    std::atomic<bool> stop{false};
+    std::exception_ptr error;
+
+    std::thread worker;
+};
+
+} // namespace DRAMSys::Initiators
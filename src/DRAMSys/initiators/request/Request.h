@@ -35,12 +35,16 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <vector>
 
 namespace DRAMSys::Initiators
 {
 
+/**
+ * The data of a write request is not part of the request, it is written by the producer directly
+ * into the data buffer of the payload, see RequestProducer::writeData().
+ */
 struct Request
 {
     enum class Command : uint8_t
@@ -51,7 +55,6 @@ struct Request
     } command;
     uint64_t address = 0;
     std::size_t length = 0;
-    std::vector<unsigned char> data;
 };
 
 } // namespace DRAMSys::Initiators
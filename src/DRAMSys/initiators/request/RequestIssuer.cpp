@@ -93,7 +93,9 @@ void RequestIssuer::sendNextRequest()
         payload->set_command(request.command == Request::Command::Read ? tlm::TLM_READ_COMMAND
                                                                        : tlm::TLM_WRITE_COMMAND);
 
-        std::copy(request.data.cbegin(), request.data.cend(), payload->get_data_ptr());
+        // The data buffer is only allocated if the storage is enabled
+        if (request.command == Request::Command::Write && payload->get_data_ptr() != nullptr)
+            producer->writeData(payload->get_data_ptr(), request.length);
 
         tlm::tlm_phase phase = tlm::BEGIN_REQ;
         sc_core::sc_time delay = sc_core::SC_ZERO_TIME;
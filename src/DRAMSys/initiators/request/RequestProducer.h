@@ -55,6 +55,17 @@ public:
     virtual ~RequestProducer() = default;
 
     virtual Request nextRequest() = 0;
+
+    /**
+     * Writes the data of the write request that was returned by the last call of nextRequest()
+     * into the pooled data buffer of its payload. Only called if the storage is enabled.
+     * Producers without data leave the buffer untouched.
+     */
+    virtual void writeData([[maybe_unused]] unsigned char* data,
+                           [[maybe_unused]] std::size_t length)
+    {
+    }
+
     virtual sc_core::sc_time nextTrigger() = 0;
     virtual uint64_t totalRequests() = 0;
     virtual void reset() {};
@@ -38,12 +38,14 @@
 #include "DRAMSys/power/DRAMPowerAdapter.h"
 #include "DRAMSys/common/DebugManager.h"
 #include "DRAMSys/common/TlmRecorder.h"
+#include "DRAMSys/common/WorkerPool.h"
 #include "DRAMSys/power/DRAMPowerVariant.h"
 
 #include <DRAMPower/command/Command.h>
 #include <DRAMPower/simconfig/simconfig.h>
 #include <DRAMUtils/util/types.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <type_traits>
@@ -55,14 +57,18 @@ DRAMPowerAdapter::DRAMPowerAdapter(const sc_core::sc_module_name& name,
                                    DRAMPowerVariant DRAMPower,
                                    const SimConfig& simConfig,
                                    const MemSpec& memSpec,
-                                   TlmRecorder* tlmRecorder) :
+                                   TlmRecorder* tlmRecorder,
+                                   WorkerPool* workerPool,
+                                   std::size_t workerLane) :
     sc_module(name),
     tCK(memSpec.tCK),
     groupsPerRank(memSpec.groupsPerRank),
     banksPerGroup(memSpec.banksPerGroup),
     tlmRecorder(tlmRecorder),
     powerWindowSize(memSpec.tCK * simConfig.windowSize),
-    DRAMPower(std::move(DRAMPower))
+    DRAMPower(std::move(DRAMPower)),
+    workerPool(workerPool),
+    workerLane(workerLane)
 {
     assert(simConfig.powerAnalysis && "DRAMPowerObject created for simConfig.powerAnalysis=false");
 
@@ -70,6 +76,12 @@ DRAMPowerAdapter::DRAMPowerAdapter(const sc_core::sc_module_name& name,
         SC_THREAD(powerWindow);
 }
 
+DRAMPowerAdapter::~DRAMPowerAdapter()
+{
+    // The worker must not access the adapter after its destruction
+    synchronize();
+}
+
 const DRAMPowerVariant& DRAMPowerAdapter::getDRAMPowerVariant() const
 {
     return DRAMPower;
@@ -77,6 +89,8 @@ const DRAMPowerVariant& DRAMPowerAdapter::getDRAMPowerVariant() const
 
 void DRAMPowerAdapter::reportPower()
 {
+    synchronize();
+
     double coreEnergy = 0;
     double interfaceEnergy = 0;
     double energy = 0;
@@ -118,18 +132,81 @@ void DRAMPowerAdapter::handleTransaction(std::size_t channel,
                                          const sc_core::sc_time& delay)
 {
     assert(phase >= BEGIN_RD && phase <= END_SREF);
-    std::visit([channel, &trans, &phase, &delay](auto& var) {
-        return var.doCommand(channel, trans, phase, delay);
+
+    if (workerPool == nullptr)
+    {
+        std::visit([channel, &trans, &phase, &delay](auto& var) {
+            return var.doCommand(channel, trans, phase, delay);
+        }, DRAMPower);
+        return;
+    }
+
+    const unsigned char* data = trans.get_data_ptr();
+    std::size_t dataLength = data != nullptr ? trans.get_data_length() : 0;
+
+    // The data storage of a batch is never reallocated because the commands point into it
+    if (pendingBatch != nullptr && (pendingBatch->commands.size() == BATCHSIZE ||
+                                    pendingBatch->data.size() + dataLength >
+                                        pendingBatch->data.capacity()))
+        submitPendingBatch();
+
+    if (pendingBatch == nullptr)
+    {
+        pendingBatch = std::make_shared<CommandBatch>();
+        pendingBatch->commands.reserve(BATCHSIZE);
+        pendingBatch->data.reserve(std::max(BATCHDATASIZE, dataLength));
+    }
+
+    const uint8_t* dataCopy = nullptr;
+    if (data != nullptr)
+    {
+        dataCopy = pendingBatch->data.data() + pendingBatch->data.size();
+        pendingBatch->data.insert(pendingBatch->data.end(), data, data + dataLength);
+    }
+
+    // The command is created on the simulation thread because it depends on the current time
+    std::visit([this, &trans, &phase, &delay, dataCopy](const auto& var) {
+        pendingBatch->commands.push_back(var.createCommand(trans, phase, delay, dataCopy));
     }, DRAMPower);
 }
 
+void DRAMPowerAdapter::submitPendingBatch()
+{
+    workerPool->submit(workerLane,
+                       [this, batch = std::move(pendingBatch)]()
+                       {
+                           std::visit(
+                               [&batch](auto& var)
+                               {
+                                   for (const auto& command : batch->commands)
+                                       var.doCommand(command);
+                               },
+                               DRAMPower);
+                       });
+    pendingBatch = nullptr;
+}
+
+void DRAMPowerAdapter::synchronize()
+{
+    if (workerPool == nullptr)
+        return;
+
+    if (pendingBatch != nullptr)
+        submitPendingBatch();
+
+    workerPool->wait(workerLane);
+}
+
 void DRAMPowerAdapter::serialize(std::ostream& stream) const
 {
+    // Commands that are still pending are part of the serialized state
+    const_cast<DRAMPowerAdapter*>(this)->synchronize();
     std::visit([&stream](auto& var) { var.serialize(stream); }, DRAMPower);
 }
 
 void DRAMPowerAdapter::deserialize(std::istream& stream)
 {
+    synchronize();
     std::visit([&stream](auto& var) { var.deserialize(stream); }, DRAMPower);
 }
 
@@ -148,6 +225,8 @@ void DRAMPowerAdapter::powerWindow()
 
         clkCycles = std::lround(sc_core::sc_time_stamp() / tCK);
 
+        synchronize();
+
         std::visit([&currentEnergy, &clkCycles](auto& var)
                    { currentEnergy = var.getTotalEnergy(clkCycles); },
                    DRAMPower);
@@ -44,20 +44,27 @@
 #include "DRAMSys/simulation/SimConfig.h"
 
 #include <DRAMPower/command/CmdType.h>
+#include <DRAMPower/command/Command.h>
 #include <DRAMPower/dram/dram_base.h>
 
+#include <memory>
 #include <systemc>
 #include <tlm>
+#include <vector>
 
 namespace DRAMSys
 {
 
+class WorkerPool;
+
 class DRAMPowerAdapter : public sc_core::sc_module, public Serialize, public Deserialize
 {
 private:
     static constexpr double MINENERGYPERWINDOW = 1e-15;
     static constexpr unsigned char BITSPERBYTE = 8;
     static constexpr int FLOATPRECISION = 6;
+    static constexpr std::size_t BATCHSIZE = 1024;
+    static constexpr std::size_t BATCHDATASIZE = BATCHSIZE * 64;
 
     sc_core::sc_time tCK;
     uint64_t groupsPerRank;
@@ -69,6 +76,23 @@ private:
 
     DRAMPowerVariant DRAMPower;
 
+    // If a worker pool is provided, the commands are collected in batches and passed to
+    // DRAMPower on a worker thread. Every access to the DRAMPower results synchronizes with the
+    // worker first, so the results are identical to the sequential processing.
+    WorkerPool* const workerPool;
+    const std::size_t workerLane;
+
+    struct CommandBatch
+    {
+        std::vector<DRAMPower::Command> commands;
+        // Copy of the payload data, the payloads are reused after the transaction has finished
+        std::vector<uint8_t> data;
+    };
+    std::shared_ptr<CommandBatch> pendingBatch;
+
+    void submitPendingBatch();
+    void synchronize();
+
     // This Thread is only triggered when Power Simulation is enabled.
     // It estimates the current average power which will be stored in the trace database for
     // visualization purposes.
@@ -84,13 +108,15 @@ public:
                      DRAMPowerVariant DRAMPower,
                      const SimConfig& simConfig,
                      const MemSpec& memSpec,
-                     TlmRecorder* tlmRecorder);
+                     TlmRecorder* tlmRecorder,
+                     WorkerPool* workerPool,
+                     std::size_t workerLane);
 
     DRAMPowerAdapter(const DRAMPowerAdapter&) = delete;
     DRAMPowerAdapter(DRAMPowerAdapter&&) = delete;
     DRAMPowerAdapter& operator=(const DRAMPowerAdapter&) = delete;
     DRAMPowerAdapter& operator=(DRAMPowerAdapter&&) = delete;
-    ~DRAMPowerAdapter() override = default;
+    ~DRAMPowerAdapter() override;
 
     void reportPower();
     const DRAMPowerVariant& getDRAMPowerVariant() const;
@@ -50,6 +50,14 @@ public:
                      const tlm::tlm_generic_payload& trans,
                      const tlm::tlm_phase& phase,
                      const sc_core::sc_time& delay) {
+        doCommand(createCommand(trans, phase, delay, trans.get_data_ptr()));
+    }
+
+    // The data is passed separately so that the command can refer to a copy of the payload data
+    [[nodiscard]] DRAMPower::Command createCommand(const tlm::tlm_generic_payload& trans,
+                                                   const tlm::tlm_phase& phase,
+                                                   const sc_core::sc_time& delay,
+                                                   const uint8_t* data) const {
         auto rank =
             static_cast<std::size_t>(ControllerExtension::getRank(trans)); // relative to the channel
         auto bank_group_abs = static_cast<std::size_t>(
@@ -69,11 +77,10 @@ public:
         DRAMPower::TargetCoordinate target(bank, bank_group, rank, row, column);
 
         // TODO read, write data for interface calculation
-        uint8_t* data = trans.get_data_ptr();                  // Can be nullptr if no data
+        // data can be nullptr if no data
         auto datasize = trans.get_data_length() * 8; // Is always set
 
-        DRAMPower::Command command(cycle, phaseToDRAMPowerCommand(phase), target, data, datasize);
-        doCommand(command);
+        return DRAMPower::Command(cycle, phaseToDRAMPowerCommand(phase), target, data, datasize);
     }
 
     void getWindowStats(DRAMPower::timestamp_t timestamp, DRAMPower::SimulationStats& stats) {
@@ -105,8 +105,8 @@ void Arbiter::end_of_elaboration()
 
     // channel side
     channelIsBusy = ControllerVector<Channel, bool>(iSocket.size(), false);
-    pendingRequestsOnChannel = ControllerVector<Channel, std::queue<tlm_generic_payload*>>(
-        iSocket.size(), std::queue<tlm_generic_payload*>());
+    pendingRequestsOnChannel = ControllerVector<Channel, RingBuffer<tlm_generic_payload*>>(
+        iSocket.size(), RingBuffer<tlm_generic_payload*>());
     nextChannelPayloadIDToAppend = ControllerVector<Channel, std::uint64_t>(iSocket.size(), 1);
 
     numberOfRequestsPerThread.resize(tSocket.size(), 0);
@@ -115,6 +115,10 @@ void Arbiter::end_of_elaboration()
     stats.numberOfRequestsPerThread.values.resize(tSocket.size());
     stats.averageBandwidthPerThread.values.resize(tSocket.size());
     stats.averageBandwidthPerChannel.values.resize(iSocket.size());
+    stats.requestLatencyPerThread.resize(tSocket.size());
+    stats.requestLatencyPerChannel.resize(iSocket.size());
+    stats.queueingDelayPerChannel.resize(iSocket.size());
+    stats.responseDelayPerThread.resize(tSocket.size());
 }
 
 void ArbiterSimple::end_of_elaboration()
@@ -122,8 +126,8 @@ void ArbiterSimple::end_of_elaboration()
     Arbiter::end_of_elaboration();
 
     // initiator side
-    pendingResponsesOnThread = ControllerVector<Thread, std::queue<tlm_generic_payload*>>(
-        tSocket.size(), std::queue<tlm_generic_payload*>());
+    pendingResponsesOnThread = ControllerVector<Thread, RingBuffer<tlm_generic_payload*>>(
+        tSocket.size(), RingBuffer<tlm_generic_payload*>());
 }
 
 void ArbiterFifo::end_of_elaboration()
@@ -134,8 +138,8 @@ void ArbiterFifo::end_of_elaboration()
     activeTransactionsOnThread = ControllerVector<Thread, unsigned int>(tSocket.size(), 0);
     outstandingEndReqOnThread =
         ControllerVector<Thread, tlm_generic_payload*>(tSocket.size(), nullptr);
-    pendingResponsesOnThread = ControllerVector<Thread, std::queue<tlm_generic_payload*>>(
-        tSocket.size(), std::queue<tlm_generic_payload*>());
+    pendingResponsesOnThread = ControllerVector<Thread, RingBuffer<tlm_generic_payload*>>(
+        tSocket.size(), RingBuffer<tlm_generic_payload*>());
 
     lastEndReqOnChannel = ControllerVector<Channel, sc_time>(iSocket.size(), sc_max_time());
     lastEndRespOnThread = ControllerVector<Thread, sc_time>(tSocket.size(), sc_max_time());
@@ -192,6 +196,9 @@ tlm_sync_enum Arbiter::nb_transport_bw([[maybe_unused]] int id,
                                        tlm_phase& phase,
                                        sc_time& bwDelay)
 {
+    if (phase == BEGIN_RESP)
+        ArbiterExtension::setTimeOfResponse(payload, sc_time_stamp() + bwDelay);
+
     PRINTDEBUGMESSAGE(name(),
                       "[bw] " + getPhaseName(phase) + " notification in " + bwDelay.to_string());
     payloadEventQueue.notify(payload, phase, bwDelay);
@@ -233,6 +240,7 @@ void ArbiterSimple::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& c
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = arbitrationDelayFw;
 
+            recordRequestForwarded(cbTrans, tDelay);
             iSocket[static_cast<int>(channel)]->nb_transport_fw(cbTrans, tPhase, tDelay);
             bytesPerChannel[static_cast<std::size_t>(channel)] += cbTrans.get_data_length();
         }
@@ -256,6 +264,7 @@ void ArbiterSimple::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& c
             // do not send two requests in the same cycle
             sc_time tDelay = tCK + arbitrationDelayFw;
 
+            recordRequestForwarded(tPayload, tDelay);
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
             bytesPerChannel[static_cast<std::size_t>(channel)] += cbTrans.get_data_length();
         }
@@ -269,6 +278,7 @@ void ArbiterSimple::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& c
             tlm_phase tPhase = BEGIN_RESP;
             sc_time tDelay = arbitrationDelayBw;
 
+            recordResponseForwarded(cbTrans, tDelay);
             tlm_sync_enum returnValue =
                 tSocket[static_cast<int>(thread)]->nb_transport_bw(cbTrans, tPhase, tDelay);
             if (returnValue == TLM_UPDATED || returnValue == TLM_COMPLETED)
@@ -300,6 +310,7 @@ void ArbiterSimple::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& c
             // do not send two responses in the same cycle
             sc_time tDelay = tCK + arbitrationDelayBw;
 
+            recordResponseForwarded(tPayload, tDelay);
             tlm_sync_enum returnValue =
                 tSocket[static_cast<int>(thread)]->nb_transport_bw(tPayload, tPhase, tDelay);
             if (returnValue == TLM_UPDATED || returnValue == TLM_COMPLETED)
@@ -351,6 +362,7 @@ void ArbiterFifo::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& cbP
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = tCK;
 
+            recordRequestForwarded(tPayload, tDelay);
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
         }
         else
@@ -397,6 +409,7 @@ void ArbiterFifo::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& cbP
             tlm_phase tPhase = BEGIN_RESP;
             sc_time tDelay = tCK;
 
+            recordResponseForwarded(tPayload, tDelay);
             tlm_sync_enum returnValue =
                 tSocket[static_cast<int>(thread)]->nb_transport_bw(tPayload, tPhase, tDelay);
             // Early completion from initiator
@@ -423,6 +436,7 @@ void ArbiterFifo::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& cbP
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = lastEndReqOnChannel[channel] == sc_time_stamp() ? tCK : SC_ZERO_TIME;
 
+            recordRequestForwarded(tPayload, tDelay);
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
             bytesPerChannel[static_cast<std::size_t>(channel)] += cbTrans.get_data_length();
         }
@@ -440,6 +454,7 @@ void ArbiterFifo::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase& cbP
             tlm_phase tPhase = BEGIN_RESP;
             sc_time tDelay = lastEndRespOnThread[thread] == sc_time_stamp() ? tCK : SC_ZERO_TIME;
 
+            recordResponseForwarded(tPayload, tDelay);
             tlm_sync_enum returnValue =
                 tSocket[static_cast<int>(thread)]->nb_transport_bw(tPayload, tPhase, tDelay);
             // Early completion from initiator
@@ -490,6 +505,7 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
             tlm_phase tPhase = BEGIN_REQ;
             sc_time tDelay = tCK;
 
+            recordRequestForwarded(tPayload, tDelay);
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
         }
         else
@@ -539,6 +555,7 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
             tlm_phase tPhase = BEGIN_RESP;
             sc_time tDelay = tCK;
 
+            recordResponseForwarded(tPayload, tDelay);
             tlm_sync_enum returnValue =
                 tSocket[static_cast<int>(thread)]->nb_transport_bw(tPayload, tPhase, tDelay);
             // Early completion from initiator
@@ -566,6 +583,7 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
             sc_time tDelay = lastEndReqOnChannel[channel] == sc_time_stamp() ? tCK : SC_ZERO_TIME;
             bytesPerChannel[static_cast<std::size_t>(channel)] += cbTrans.get_data_length();
 
+            recordRequestForwarded(tPayload, tDelay);
             iSocket[static_cast<int>(channel)]->nb_transport_fw(tPayload, tPhase, tDelay);
         }
     }
@@ -588,6 +606,7 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
                 sc_time tDelay =
                     lastEndRespOnThread[thread] == sc_time_stamp() ? tCK : SC_ZERO_TIME;
 
+                recordResponseForwarded(tPayload, tDelay);
                 tlm_sync_enum returnValue =
                     tSocket[static_cast<int>(thread)]->nb_transport_bw(tPayload, tPhase, tDelay);
                 // Early completion from initiator
@@ -604,6 +623,28 @@ void ArbiterReorder::peqCallback(tlm_generic_payload& cbTrans, const tlm_phase&
         SC_REPORT_FATAL(0, "Payload event queue in arbiter was triggered with unknown phase");
 }
 
+void Arbiter::recordRequestForwarded(const tlm_generic_payload& trans, const sc_time& delay)
+{
+    auto channel = static_cast<std::size_t>(ArbiterExtension::getChannel(trans));
+    sc_time queueingDelay =
+        sc_time_stamp() + delay - ArbiterExtension::getTimeOfGeneration(trans);
+    stats.queueingDelayPerChannel.histograms[channel].record(queueingDelay.value());
+}
+
+void Arbiter::recordResponseForwarded(const tlm_generic_payload& trans, const sc_time& delay)
+{
+    const ArbiterExtension& extension = ArbiterExtension::getExtension(trans);
+    auto thread = static_cast<std::size_t>(extension.getThread());
+    auto channel = static_cast<std::size_t>(extension.getChannel());
+
+    sc_time timeOfForwarding = sc_time_stamp() + delay;
+    uint64_t latency = (timeOfForwarding - extension.getTimeOfGeneration()).value();
+    stats.requestLatencyPerThread.histograms[thread].record(latency);
+    stats.requestLatencyPerChannel.histograms[channel].record(latency);
+    stats.responseDelayPerThread.histograms[thread].record(
+        (timeOfForwarding - extension.getTimeOfResponse()).value());
+}
+
 void Arbiter::updateStats()
 {
     for (std::size_t i = 0; i < tSocket.size(); i++)
@@ -619,6 +660,10 @@ void Arbiter::updateStats()
         stats.averageBandwidthPerChannel.values[i] =
             static_cast<double>(bytesPerChannel[i]) / sc_core::sc_time_stamp().to_seconds();
     }
+
+    stats.requestLatency.histogram.reset();
+    for (auto const& histogram : stats.requestLatencyPerChannel.histograms)
+        stats.requestLatency.histogram.merge(histogram);
 }
 
 void Arbiter::resetStats()
@@ -626,6 +671,16 @@ void Arbiter::resetStats()
     numberOfRequestsPerThread.assign(numberOfRequestsPerThread.size(), 0);
     bytesPerThread.assign(bytesPerThread.size(), 0);
     bytesPerChannel.assign(bytesPerChannel.size(), 0);
+
+    stats.requestLatency.histogram.reset();
+    for (auto* stat : {&stats.requestLatencyPerThread,
+                       &stats.requestLatencyPerChannel,
+                       &stats.queueingDelayPerChannel,
+                       &stats.responseDelayPerThread})
+    {
+        for (auto& histogram : stat->histograms)
+            histogram.reset();
+    }
 }
 
 } // namespace DRAMSys
@@ -40,6 +40,7 @@
 #ifndef ARBITER_H
 #define ARBITER_H
 
+#include "DRAMSys/common/RingBuffer.h"
 #include "DRAMSys/common/dramExtensions.h"
 #include "DRAMSys/controller/McConfig.h"
 #include "DRAMSys/simulation/AddressDecoder.h"
@@ -49,7 +50,6 @@
 #include "DRAMSys/statistics/StatProvider.h"
 
 #include <cstdint>
-#include <queue>
 #include <set>
 #include <sysc/kernel/sc_simcontext.h>
 #include <systemc>
@@ -92,7 +92,7 @@ protected:
     ControllerVector<Thread, bool> threadIsBusy;
     ControllerVector<Channel, bool> channelIsBusy;
 
-    ControllerVector<Channel, std::queue<tlm::tlm_generic_payload*>> pendingRequestsOnChannel;
+    ControllerVector<Channel, RingBuffer<tlm::tlm_generic_payload*>> pendingRequestsOnChannel;
 
     ControllerVector<Thread, std::uint64_t> nextThreadPayloadIDToAppend;
     ControllerVector<Channel, std::uint64_t> nextChannelPayloadIDToAppend;
@@ -118,11 +118,23 @@ protected:
     std::vector<uint64_t> bytesPerThread;
     std::vector<uint64_t> bytesPerChannel;
 
+    // Called right before a request is forwarded to the memory controller
+    void recordRequestForwarded(const tlm::tlm_generic_payload& trans,
+                                const sc_core::sc_time& delay);
+    // Called right before a response is forwarded to the initiator
+    void recordResponseForwarded(const tlm::tlm_generic_payload& trans,
+                                 const sc_core::sc_time& delay);
+
     struct Stats : public Statistics::Group
     {
         Statistics::VectorStat &numberOfRequestsPerThread;
         Statistics::VectorStat &averageBandwidthPerThread;
         Statistics::VectorStat &averageBandwidthPerChannel;
+        Statistics::HistogramStat &requestLatency;
+        Statistics::HistogramVectorStat &requestLatencyPerThread;
+        Statistics::HistogramVectorStat &requestLatencyPerChannel;
+        Statistics::HistogramVectorStat &queueingDelayPerChannel;
+        Statistics::HistogramVectorStat &responseDelayPerThread;
 
         Stats(Arbiter& arbiter) :
             Group(arbiter.basename()),
@@ -137,7 +149,32 @@ protected:
             averageBandwidthPerChannel(addStat<Statistics::VectorStat>(
                 "AverageBandwidthPerChannel",
                 "Average bandwidth over simulation duration per channel",
-                Statistics::Quantity::Bandwidth))
+                Statistics::Quantity::Bandwidth)),
+            requestLatency(addStat<Statistics::HistogramStat>(
+                "RequestLatency",
+                "Latency from the acceptance of a request until its response is sent",
+                Statistics::Quantity::Time,
+                sc_core::sc_get_time_resolution().to_seconds())),
+            requestLatencyPerThread(addStat<Statistics::HistogramVectorStat>(
+                "RequestLatencyPerThread",
+                "Latency from the acceptance of a request until its response is sent per thread",
+                Statistics::Quantity::Time,
+                sc_core::sc_get_time_resolution().to_seconds())),
+            requestLatencyPerChannel(addStat<Statistics::HistogramVectorStat>(
+                "RequestLatencyPerChannel",
+                "Latency from the acceptance of a request until its response is sent per channel",
+                Statistics::Quantity::Time,
+                sc_core::sc_get_time_resolution().to_seconds())),
+            queueingDelayPerChannel(addStat<Statistics::HistogramVectorStat>(
+                "QueueingDelayPerChannel",
+                "Delay from the acceptance of a request until it is forwarded to the controller",
+                Statistics::Quantity::Time,
+                sc_core::sc_get_time_resolution().to_seconds())),
+            responseDelayPerThread(addStat<Statistics::HistogramVectorStat>(
+                "ResponseDelayPerThread",
+                "Delay from the arrival of a response until it is forwarded to the initiator",
+                Statistics::Quantity::Time,
+                sc_core::sc_get_time_resolution().to_seconds()))
         {
         }
     } stats;
@@ -156,7 +193,7 @@ private:
     void end_of_elaboration() override;
     void peqCallback(tlm::tlm_generic_payload& cbTrans, const tlm::tlm_phase& phase) override;
 
-    ControllerVector<Thread, std::queue<tlm::tlm_generic_payload*>> pendingResponsesOnThread;
+    ControllerVector<Thread, RingBuffer<tlm::tlm_generic_payload*>> pendingResponsesOnThread;
 };
 
 class ArbiterFifo final : public Arbiter
@@ -176,7 +213,7 @@ private:
     const unsigned maxActiveTransactionsPerThread;
 
     ControllerVector<Thread, tlm::tlm_generic_payload*> outstandingEndReqOnThread;
-    ControllerVector<Thread, std::queue<tlm::tlm_generic_payload*>> pendingResponsesOnThread;
+    ControllerVector<Thread, RingBuffer<tlm::tlm_generic_payload*>> pendingResponsesOnThread;
 
     ControllerVector<Channel, sc_core::sc_time> lastEndReqOnChannel;
     ControllerVector<Thread, sc_core::sc_time> lastEndRespOnThread;
@@ -52,7 +52,30 @@ SimConfig::SimConfig(const Config::SimConfig& simConfig) :
     simulationProgressBar(
         simConfig.SimulationProgressBar.value_or(DEFAULT_SIMULATION_PROGRESS_BAR)),
     addressOffset(simConfig.AddressOffset.value_or(DEFAULT_ADDRESS_OFFSET)),
-    togglingRate(simConfig.TogglingRate)
+    togglingRate(simConfig.TogglingRate),
+    workerThreads(simConfig.WorkerThreads.value_or(DEFAULT_WORKER_THREADS)),
+    recordingBatchSize(simConfig.RecordingBatchSize.value_or(DEFAULT_RECORDING_BATCH_SIZE)),
+    recordingQueueDepth(simConfig.RecordingQueueDepth.value_or(DEFAULT_RECORDING_QUEUE_DEPTH)),
+    recordingWriterThreads(
+        simConfig.RecordingWriterThreads.value_or(DEFAULT_RECORDING_WRITER_THREADS)),
+    recordingBulkLoad(simConfig.RecordingBulkLoad.value_or(DEFAULT_RECORDING_BULK_LOAD)),
+    recordingFormat(simConfig.RecordingFormat.value_or(DEFAULT_RECORDING_FORMAT)),
+    recordingTimeWindows(simConfig.RecordingTimeWindows.value_or(
+        std::vector<std::pair<double, double>>{})),
+    recordingChannels(simConfig.RecordingChannels.value_or(std::vector<unsigned int>{})),
+    recordingThreads(simConfig.RecordingThreads.value_or(std::vector<unsigned int>{})),
+    recordingSampleInterval(
+        simConfig.RecordingSampleInterval.value_or(DEFAULT_RECORDING_SAMPLE_INTERVAL)),
+    recordingHistoryLength(
+        simConfig.RecordingHistoryLength.value_or(DEFAULT_RECORDING_HISTORY_LENGTH)),
+    recordingPostTriggerLength(
+        simConfig.RecordingPostTriggerLength.value_or(DEFAULT_RECORDING_POST_TRIGGER_LENGTH)),
+    recordingTriggerLatency(
+        simConfig.RecordingTriggerLatency.value_or(DEFAULT_RECORDING_TRIGGER_LATENCY)),
+    recordingTriggerBufferDepth(
+        simConfig.RecordingTriggerBufferDepth.value_or(DEFAULT_RECORDING_TRIGGER_BUFFER_DEPTH)),
+    recordingTriggerForcedRefresh(simConfig.RecordingTriggerForcedRefresh.value_or(
+        DEFAULT_RECORDING_TRIGGER_FORCED_REFRESH))
 {
     if (simConfig.StoreMode.has_value())
     {
@@ -69,6 +92,38 @@ SimConfig::SimConfig(const Config::SimConfig& simConfig) :
         SC_REPORT_FATAL(
             "SimConfig",
             "Toggling rates for power estimation must be provided for storeMode NoStorage");
+
+    if (workerThreads > 0 && !powerAnalysis)
+        SC_REPORT_WARNING("SimConfig", "WorkerThreads has no effect without PowerAnalysis");
+
+    if (recordingFormat == Config::RecordingFormatType::Invalid)
+        SC_REPORT_FATAL("SimConfig", "Invalid RecordingFormat");
+
+    if (recordingBulkLoad && recordingFormat == Config::RecordingFormatType::Columnar)
+        SC_REPORT_WARNING("SimConfig",
+                          "RecordingBulkLoad has no effect with RecordingFormat Columnar");
+
+    for (const auto& [start, end] : recordingTimeWindows)
+    {
+        if (start < 0 || end < start)
+            SC_REPORT_FATAL("SimConfig", "Invalid recording time window");
+    }
+
+    if (recordingSampleInterval == 0)
+        SC_REPORT_FATAL("SimConfig", "Minimum RecordingSampleInterval is 1");
+
+    if (recordingTriggerLatency < 0)
+        SC_REPORT_FATAL("SimConfig", "Invalid RecordingTriggerLatency");
+
+    if (recordingHistoryLength == 0 &&
+        (recordingPostTriggerLength > 0 || recordingTriggerLatency > 0 ||
+         recordingTriggerBufferDepth > 0 || recordingTriggerForcedRefresh))
+        SC_REPORT_WARNING("SimConfig", "Recording triggers have no effect without a history");
+
+    if (recordingBatchSize == 0 || recordingQueueDepth == 0 || recordingWriterThreads == 0)
+        SC_REPORT_FATAL("SimConfig",
+                        "RecordingBatchSize, RecordingQueueDepth and RecordingWriterThreads must be "
+                        "at least 1");
 }
 
 } // namespace DRAMSys
@@ -42,6 +42,8 @@
 
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace DRAMSys
 {
@@ -60,6 +62,25 @@ struct SimConfig
     unsigned long long int addressOffset;
     bool storageEnabled = DEFAULT_STORAGE_ENABLED;
     std::optional<DRAMUtils::Config::ToggleRateDefinition> togglingRate;
+    unsigned int workerThreads;
+    unsigned int recordingBatchSize;
+    unsigned int recordingQueueDepth;
+    unsigned int recordingWriterThreads;
+    bool recordingBulkLoad;
+    Config::RecordingFormatType recordingFormat;
+
+    // Recording filters, empty lists do not filter
+    std::vector<std::pair<double, double>> recordingTimeWindows;
+    std::vector<unsigned int> recordingChannels;
+    std::vector<unsigned int> recordingThreads;
+    unsigned int recordingSampleInterval;
+
+    // Flight recorder, only the history before and after a trigger is recorded
+    unsigned int recordingHistoryLength;
+    unsigned int recordingPostTriggerLength;
+    double recordingTriggerLatency;
+    unsigned int recordingTriggerBufferDepth;
+    bool recordingTriggerForcedRefresh;
 
     static constexpr std::string_view DEFAULT_SIMULATION_NAME = "default";
     static constexpr bool DEFAULT_DATABASE_RECORDING = false;
@@ -70,6 +91,19 @@ struct SimConfig
     static constexpr bool DEFAULT_SIMULATION_PROGRESS_BAR = false;
     static constexpr unsigned long long int DEFAULT_ADDRESS_OFFSET = 0;
     static constexpr bool DEFAULT_STORAGE_ENABLED = false;
+    static constexpr unsigned int DEFAULT_WORKER_THREADS = 0;
+    static constexpr unsigned int DEFAULT_RECORDING_BATCH_SIZE = 8192;
+    static constexpr unsigned int DEFAULT_RECORDING_QUEUE_DEPTH = 4;
+    static constexpr unsigned int DEFAULT_RECORDING_WRITER_THREADS = 1;
+    static constexpr bool DEFAULT_RECORDING_BULK_LOAD = false;
+    static constexpr Config::RecordingFormatType DEFAULT_RECORDING_FORMAT =
+        Config::RecordingFormatType::Sqlite;
+    static constexpr unsigned int DEFAULT_RECORDING_SAMPLE_INTERVAL = 1;
+    static constexpr unsigned int DEFAULT_RECORDING_HISTORY_LENGTH = 0;
+    static constexpr unsigned int DEFAULT_RECORDING_POST_TRIGGER_LENGTH = 0;
+    static constexpr double DEFAULT_RECORDING_TRIGGER_LATENCY = 0.0;
+    static constexpr unsigned int DEFAULT_RECORDING_TRIGGER_BUFFER_DEPTH = 0;
+    static constexpr bool DEFAULT_RECORDING_TRIGGER_FORCED_REFRESH = false;
 };
 
 } // namespace DRAMSys
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "Histogram.h"
+
+#include <cmath>
+
+namespace DRAMSys::Statistics
+{
+
+Histogram::Histogram(
+    double unit, std::vector<uint64_t> buckets, uint64_t sum, uint64_t min, uint64_t max) :
+    unit(unit),
+    buckets(std::move(buckets)),
+    sum(sum),
+    min(min),
+    max(max)
+{
+    // Serialized histograms may omit the empty trailing buckets
+    this->buckets.resize(NUMBER_OF_BUCKETS, 0);
+    for (uint64_t bucket : this->buckets)
+        count += bucket;
+
+    if (count == 0)
+        reset();
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    for (std::size_t i = 0; i < NUMBER_OF_BUCKETS; i++)
+        buckets[i] += other.buckets[i];
+
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+void Histogram::reset()
+{
+    std::fill(buckets.begin(), buckets.end(), 0);
+    count = 0;
+    sum = 0;
+    min = UINT64_MAX;
+    max = 0;
+}
+
+double Histogram::getMean() const
+{
+    if (count == 0)
+        return 0.0;
+
+    return static_cast<double>(sum) / static_cast<double>(count) * unit;
+}
+
+double Histogram::getPercentile(double percentile) const
+{
+    if (count == 0)
+        return 0.0;
+
+    double exactRank = percentile / 100.0 * static_cast<double>(count);
+    auto rank = static_cast<uint64_t>(std::ceil(exactRank));
+    rank = std::clamp<uint64_t>(rank, 1, count);
+
+    uint64_t accumulated = 0;
+    for (std::size_t i = 0; i < buckets.size(); i++)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= rank)
+        {
+            uint64_t value = std::clamp(getBucketBounds(i).second, min, max);
+            return static_cast<double>(value) * unit;
+        }
+    }
+
+    return static_cast<double>(max) * unit;
+}
+
+std::pair<uint64_t, uint64_t> Histogram::getBucketBounds(std::size_t index)
+{
+    if (index < 2 * SUB_BUCKET_COUNT)
+        return {index, index};
+
+    uint64_t exponent = index / SUB_BUCKET_COUNT;
+    uint64_t subBucket = index % SUB_BUCKET_COUNT;
+    uint64_t lower = (SUB_BUCKET_COUNT + subBucket) << (exponent - 1);
+    uint64_t width = uint64_t(1) << (exponent - 1);
+    return {lower, lower + (width - 1)};
+}
+
+} // namespace DRAMSys::Statistics
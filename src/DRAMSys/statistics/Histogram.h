@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace DRAMSys::Statistics
+{
+
+/**
+ * Streaming histogram of non-negative integer samples, e.g., latencies in simulation time
+ * resolution units. Values below 2^SUB_BUCKET_BITS get an exact bucket each, every further power
+ * of two is split into 2^SUB_BUCKET_BITS equally wide buckets. Percentiles are therefore known
+ * with a relative error below 2^-SUB_BUCKET_BITS at a constant memory footprint, independent of
+ * the number of samples.
+ *
+ * Histograms with the same unit can be merged, e.g., to combine the histograms of several
+ * channels or simulation shards into one.
+ */
+class Histogram
+{
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 5;
+    static constexpr uint64_t SUB_BUCKET_COUNT = uint64_t(1) << SUB_BUCKET_BITS;
+
+    // Enough buckets for all 64-bit samples. They are allocated once, so that recording never
+    // allocates during the simulation.
+    static constexpr std::size_t NUMBER_OF_BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    /**
+     * @param unit value of one sample unit in the quantity of the statistic, e.g., the time
+     *             resolution in seconds
+     */
+    explicit Histogram(double unit = 1.0) : unit(unit), buckets(NUMBER_OF_BUCKETS, 0) {}
+
+    Histogram(double unit, std::vector<uint64_t> buckets, uint64_t sum, uint64_t min, uint64_t max);
+
+    void record(uint64_t value)
+    {
+        buckets[getBucketIndex(value)]++;
+        count++;
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    void merge(const Histogram& other);
+    void reset();
+
+    [[nodiscard]] uint64_t getCount() const { return count; }
+    [[nodiscard]] double getUnit() const { return unit; }
+    [[nodiscard]] uint64_t getSum() const { return sum; }
+    [[nodiscard]] uint64_t getRawMin() const { return count == 0 ? 0 : min; }
+    [[nodiscard]] uint64_t getRawMax() const { return max; }
+    // Always NUMBER_OF_BUCKETS buckets, including the empty ones
+    [[nodiscard]] const std::vector<uint64_t>& getBuckets() const { return buckets; }
+
+    /**
+     * The following getters return values scaled by the unit. An empty histogram yields zero.
+     */
+    [[nodiscard]] double getMean() const;
+    [[nodiscard]] double getMin() const { return static_cast<double>(getRawMin()) * unit; }
+    [[nodiscard]] double getMax() const { return static_cast<double>(max) * unit; }
+
+    /**
+     * @param percentile in the range (0, 100]
+     * @return the highest value of the bucket that contains the requested percentile, clamped
+     *         to the recorded minimum and maximum
+     */
+    [[nodiscard]] double getPercentile(double percentile) const;
+
+    static std::size_t getBucketIndex(uint64_t value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+            return value;
+
+        unsigned exponent = 0;
+        for (uint64_t v = value >> SUB_BUCKET_BITS; v != 0; v >>= 1)
+            exponent++;
+
+        return static_cast<std::size_t>(exponent * SUB_BUCKET_COUNT +
+                                        ((value >> (exponent - 1)) - SUB_BUCKET_COUNT));
+    }
+
+    /**
+     * @return the inclusive lower and upper bound of a bucket in raw units
+     */
+    static std::pair<uint64_t, uint64_t> getBucketBounds(std::size_t index);
+
+private:
+    double unit;
+    std::vector<uint64_t> buckets;
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+};
+
+} // namespace DRAMSys::Statistics
+
+#endif // HISTOGRAM_H
@@ -46,6 +46,35 @@ using json = nlohmann::json;
 namespace DRAMSys::Statistics
 {
 
+static json formatHistogram(Histogram const& histogram)
+{
+    json j = json::object();
+    j["Count"] = histogram.getCount();
+    j["Mean"] = histogram.getMean();
+    j["Min"] = histogram.getMin();
+    j["P50"] = histogram.getPercentile(50.0);
+    j["P95"] = histogram.getPercentile(95.0);
+    j["P99"] = histogram.getPercentile(99.0);
+    j["P999"] = histogram.getPercentile(99.9);
+    j["Max"] = histogram.getMax();
+
+    // Only non-empty buckets as [lower bound, upper bound, count], scaled by the unit
+    j["Buckets"] = json::array();
+    auto const& buckets = histogram.getBuckets();
+    for (std::size_t i = 0; i < buckets.size(); i++)
+    {
+        if (buckets[i] == 0)
+            continue;
+
+        auto [lower, upper] = Histogram::getBucketBounds(i);
+        j["Buckets"].push_back({static_cast<double>(lower) * histogram.getUnit(),
+                                static_cast<double>(upper) * histogram.getUnit(),
+                                buckets[i]});
+    }
+
+    return j;
+}
+
 static json formatGroup(Statistics::Group const& group)
 {
     json j = json::object();
@@ -69,6 +98,16 @@ static json formatGroup(Statistics::Group const& group)
                     j[vectorStat->name][i] = vectorStat->values[i];
             }
         }
+        else if (auto* histogramStat = dynamic_cast<HistogramStat*>(stat.get()))
+        {
+            j[stat->name] = formatHistogram(histogramStat->histogram);
+        }
+        else if (auto* histogramVectorStat = dynamic_cast<HistogramVectorStat*>(stat.get()))
+        {
+            j[stat->name] = json::array();
+            for (auto const& histogram : histogramVectorStat->histograms)
+                j[stat->name].push_back(formatHistogram(histogram));
+        }
     }
 
     for (const auto* subGroup : group.subGroups)
@@ -43,6 +43,8 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <array>
+
 namespace DRAMSys::Statistics
 {
 
@@ -93,6 +95,36 @@ static void appendStat(std::string& out,
                    description);
 }
 
+static void appendHistogram(std::string& out,
+                            std::string_view context,
+                            std::string_view name,
+                            Stat const& stat,
+                            Histogram const& histogram)
+{
+    static constexpr std::array<std::pair<std::string_view, double>, 4> PERCENTILES = {
+        {{"P50", 50.0}, {"P95", 95.0}, {"P99", 99.0}, {"P999", 99.9}}};
+
+    appendStat(out,
+               context,
+               fmt::format("{}.Count", name),
+               Quantity::Count,
+               stat.description,
+               static_cast<double>(histogram.getCount()));
+    appendStat(
+        out, context, fmt::format("{}.Mean", name), stat.quantity, "", histogram.getMean());
+    appendStat(out, context, fmt::format("{}.Min", name), stat.quantity, "", histogram.getMin());
+    for (auto const& [suffix, percentile] : PERCENTILES)
+    {
+        appendStat(out,
+                   context,
+                   fmt::format("{}.{}", name, suffix),
+                   stat.quantity,
+                   "",
+                   histogram.getPercentile(percentile));
+    }
+    appendStat(out, context, fmt::format("{}.Max", name), stat.quantity, "", histogram.getMax());
+}
+
 static std::string formatGroup(Statistics::Group const& group, std::string_view context)
 {
     std::string out;
@@ -115,6 +147,21 @@ static std::string formatGroup(Statistics::Group const& group, std::string_view
                            vec->values[i]);
             }
         }
+        else if (auto* hist = dynamic_cast<HistogramStat*>(stat.get()))
+        {
+            appendHistogram(out, context, stat->name, *stat, hist->histogram);
+        }
+        else if (auto* hists = dynamic_cast<HistogramVectorStat*>(stat.get()))
+        {
+            for (std::size_t i = 0; i < hists->histograms.size(); ++i)
+            {
+                appendHistogram(out,
+                                context,
+                                fmt::format("{}[{}]", stat->name, i),
+                                *stat,
+                                hists->histograms[i]);
+            }
+        }
     }
     for (auto const& sub : group.subGroups)
         out += formatGroup(*sub, fmt::format("{}.{}", context, sub->name));
@@ -137,4 +184,10 @@ void PrettyFormat::collectStats(sc_core::sc_object* obj, std::ostream& os, std::
     }
 }
 
+void PrettyFormat::printGroup(Group const& group, std::ostream& os, std::string const& path)
+{
+    std::string context = path.empty() ? group.name : fmt::format("{}.{}", path, group.name);
+    fmt::print(os, formatGroup(group, context));
+}
+
 } // namespace DRAMSys::Statistics
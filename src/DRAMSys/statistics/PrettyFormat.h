@@ -40,11 +40,19 @@
 namespace DRAMSys::Statistics
 {
 
+class Group;
+
 namespace PrettyFormat
 {
 
 void collectStats(sc_core::sc_object* obj, std::ostream& os, std::string path = "");
 
+/**
+ * Prints a group and its sub groups that are not provided by a module, e.g., statistics that
+ * have been merged from several simulation runs.
+ */
+void printGroup(Group const& group, std::ostream& os, std::string const& path = "");
+
 };
 
 } // namespace DRAMSys::Statistics
@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include "DRAMSys/statistics/Histogram.h"
+
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -49,7 +51,8 @@ enum class Quantity : std::uint8_t
     Time,      // s
     Energy,    // J
     Count,
-    Percentage
+    Percentage,
+    Average // Mean of a count, e.g., a time-weighted buffer occupancy
 };
 
 class Stat
@@ -103,4 +106,34 @@ public:
     std::vector<double> values;
 };
 
+class HistogramStat : public Stat
+{
+public:
+    HistogramStat(std::string name, std::string description, Quantity quantity, double unit) :
+        Stat(std::move(name), std::move(description), quantity),
+        histogram(unit)
+    {
+    }
+
+    Histogram histogram;
+};
+
+class HistogramVectorStat : public Stat
+{
+public:
+    HistogramVectorStat(std::string name,
+                        std::string description,
+                        Quantity quantity,
+                        double unit) :
+        Stat(std::move(name), std::move(description), quantity),
+        unit(unit)
+    {
+    }
+
+    void resize(std::size_t size) { histograms.resize(size, Histogram(unit)); }
+
+    double unit;
+    std::vector<Histogram> histograms;
+};
+
 } // namespace DRAMSys::Statistics
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "util/SystemCTest.h"
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/DRAMSys.h>
+#include <DRAMSys/common/MemoryManager.h>
+#include <DRAMSys/initiators/generator/TrafficGenerator.h>
+#include <DRAMSys/initiators/request/RequestIssuer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+std::atomic<bool> countAllocations{false};
+std::atomic<uint64_t> numberOfAllocations{0};
+
+} // namespace
+
+// Replaces the global allocation functions of this test executable. The array and nothrow forms
+// forward to operator new(std::size_t) and operator delete(void*) by default, the aligned forms
+// do not and are replaced as well.
+void* operator new(std::size_t size)
+{
+    if (countAllocations.load(std::memory_order_relaxed))
+        numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(ptr);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (countAllocations.load(std::memory_order_relaxed))
+        numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    auto align = static_cast<std::size_t>(alignment);
+    // std::aligned_alloc requires the size to be a multiple of the alignment
+    std::size_t alignedSize = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+#ifdef _MSC_VER
+    if (void* ptr = _aligned_malloc(alignedSize, align))
+        return ptr;
+#else
+    if (void* ptr = std::aligned_alloc(align, alignedSize))
+        return ptr;
+#endif
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::align_val_t alignment) noexcept
+{
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr,
+                     [[maybe_unused]] std::size_t size,
+                     std::align_val_t alignment) noexcept
+{
+    operator delete(ptr, alignment);
+}
+
+using namespace DRAMSys::Initiators;
+
+class SteadyStateAllocationTest : public SystemCTest
+{
+protected:
+    static constexpr uint64_t NUMBER_OF_REQUESTS = 10000000;
+
+    // Long enough to fill all pools, queues and request buffers and to include refreshes
+    static inline const sc_core::sc_time WARMUP_TIME{50, sc_core::SC_US};
+    static inline const sc_core::sc_time MEASUREMENT_TIME{200, sc_core::SC_US};
+};
+
+TEST_F(SteadyStateAllocationTest, TrafficGenerator)
+{
+#ifndef NDEBUG
+    // Only meaningful in release builds, see the release test preset
+    GTEST_SKIP() << "Debug messages allocate in builds without NDEBUG";
+#endif
+
+    auto config = DRAMSys::Config::from_path("b_transport/configs/no_storage.json");
+
+    DRAMSys::MemoryManager memoryManager(false);
+    DRAMSys::DRAMSys dramSys("DRAMSys", config);
+
+    DRAMSys::Config::TrafficGenerator generatorConfig{
+        1000,
+        "generator",
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt,
+        64,
+        std::nullopt,
+        NUMBER_OF_REQUESTS,
+        0.7,
+        DRAMSys::Config::AddressDistribution::Random,
+        std::nullopt,
+        std::nullopt,
+        std::nullopt};
+
+    uint64_t finishedTransactions = 0;
+    RequestIssuer issuer(
+        "issuer",
+        std::make_unique<TrafficGenerator>(generatorConfig, dramSys.memorySize()),
+        memoryManager,
+        dramSys.getMemSpec().tCK,
+        std::nullopt,
+        std::nullopt,
+        [&finishedTransactions]() { finishedTransactions++; },
+        []() { sc_core::sc_stop(); });
+    issuer.iSocket.bind(dramSys.tSocket);
+
+    sc_core::sc_start(WARMUP_TIME);
+    const uint64_t finishedTransactionsBefore = finishedTransactions;
+
+    countAllocations = true;
+    sc_core::sc_start(MEASUREMENT_TIME);
+    countAllocations = false;
+
+    const uint64_t requests = finishedTransactions - finishedTransactionsBefore;
+    const uint64_t allocations = numberOfAllocations;
+    ASSERT_GT(requests, 0U);
+    EXPECT_EQ(allocations, 0U)
+        << static_cast<double>(allocations) / static_cast<double>(requests)
+        << " allocations per request in steady state";
+}
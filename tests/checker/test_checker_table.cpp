@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+
+#include "util/SystemCTest.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <DRAMSys/common/dramExtensions.h>
+#include <DRAMSys/configuration/memspec/MemSpecDDR3.h>
+#include <DRAMSys/configuration/memspec/MemSpecDDR4.h>
+#include <DRAMSys/configuration/memspec/MemSpecHBM2.h>
+#include <DRAMSys/configuration/memspec/MemSpecLPDDR4.h>
+#include <DRAMSys/controller/checker/CheckerDDR3.h>
+#include <DRAMSys/controller/checker/CheckerDDR4.h>
+#include <DRAMSys/controller/checker/CheckerHBM2.h>
+#include <DRAMSys/controller/checker/CheckerLPDDR4.h>
+#include <DRAMSys/controller/checker/CheckerTable.h>
+
+#include <fstream>
+#include <random>
+#include <string_view>
+
+using namespace DRAMSys;
+
+class CheckerTableTest : public SystemCTest
+{
+protected:
+    template <typename ConfigType, typename MemSpecType, typename ReferenceChecker>
+    static void compareWithReference(std::string_view memSpecPath)
+    {
+        std::ifstream file{std::string(memSpecPath)};
+        const MemSpecType memSpec(nlohmann::json::parse(file).at("memspec").get<ConfigType>());
+
+        ReferenceChecker reference(memSpec);
+        CheckerTable table(memSpec, createTimingTable(memSpec));
+
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<unsigned> commandDistribution(Command::RD, Command::SREFEX);
+        std::uniform_int_distribution<uint64_t> bankDistribution(0, memSpec.banksPerChannel - 1);
+        std::bernoulli_distribution burstLengthDistribution;
+
+        auto setUpPayload = [&](tlm::tlm_generic_payload& payload)
+        {
+            const uint64_t bank = bankDistribution(generator);
+            ControllerExtension::setAutoExtension(
+                payload,
+                0,
+                Rank(bank / memSpec.banksPerRank),
+                Stack(bank / (memSpec.banksPerChannel / memSpec.stacksPerChannel)),
+                BankGroup(bank / memSpec.banksPerGroup),
+                Bank(bank),
+                Row(0),
+                Column(0),
+                burstLengthDistribution(generator) ? 32 : 16);
+        };
+
+        tlm::tlm_generic_payload payload;
+        tlm::tlm_generic_payload probe;
+        for (auto* trans : {&payload, &probe})
+        {
+            // Later updates of the extension happen in place
+            ControllerExtension::setExtension(
+                *trans, 0, Rank(0), Stack(0), BankGroup(0), Bank(0), Row(0), Column(0), 0);
+        }
+
+        for (unsigned i = 0; i < 20000; i++)
+        {
+            // Compare a random other command before every insert to cover untouched components
+            setUpPayload(probe);
+            const Command probeCommand(static_cast<Command::Type>(commandDistribution(generator)));
+            ASSERT_EQ(reference.timeToSatisfyConstraints(probeCommand, probe),
+                      table.timeToSatisfyConstraints(probeCommand, probe));
+
+            setUpPayload(payload);
+            const Command command(static_cast<Command::Type>(commandDistribution(generator)));
+            const sc_core::sc_time readyTime = reference.timeToSatisfyConstraints(command, payload);
+            ASSERT_EQ(readyTime, table.timeToSatisfyConstraints(command, payload));
+
+            sc_core::sc_start(readyTime - sc_core::sc_time_stamp());
+
+            reference.insert(command, payload);
+            table.insert(command, payload);
+        }
+    }
+};
+
+TEST_F(CheckerTableTest, DDR3)
+{
+    compareWithReference<DRAMUtils::MemSpec::MemSpecDDR3, MemSpecDDR3, CheckerDDR3>(
+        "../configs/memspec/MICRON_2GB_DDR3-1600_64bit_G_UDIMM.json");
+}
+
+TEST_F(CheckerTableTest, DDR4)
+{
+    compareWithReference<DRAMUtils::MemSpec::MemSpecDDR4, MemSpecDDR4, CheckerDDR4>(
+        "../configs/memspec/JEDEC_4Gb_DDR4-2400_8bit_A.json");
+}
+
+TEST_F(CheckerTableTest, LPDDR4)
+{
+    compareWithReference<DRAMUtils::MemSpec::MemSpecLPDDR4, MemSpecLPDDR4, CheckerLPDDR4>(
+        "../configs/memspec/JEDEC_8Gb_LPDDR4-3200_16bit.json");
+}
+
+TEST_F(CheckerTableTest, HBM2)
+{
+    compareWithReference<DRAMUtils::MemSpec::MemSpecHBM2, MemSpecHBM2, CheckerHBM2>(
+        "../configs/memspec/HBM2.json");
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/BinaryTraceReader.h>
+#include <DRAMSys/common/BinaryTraceWriter.h>
+#include <DRAMSys/initiators/player/BtlPlayer.h>
+#include <DRAMSys/initiators/player/StlPlayer.h>
+#include <DRAMSys/initiators/player/StlTraceParser.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace DRAMSys;
+using namespace DRAMSys::BinaryTrace;
+
+class BinaryTraceTest : public ::testing::Test
+{
+protected:
+    ~BinaryTraceTest() override { std::filesystem::remove(fileName); }
+
+    std::string fileName = "test_binary_trace.btl";
+
+    // Spans several blocks with a partially filled last block
+    static constexpr uint64_t numberOfRecords = 3 * RECORDS_PER_BLOCK + 123;
+
+    static uint64_t cycleOf(uint64_t record) { return 10 * record + 5; }
+};
+
+TEST_F(BinaryTraceTest, RoundTrip)
+{
+    {
+        BinaryTraceWriter writer(fileName, false);
+        for (uint64_t record = 0; record < numberOfRecords; record++)
+        {
+            std::vector<uint8_t> data(record % 4, static_cast<uint8_t>(record));
+            writer.append(cycleOf(record),
+                          record % 2 == 0 ? Command::Read : Command::Write,
+                          record * 64,
+                          static_cast<uint32_t>(record % 3) * 32,
+                          data.data(),
+                          static_cast<uint32_t>(data.size()));
+        }
+    }
+
+    BinaryTraceReader reader(fileName);
+    EXPECT_FALSE(reader.isRelative());
+    ASSERT_EQ(reader.getNumberOfRecords(), numberOfRecords);
+
+    Record record;
+    for (uint64_t expected = 0; expected < numberOfRecords; expected++)
+    {
+        ASSERT_TRUE(reader.next(record));
+        EXPECT_EQ(record.cycle, cycleOf(expected));
+        EXPECT_EQ(record.command, expected % 2 == 0 ? Command::Read : Command::Write);
+        EXPECT_EQ(record.address, expected * 64);
+        EXPECT_EQ(record.length, (expected % 3) * 32);
+        ASSERT_EQ(record.dataSize, expected % 4);
+        for (uint32_t byte = 0; byte < record.dataSize; byte++)
+            EXPECT_EQ(record.data[byte], static_cast<uint8_t>(expected));
+    }
+
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST_F(BinaryTraceTest, Seek)
+{
+    {
+        BinaryTraceWriter writer(fileName, true);
+        for (uint64_t record = 0; record < numberOfRecords; record++)
+        {
+            uint8_t data = static_cast<uint8_t>(record);
+            writer.append(10, Command::Write, record, 0, &data, 1);
+        }
+    }
+
+    BinaryTraceReader reader(fileName);
+    EXPECT_TRUE(reader.isRelative());
+
+    Record record;
+    for (uint64_t target : {uint64_t{0}, RECORDS_PER_BLOCK - 1, RECORDS_PER_BLOCK,
+                            2 * RECORDS_PER_BLOCK + 7, numberOfRecords - 1})
+    {
+        reader.seekToRecord(target);
+        EXPECT_EQ(reader.getPosition(), target);
+        ASSERT_TRUE(reader.next(record));
+        EXPECT_EQ(record.address, target);
+        EXPECT_EQ(record.cycle, 10 * (target + 1));
+        EXPECT_EQ(record.data[0], static_cast<uint8_t>(target));
+
+        // The first record at or after the cycle, also between two records
+        reader.seekToCycle(10 * (target + 1) - 5);
+        EXPECT_EQ(reader.getPosition(), target);
+        reader.seekToCycle(10 * (target + 1));
+        EXPECT_EQ(reader.getPosition(), target);
+    }
+
+    reader.seekToCycle(10 * numberOfRecords + 1);
+    EXPECT_FALSE(reader.next(record));
+}
+
+TEST_F(BinaryTraceTest, IncompleteTrace)
+{
+    {
+        BinaryTraceWriter writer(fileName, false);
+        writer.append(1, Command::Read, 0, 0);
+    }
+
+    std::filesystem::resize_file(fileName, std::filesystem::file_size(fileName) - 1);
+    EXPECT_THROW(BinaryTraceReader reader(fileName), std::runtime_error);
+}
+
+TEST_F(BinaryTraceTest, BtlPlayerMatchesStlPlayer)
+{
+    using DRAMSys::Initiators::BtlPlayer;
+    using DRAMSys::Initiators::Request;
+    using DRAMSys::Initiators::StlPlayer;
+    using DRAMSys::Initiators::StlTraceParser;
+
+    // The first request does not start at cycle 0
+    const std::string stlFileName = "test_binary_trace.stl";
+    std::ofstream(stlFileName) << "25:\tread\t0x0\n"
+                                  "30:\twrite\t0x40\n"
+                                  "30:\tread\t0x80\n"
+                                  "100:\t(32) read\t0xc0\n";
+
+    // Converted like the btl_converter does
+    {
+        StlTraceParser parser(stlFileName, false);
+        BinaryTraceWriter writer(fileName, false);
+        while (const StlTraceParser::Block* block = parser.nextBlock())
+        {
+            for (std::size_t index = 0; index < block->size; index++)
+            {
+                const StlTraceParser::LineContent& line = block->lines[index];
+                writer.append(line.cycle,
+                              line.command == StlTraceParser::LineContent::Command::Read
+                                  ? Command::Read
+                                  : Command::Write,
+                              line.address,
+                              line.dataLength.value_or(0));
+            }
+        }
+    }
+
+    Config::TracePlayer config{};
+    config.clkMhz = 1000;
+    config.dataLength = 64;
+
+    StlPlayer stlPlayer(config, stlFileName, StlPlayer::TraceType::Absolute, false);
+    BtlPlayer btlPlayer(config, fileName, false);
+    EXPECT_EQ(btlPlayer.totalRequests(), stlPlayer.totalRequests());
+
+    for (unsigned index = 0; index < 4; index++)
+    {
+        EXPECT_EQ(btlPlayer.nextTrigger(), stlPlayer.nextTrigger()) << index;
+
+        Request btlRequest = btlPlayer.nextRequest();
+        Request stlRequest = stlPlayer.nextRequest();
+        EXPECT_EQ(btlRequest.command, stlRequest.command) << index;
+        EXPECT_EQ(btlRequest.address, stlRequest.address) << index;
+        EXPECT_EQ(btlRequest.length, stlRequest.length) << index;
+    }
+    EXPECT_EQ(btlPlayer.nextRequest().command, Request::Command::Stop);
+
+    // A playback that starts within the trace begins with its first request
+    config.startRequest = 1;
+    BtlPlayer seekingPlayer(config, fileName, false);
+    EXPECT_EQ(seekingPlayer.nextTrigger(), sc_core::SC_ZERO_TIME);
+    EXPECT_EQ(seekingPlayer.nextRequest().address, 0x40U);
+
+    std::filesystem::remove(stlFileName);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/ColumnarTraceReader.h>
+#include <DRAMSys/common/ColumnarTraceWriter.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace DRAMSys;
+using namespace DRAMSys::ColumnarTrace;
+
+class ColumnarTraceTest : public ::testing::Test
+{
+protected:
+    ColumnarTraceTest()
+    {
+        metadata.numberOfRanks = 2;
+        metadata.clk = 625;
+        metadata.unitOfTime = "PS";
+        metadata.controllerThread = UINT32_MAX;
+        metadata.timeResolution = 1e-12;
+        metadata.commandLengths = {{"ACT", 1.0}, {"RD", 2.0}};
+        metadata.phaseNames = {{1, "REQ"}, {4, "ACT"}};
+    }
+
+    ~ColumnarTraceTest() override { std::filesystem::remove(fileName); }
+
+    std::string fileName = "test_columnar_trace.ctr";
+    TraceMetadata metadata;
+};
+
+TEST_F(ColumnarTraceTest, RoundTrip)
+{
+    constexpr uint64_t numberOfTransactions = 1000;
+    std::vector<TransactionRecord> transactions;
+    std::vector<PhaseRecord> phases;
+
+    {
+        ColumnarTraceWriter writer(fileName, metadata, 64);
+        for (uint64_t id = 1; id <= numberOfTransactions; id++)
+        {
+            uint64_t begin = id * 1000;
+            transactions.push_back({id, id * 64, 64, 0, 0, begin - 500, 'R', begin, begin + 3000});
+            writer.append(transactions.back());
+
+            // Phases without data strobe and phases that end before they begin are valid
+            phases.push_back({id, 4, begin, begin + 1000, 0, 0, 1, 0, 3, 42, 0, 0});
+            phases.push_back(
+                {id, 5, begin + 1500, 0, begin + 2000, begin + 2500, 1, 0, 3, 42, 8, 16});
+            writer.append(phases[phases.size() - 2]);
+            writer.append(phases.back());
+        }
+        writer.append(PowerRecord{1e-6, 0.5});
+        writer.append(DebugMessageRecord{100, "message"});
+    }
+
+    ColumnarTraceReader reader(fileName);
+    EXPECT_EQ(reader.getMetadata().numberOfRanks, 2);
+    EXPECT_EQ(reader.getMetadata().controllerThread, UINT32_MAX);
+    EXPECT_EQ(reader.getMetadata().commandLengths, metadata.commandLengths);
+    EXPECT_EQ(reader.getMetadata().phaseNames, metadata.phaseNames);
+
+    std::vector<TransactionRecord> readTransactions;
+    std::vector<PhaseRecord> readPhases;
+    std::vector<PowerRecord> readPower;
+    std::vector<DebugMessageRecord> readDebugMessages;
+    for (const ChunkInfo& chunk : reader.getChunks())
+    {
+        if (chunk.table == Table::Transactions)
+            reader.read(chunk, readTransactions);
+        else if (chunk.table == Table::Phases)
+            reader.read(chunk, readPhases);
+        else if (chunk.table == Table::Power)
+            reader.read(chunk, readPower);
+        else if (chunk.table == Table::DebugMessages)
+            reader.read(chunk, readDebugMessages);
+    }
+
+    ASSERT_EQ(readTransactions.size(), transactions.size());
+    for (std::size_t index = 0; index < transactions.size(); index++)
+    {
+        EXPECT_EQ(readTransactions[index].id, transactions[index].id);
+        EXPECT_EQ(readTransactions[index].address, transactions[index].address);
+        EXPECT_EQ(readTransactions[index].timeOfGeneration, transactions[index].timeOfGeneration);
+        EXPECT_EQ(readTransactions[index].command, transactions[index].command);
+        EXPECT_EQ(readTransactions[index].rangeBegin, transactions[index].rangeBegin);
+        EXPECT_EQ(readTransactions[index].rangeEnd, transactions[index].rangeEnd);
+    }
+
+    ASSERT_EQ(readPhases.size(), phases.size());
+    for (std::size_t index = 0; index < phases.size(); index++)
+    {
+        EXPECT_EQ(readPhases[index].transaction, phases[index].transaction);
+        EXPECT_EQ(readPhases[index].phaseNameId, phases[index].phaseNameId);
+        EXPECT_EQ(readPhases[index].begin, phases[index].begin);
+        EXPECT_EQ(readPhases[index].end, phases[index].end);
+        EXPECT_EQ(readPhases[index].dataStrobeBegin, phases[index].dataStrobeBegin);
+        EXPECT_EQ(readPhases[index].dataStrobeEnd, phases[index].dataStrobeEnd);
+        EXPECT_EQ(readPhases[index].row, phases[index].row);
+        EXPECT_EQ(readPhases[index].burstLength, phases[index].burstLength);
+    }
+
+    ASSERT_EQ(readPower.size(), 1);
+    EXPECT_EQ(readPower[0].averagePower, 0.5);
+    ASSERT_EQ(readDebugMessages.size(), 1);
+    EXPECT_EQ(readDebugMessages[0].message, "message");
+
+    // 64 transactions per chunk, each covering 64 us
+    auto chunks = reader.findChunks(Table::Transactions, 100000, 100000);
+    ASSERT_EQ(chunks.size(), 1);
+    std::vector<TransactionRecord> window;
+    reader.read(chunks.front(), window);
+    EXPECT_LE(window.front().rangeBegin, 100000);
+    EXPECT_GE(window.back().rangeEnd, 100000);
+
+    EXPECT_EQ(reader.findChunks(Table::Power, 1000000, 1000000).size(), 1);
+    EXPECT_TRUE(reader.findChunks(Table::Power, 0, 999999).empty());
+}
+
+TEST_F(ColumnarTraceTest, Truncated)
+{
+    {
+        ColumnarTraceWriter writer(fileName, metadata);
+        writer.append(DebugMessageRecord{100, "message"});
+    }
+
+    std::filesystem::resize_file(fileName, std::filesystem::file_size(fileName) - 1);
+    EXPECT_THROW(ColumnarTraceReader reader(fileName), std::runtime_error);
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/SpscRing.h>
+
+#include <thread>
+#include <vector>
+
+using namespace DRAMSys;
+
+TEST(SpscRingTest, Full)
+{
+    SpscRing<std::vector<unsigned>> ring(2);
+
+    for (unsigned slot = 0; slot < 2; slot++)
+    {
+        auto* batch = ring.tryAcquire();
+        ASSERT_NE(batch, nullptr);
+        batch->push_back(slot);
+        ring.publish();
+    }
+
+    EXPECT_EQ(ring.tryAcquire(), nullptr);
+
+    ASSERT_NE(ring.front(), nullptr);
+    EXPECT_EQ(ring.front()->front(), 0);
+    ring.front()->clear();
+    ring.pop();
+
+    // The released slot is reused with its previous capacity
+    auto* batch = ring.tryAcquire();
+    ASSERT_NE(batch, nullptr);
+    EXPECT_TRUE(batch->empty());
+    EXPECT_GE(batch->capacity(), 1);
+}
+
+TEST(SpscRingTest, ProducerConsumerOrder)
+{
+    constexpr unsigned numberOfBatches = 10000;
+    constexpr unsigned batchSize = 16;
+
+    SpscRing<std::vector<unsigned>> ring(4);
+    std::vector<unsigned> results;
+
+    std::thread consumer(
+        [&ring, &results]()
+        {
+            while (results.size() < numberOfBatches * batchSize)
+            {
+                if (auto* batch = ring.front())
+                {
+                    results.insert(results.end(), batch->begin(), batch->end());
+                    batch->clear();
+                    ring.pop();
+                }
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    unsigned value = 0;
+    for (unsigned i = 0; i < numberOfBatches; i++)
+    {
+        std::vector<unsigned>* batch = nullptr;
+        while ((batch = ring.tryAcquire()) == nullptr)
+            std::this_thread::yield();
+
+        for (unsigned j = 0; j < batchSize; j++)
+            batch->push_back(value++);
+        ring.publish();
+    }
+
+    consumer.join();
+
+    EXPECT_TRUE(ring.empty());
+    ASSERT_EQ(results.size(), numberOfBatches * batchSize);
+    for (unsigned i = 0; i < results.size(); i++)
+        EXPECT_EQ(results[i], i);
+}
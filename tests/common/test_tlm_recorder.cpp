@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "util/RequestListProducer.h"
+#include "util/SystemCTest.h"
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/DRAMSys.h>
+#include <DRAMSys/common/MemoryManager.h>
+#include <DRAMSys/controller/Command.h>
+#include <DRAMSys/initiators/request/RequestIssuer.h>
+
+#include <nlohmann/json.hpp>
+#include <sqlite3.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using DRAMSys::Initiators::Request;
+using DRAMSys::Initiators::RequestIssuer;
+
+class TlmRecorderTest : public SystemCTest
+{
+protected:
+    using RecordingTrigger = std::function<bool(
+        const tlm::tlm_generic_payload&, const tlm::tlm_phase&, const sc_core::sc_time&)>;
+
+    static constexpr std::size_t REQUEST_LENGTH = 64;
+    static inline const sc_core::sc_time REQUEST_INTERVAL{10, sc_core::SC_NS};
+    static inline const sc_core::sc_time SIMULATION_TIME{10, sc_core::SC_US};
+    static constexpr unsigned CHANNEL_BIT = 32;
+
+    TlmRecorderTest() :
+        config(DRAMSys::Config::from_path("b_transport/configs/no_storage.json"))
+    {
+        config.simconfig.DatabaseRecording = true;
+        config.simconfig.SimulationName = "tlm_recorder";
+        config.simconfig.SimulationProgressBar = false;
+    }
+
+    ~TlmRecorderTest() override { std::filesystem::remove(databaseName()); }
+
+    static std::vector<Request> sequentialReads(unsigned count, uint64_t offset = 0)
+    {
+        std::vector<Request> requests;
+        for (unsigned index = 0; index < count; index++)
+        {
+            requests.push_back(
+                {Request::Command::Read, offset + index * REQUEST_LENGTH, REQUEST_LENGTH});
+        }
+        return requests;
+    }
+
+    /**
+     * Splits the memory into two channels, selected by the address bit CHANNEL_BIT.
+     */
+    void useTwoChannels()
+    {
+        nlohmann::json memSpec = config.memspec;
+        memSpec["memarchitecturespec"]["nbrOfChannels"] = 2;
+        config.memspec = memSpec.get<DRAMUtils::MemSpec::MemSpecVariant>();
+
+        nlohmann::json addressMapping = config.addressmapping;
+        addressMapping["CHANNEL_BIT"] = nlohmann::json::array({CHANNEL_BIT});
+        config.addressmapping = addressMapping.get<DRAMSys::Config::AddressMapping>();
+    }
+
+    /**
+     * Issues the requests of every list on its own thread. The databases are finalized at the
+     * end of the simulation.
+     */
+    void simulate(const std::vector<std::vector<Request>>& requestsPerThread,
+                  const RecordingTrigger& trigger = nullptr)
+    {
+        DRAMSys::MemoryManager memoryManager(false);
+        DRAMSys::DRAMSys dramSys("DRAMSys", config);
+
+        if (trigger)
+            dramSys.registerRecordingTrigger(trigger);
+
+        std::vector<std::unique_ptr<RequestIssuer>> issuers;
+        for (std::size_t thread = 0; thread < requestsPerThread.size(); thread++)
+        {
+            issuers.push_back(std::make_unique<RequestIssuer>(
+                ("issuer" + std::to_string(thread)).c_str(),
+                std::make_unique<RequestListProducer>(requestsPerThread[thread], REQUEST_INTERVAL),
+                memoryManager,
+                dramSys.getMemSpec().tCK,
+                std::nullopt,
+                std::nullopt,
+                []() {},
+                []() {}));
+            issuers.back()->iSocket.bind(dramSys.tSocket);
+        }
+
+        sc_core::sc_start(SIMULATION_TIME);
+        sc_core::sc_stop();
+    }
+
+    [[nodiscard]] std::string databaseName(unsigned channel = 0) const
+    {
+        return "DRAMSys_" + config.simconfig.SimulationName.value() + "_ch" +
+               std::to_string(channel) + ".tdb";
+    }
+
+    /**
+     * Returns the first column of all rows of the query.
+     */
+    template <typename T = int64_t>
+    [[nodiscard]] static std::vector<T> query(const std::string& database, const std::string& sql)
+    {
+        sqlite3* db = nullptr;
+        EXPECT_EQ(sqlite3_open_v2(database.c_str(), &db, SQLITE_OPEN_READONLY, nullptr), SQLITE_OK);
+
+        sqlite3_stmt* statement = nullptr;
+        EXPECT_EQ(sqlite3_prepare_v2(db, sql.c_str(), -1, &statement, nullptr), SQLITE_OK)
+            << sqlite3_errmsg(db);
+
+        std::vector<T> values;
+        while (sqlite3_step(statement) == SQLITE_ROW)
+        {
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                const unsigned char* text = sqlite3_column_text(statement, 0);
+                values.emplace_back(text != nullptr ? reinterpret_cast<const char*>(text) : "");
+            }
+            else
+            {
+                values.push_back(sqlite3_column_int64(statement, 0));
+            }
+        }
+
+        sqlite3_finalize(statement);
+        sqlite3_close(db);
+        return values;
+    }
+
+    /**
+     * Every recorded read has to contain all of its phases and no phase may belong to a
+     * transaction that is not recorded.
+     */
+    static void expectCompleteReads(const std::string& database)
+    {
+        for (const std::string phase : {"REQ", "RD", "RESP"})
+        {
+            EXPECT_EQ(query(database,
+                            "SELECT COUNT(*) FROM Transactions WHERE Command = 'R' AND ID NOT IN "
+                            "(SELECT Transact FROM Phases WHERE PhaseName = '" +
+                                phase + "')"),
+                      std::vector<int64_t>{0})
+                << phase;
+        }
+
+        EXPECT_EQ(query(database,
+                        "SELECT COUNT(*) FROM PhaseData "
+                        "WHERE Transact NOT IN (SELECT ID FROM Transactions)"),
+                  std::vector<int64_t>{0});
+    }
+
+    DRAMSys::Config::Configuration config;
+};
+
+TEST_F(TlmRecorderTest, FlightRecorderNumbersTransactionsContiguously)
+{
+    config.simconfig.RecordingHistoryLength = 4;
+    config.simconfig.RecordingPostTriggerLength = 2;
+
+    // More transactions complete before each trigger than fit into the history
+    std::vector<Request> requests = sequentialReads(60);
+    const uint64_t firstTrigger = requests[20].address;
+    const uint64_t secondTrigger = requests[45].address;
+
+    simulate({requests},
+             [=](const tlm::tlm_generic_payload& trans,
+                 const tlm::tlm_phase& phase,
+                 [[maybe_unused]] const sc_core::sc_time& delay)
+             {
+                 return phase == DRAMSys::BEGIN_RD &&
+                        (trans.get_address() == firstTrigger ||
+                         trans.get_address() == secondTrigger);
+             });
+
+    EXPECT_EQ(query(databaseName(),
+                    "SELECT COUNT(*) FROM DebugMessages "
+                    "WHERE Message LIKE 'Flight recorder triggered%'"),
+              std::vector<int64_t>{2});
+
+    std::vector<int64_t> ids = query(databaseName(), "SELECT ID FROM Transactions ORDER BY ID");
+    ASSERT_FALSE(ids.empty());
+    EXPECT_LT(ids.size(), requests.size());
+    for (std::size_t index = 0; index < ids.size(); index++)
+        EXPECT_EQ(ids[index], static_cast<int64_t>(index + 1));
+
+    EXPECT_EQ(query(databaseName(),
+                    "SELECT COUNT(*) FROM PhaseData "
+                    "WHERE Transact NOT IN (SELECT ID FROM Transactions)"),
+              std::vector<int64_t>{0});
+}
+
+TEST_F(TlmRecorderTest, BulkLoadCreatesSameDatabaseAsIncrementalRecording)
+{
+    const std::vector<Request> requests = sequentialReads(20);
+    const std::string incrementalDatabase = "DRAMSys_tlm_recorder_incremental.tdb";
+
+    simulate({requests});
+    std::filesystem::rename(databaseName(), incrementalDatabase);
+    resetSimulationContext();
+
+    config.simconfig.RecordingBulkLoad = true;
+    simulate({requests});
+
+    const std::string schema = "SELECT type || ' ' || name || ' ' || tbl_name || ' ' || "
+                               "IFNULL(sql, '') FROM sqlite_master ORDER BY name";
+    const std::string ranges = "SELECT id || ' ' || begin || ' ' || end FROM ranges ORDER BY id";
+
+    EXPECT_EQ(query<std::string>(databaseName(), schema),
+              query<std::string>(incrementalDatabase, schema));
+    EXPECT_EQ(query<std::string>(databaseName(), ranges),
+              query<std::string>(incrementalDatabase, ranges));
+
+    std::filesystem::remove(incrementalDatabase);
+}
+
+TEST_F(TlmRecorderTest, TimeWindowsRecordTransactionsStartingWithinThem)
+{
+    // The refresh at tREFI lies outside of the window
+    config.simconfig.RecordingTimeWindows = {{100e-9, 300e-9}};
+    const std::vector<Request> requests = sequentialReads(60);
+
+    simulate({requests});
+
+    std::vector<int64_t> begins = query(databaseName(),
+                                        "SELECT PhaseBegin FROM Phases WHERE PhaseName = 'REQ' "
+                                        "ORDER BY PhaseBegin");
+    ASSERT_FALSE(begins.empty());
+    EXPECT_LT(begins.size(), requests.size());
+    for (int64_t begin : begins)
+    {
+        EXPECT_GE(sc_core::sc_time::from_value(begin), sc_core::sc_time(100, sc_core::SC_NS));
+        EXPECT_LT(sc_core::sc_time::from_value(begin), sc_core::sc_time(300, sc_core::SC_NS));
+    }
+
+    EXPECT_EQ(query(databaseName(), "SELECT COUNT(*) FROM Transactions"),
+              std::vector<int64_t>{static_cast<int64_t>(begins.size())});
+    expectCompleteReads(databaseName());
+}
+
+TEST_F(TlmRecorderTest, ThreadFilterRecordsOnlySelectedThreads)
+{
+    config.simconfig.RecordingThreads = {1};
+    const std::vector<Request> otherThread = sequentialReads(20);
+    const std::vector<Request> recordedThread = sequentialReads(20, 1 << 20);
+
+    simulate({otherThread, recordedThread});
+
+    std::vector<int64_t> addresses = query(
+        databaseName(), "SELECT Address FROM Transactions WHERE Command = 'R' ORDER BY Address");
+    std::vector<int64_t> expectedAddresses;
+    for (const Request& request : recordedThread)
+        expectedAddresses.push_back(static_cast<int64_t>(request.address));
+    EXPECT_EQ(addresses, expectedAddresses);
+
+    EXPECT_EQ(query(databaseName(),
+                    "SELECT COUNT(*) FROM Transactions WHERE Command = 'R' AND Thread != 1"),
+              std::vector<int64_t>{0});
+
+    // Refreshes are not associated with a thread and are always recorded
+    EXPECT_EQ(query(databaseName(), "SELECT COUNT(*) > 0 FROM Transactions WHERE Command = 'X'"),
+              std::vector<int64_t>{1});
+    expectCompleteReads(databaseName());
+}
+
+TEST_F(TlmRecorderTest, SampleIntervalRecordsEveryNthTransaction)
+{
+    config.simconfig.RecordingSampleInterval = 3;
+    const std::vector<Request> requests = sequentialReads(30);
+
+    simulate({requests});
+
+    std::vector<int64_t> addresses = query(
+        databaseName(), "SELECT Address FROM Transactions WHERE Command = 'R' ORDER BY Address");
+    std::vector<int64_t> expectedAddresses;
+    for (std::size_t index = 0; index < requests.size(); index += 3)
+        expectedAddresses.push_back(static_cast<int64_t>(requests[index].address));
+    EXPECT_EQ(addresses, expectedAddresses);
+
+    expectCompleteReads(databaseName());
+}
+
+TEST_F(TlmRecorderTest, ChannelFilterCreatesNoDatabaseForOtherChannels)
+{
+    useTwoChannels();
+    config.simconfig.RecordingChannels = {1};
+    const std::vector<Request> channel0 = sequentialReads(20);
+    const std::vector<Request> channel1 = sequentialReads(20, uint64_t{1} << CHANNEL_BIT);
+
+    // The channel without recorder is still simulated
+    simulate({channel0, channel1});
+
+    EXPECT_FALSE(std::filesystem::exists(databaseName(0)));
+    ASSERT_TRUE(std::filesystem::exists(databaseName(1)));
+
+    EXPECT_EQ(query(databaseName(1), "SELECT COUNT(*) FROM Transactions WHERE Command = 'R'"),
+              std::vector<int64_t>{static_cast<int64_t>(channel1.size())});
+    EXPECT_EQ(query(databaseName(1), "SELECT COUNT(*) FROM Transactions WHERE Channel != 1"),
+              std::vector<int64_t>{0});
+    expectCompleteReads(databaseName(1));
+
+    std::filesystem::remove(databaseName(1));
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/TraceSummary.h>
+
+using namespace DRAMSys;
+
+class TraceSummaryTest : public ::testing::Test
+{
+protected:
+    TraceSummaryTest()
+    {
+        metadata.numberOfBanks = 4;
+        metadata.clk = 1000;
+        metadata.windowSize = 10000;
+        metadata.phaseNames = {{REQ, "REQ"},
+                               {RESP, "RESP"},
+                               {ACT, "ACT"},
+                               {RD, "RD"},
+                               {WRA, "WRA"},
+                               {PREPB, "PREPB"},
+                               {PRESB, "PRESB"},
+                               {PREAB, "PREAB"},
+                               {REFAB, "REFAB"}};
+    }
+
+    // Phase name ids of a recorder are the tlm_phase values, any unique ids work here
+    static constexpr uint8_t REQ = 1;
+    static constexpr uint8_t RESP = 3;
+    static constexpr uint8_t ACT = 7;
+    static constexpr uint8_t RD = 8;
+    static constexpr uint8_t WRA = 12;
+    static constexpr uint8_t PREPB = 13;
+    static constexpr uint8_t PRESB = 14;
+    static constexpr uint8_t PREAB = 15;
+    static constexpr uint8_t REFAB = 24;
+
+    TraceMetadata metadata;
+};
+
+TEST_F(TraceSummaryTest, Counters)
+{
+    TraceSummary summary(metadata);
+
+    // Read with a row miss
+    summary.addTransaction(0, 'R', 64);
+    summary.addPhase(1, REQ, 0, 1000, 0, 0, 0, 0);
+    summary.addPhase(1, ACT, 2000, 3000, 0, 0, 0, 1);
+    summary.addPhase(1, RD, 5000, 6000, 8000, 12000, 0, 1);
+    summary.addPhase(1, RESP, 13000, 14000, 0, 0, 0, 0);
+
+    // Row hit in the same bank
+    summary.addTransaction(0, 'R', 64);
+    summary.addPhase(2, REQ, 1000, 2000, 0, 0, 0, 0);
+    summary.addPhase(2, RD, 9000, 10000, 12000, 16000, 0, 1);
+    summary.addPhase(2, RESP, 17000, 18000, 0, 0, 0, 0);
+
+    // Write of another thread
+    summary.addTransaction(3, 'W', 32);
+    summary.addPhase(3, REQ, 2000, 3000, 0, 0, 0, 0);
+    summary.addPhase(3, ACT, 3000, 4000, 0, 0, 0, 2);
+    summary.addPhase(3, WRA, 6000, 7000, 7000, 9000, 0, 2);
+    summary.addPhase(3, RESP, 8000, 9000, 0, 0, 0, 0);
+
+    // Refreshes are only counted
+    summary.addTransaction(0, 'X', 0);
+    summary.addPhase(4, REFAB, 20000, 25000, 0, 0, 0, 0);
+
+    EXPECT_EQ(summary.getNumberOfTransactions(), 4);
+    EXPECT_EQ(summary.getBegin(), 0);
+    EXPECT_EQ(summary.getEnd(), 25000);
+
+    const auto& threads = summary.getThreads();
+    ASSERT_EQ(threads.size(), 2);
+    EXPECT_EQ(threads.at(0).reads, 2);
+    EXPECT_EQ(threads.at(0).bytesRead, 128);
+    EXPECT_EQ(threads.at(3).writes, 1);
+    EXPECT_EQ(threads.at(3).bytesWritten, 32);
+
+    const auto& phaseCounts = summary.getPhaseCounts();
+    EXPECT_EQ(phaseCounts.at(RD), 2);
+    EXPECT_EQ(phaseCounts.at(ACT), 2);
+    EXPECT_EQ(phaseCounts.at(REFAB), 1);
+
+    const auto& banks = summary.getBanks();
+    ASSERT_EQ(banks.size(), 4);
+    EXPECT_EQ(banks[1].activates, 1);
+    EXPECT_EQ(banks[1].reads, 2);
+    EXPECT_EQ(banks[1].getRowHits(), 1);
+    EXPECT_EQ(banks[1].dataBusTime, 8000);
+    EXPECT_EQ(banks[2].writes, 1);
+    EXPECT_EQ(banks[2].precharges, 1);
+    EXPECT_EQ(banks[2].getRowHits(), 0);
+
+    // The burst from 8000 to 12000 spans two windows
+    const auto& windows = summary.getWindows();
+    ASSERT_EQ(windows.size(), 2);
+    EXPECT_EQ(windows[0].activates, 2);
+    EXPECT_EQ(windows[0].reads, 2);
+    EXPECT_EQ(windows[0].writes, 1);
+    EXPECT_EQ(windows[0].dataBusTime, 2000 + 2000);
+    EXPECT_EQ(windows[1].dataBusTime, 2000 + 4000);
+}
+
+TEST_F(TraceSummaryTest, Precharges)
+{
+    // Two ranks with two bank groups of four banks each
+    metadata.numberOfRanks = 2;
+    metadata.numberOfBankGroups = 4;
+    metadata.numberOfBanks = 16;
+    TraceSummary summary(metadata);
+
+    summary.addTransaction(0, 'X', 0);
+    summary.addPhase(1, PREPB, 0, 1000, 0, 0, 0, 1);
+
+    // Bank 1 of the second bank group of rank 0 and its same bank in the first bank group
+    summary.addTransaction(0, 'X', 0);
+    summary.addPhase(2, PRESB, 1000, 2000, 0, 0, 0, 5);
+
+    // The bank of an all-bank command is the first bank of its rank
+    summary.addTransaction(0, 'X', 0);
+    summary.addPhase(3, PREAB, 2000, 3000, 0, 0, 1, 8);
+
+    const auto& banks = summary.getBanks();
+    ASSERT_EQ(banks.size(), 16);
+    const uint64_t expected[] = {0, 2, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1};
+    for (std::size_t bank = 0; bank < banks.size(); bank++)
+        EXPECT_EQ(banks[bank].precharges, expected[bank]) << "Bank " << bank;
+}
+
+TEST_F(TraceSummaryTest, LatencyHistogram)
+{
+    TraceSummary summary(metadata);
+
+    // Latencies of 5, 5, 20 and 1000 cycles
+    const uint64_t latencies[] = {5, 5, 20, 1000};
+    uint64_t id = 0;
+    for (uint64_t latency : latencies)
+    {
+        id++;
+        summary.addTransaction(0, 'R', 64);
+        summary.addPhase(id, REQ, 0, 1000, 0, 0, 0, 0);
+        summary.addPhase(id, RESP, latency * 1000, latency * 1000 + 1000, 0, 0, 0, 0);
+    }
+
+    // A response without the request of its transaction is ignored
+    summary.addPhase(id + 1, RESP, 3000, 4000, 0, 0, 0, 0);
+
+    auto histogram = summary.getLatencyHistogram();
+    ASSERT_EQ(histogram.size(), 3);
+
+    EXPECT_EQ(histogram[0].lowerBound, 5000);
+    EXPECT_EQ(histogram[0].upperBound, 6000);
+    EXPECT_EQ(histogram[0].count, 2);
+
+    EXPECT_EQ(histogram[1].lowerBound, 20000);
+    EXPECT_EQ(histogram[1].upperBound, 21000);
+    EXPECT_EQ(histogram[1].count, 1);
+
+    // The bins are the buckets of a Statistics::Histogram, their relative width is below
+    // 2^-SUB_BUCKET_BITS
+    EXPECT_LE(histogram[2].lowerBound, 1000000);
+    EXPECT_GT(histogram[2].upperBound, 1000000);
+    EXPECT_LE(histogram[2].upperBound - histogram[2].lowerBound,
+              histogram[2].lowerBound >> Statistics::Histogram::SUB_BUCKET_BITS);
+    EXPECT_EQ(histogram[2].count, 1);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/WorkerPool.h>
+
+#include <vector>
+
+using namespace DRAMSys;
+
+TEST(WorkerPoolTest, LaneOrder)
+{
+    constexpr std::size_t numberOfLanes = 8;
+    constexpr unsigned numberOfTasks = 1000;
+
+    WorkerPool workerPool(3, numberOfLanes);
+    std::vector<std::vector<unsigned>> results(numberOfLanes);
+
+    for (unsigned task = 0; task < numberOfTasks; task++)
+    {
+        for (std::size_t lane = 0; lane < numberOfLanes; lane++)
+            workerPool.submit(lane, [&results, lane, task]() { results[lane].push_back(task); });
+    }
+
+    for (std::size_t lane = 0; lane < numberOfLanes; lane++)
+    {
+        workerPool.wait(lane);
+
+        ASSERT_EQ(results[lane].size(), numberOfTasks);
+        for (unsigned task = 0; task < numberOfTasks; task++)
+            EXPECT_EQ(results[lane][task], task);
+    }
+}
+
+TEST(WorkerPoolTest, RemainingTasksOnDestruction)
+{
+    unsigned counter = 0;
+
+    {
+        WorkerPool workerPool(1, 1);
+        for (unsigned task = 0; task < 100; task++)
+            workerPool.submit(0, [&counter]() { counter++; });
+    }
+
+    EXPECT_EQ(counter, 100);
+}
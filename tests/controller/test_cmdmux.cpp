@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+
+#include "util/SystemCTest.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <DRAMSys/common/dramExtensions.h>
+#include <DRAMSys/configuration/memspec/MemSpecHBM2.h>
+#include <DRAMSys/controller/cmdmux/CmdMuxOldest.h>
+
+#include <fstream>
+
+using namespace DRAMSys;
+
+class CmdMuxRasCasTest : public SystemCTest
+{
+protected:
+    CmdMuxRasCasTest() :
+        memSpec(nlohmann::json::parse(std::ifstream("../configs/memspec/HBM2.json"))
+                    .at("memspec")
+                    .get<DRAMUtils::MemSpec::MemSpecHBM2>()),
+        cmdMux(memSpec)
+    {
+        for (std::size_t i = 0; i < payloads.size(); i++)
+        {
+            ControllerExtension::setExtension(payloads[i],
+                                              i + 1,
+                                              Rank(0),
+                                              Stack(0),
+                                              BankGroup(0),
+                                              Bank(i),
+                                              Row(0),
+                                              Column(0),
+                                              memSpec.defaultBurstLength);
+        }
+    }
+
+    MemSpecHBM2 memSpec;
+    CmdMuxOldestRasCas cmdMux;
+    std::array<tlm::tlm_generic_payload, 3> payloads;
+};
+
+TEST_F(CmdMuxRasCasTest, SelectsOneCommandPerBus)
+{
+    CmdMuxIF::ReadyCommands readyCommands = {
+        {Command::ACT, &payloads[0], sc_core::SC_ZERO_TIME},
+        {Command::RD, &payloads[1], sc_core::SC_ZERO_TIME},
+        {Command::WR, &payloads[2], sc_core::SC_ZERO_TIME},
+    };
+
+    auto selectedCommands = cmdMux.selectCommands(readyCommands);
+    ASSERT_TRUE(selectedCommands[0].has_value());
+    ASSERT_TRUE(selectedCommands[1].has_value());
+
+    // Both candidates are ready, the older request is issued first
+    EXPECT_EQ(selectedCommands[0]->trans, &payloads[0]);
+    EXPECT_EQ(selectedCommands[1]->trans, &payloads[1]);
+    EXPECT_NE(selectedCommands[0]->command.isCasCommand(),
+              selectedCommands[1]->command.isCasCommand());
+}
+
+TEST_F(CmdMuxRasCasTest, OtherBusNotReady)
+{
+    CmdMuxIF::ReadyCommands readyCommands = {
+        {Command::ACT, &payloads[0], sc_core::sc_time(1, sc_core::SC_NS)},
+        {Command::RD, &payloads[1], sc_core::SC_ZERO_TIME},
+    };
+
+    auto selectedCommands = cmdMux.selectCommands(readyCommands);
+    ASSERT_TRUE(selectedCommands[0].has_value());
+    EXPECT_EQ(selectedCommands[0]->trans, &payloads[1]);
+    EXPECT_FALSE(selectedCommands[1].has_value());
+
+    EXPECT_EQ(cmdMux.selectCommand(readyCommands)->trans, &payloads[1]);
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "util/RequestListProducer.h"
+#include "util/SystemCTest.h"
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/DRAMSys.h>
+#include <DRAMSys/common/MemoryManager.h>
+#include <DRAMSys/initiators/request/RequestIssuer.h>
+#include <DRAMSys/statistics/StatProvider.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using DRAMSys::Initiators::Request;
+using DRAMSys::Initiators::RequestIssuer;
+using namespace DRAMSys::Statistics;
+
+class ControllerStatsTest : public SystemCTest
+{
+protected:
+    // DDR4 with the address mapping of the configuration: the column starts at bit 3, the row at
+    // bit 13 and the bank group at bit 28
+    static constexpr uint64_t COLUMN = uint64_t{1} << 6;
+    static constexpr uint64_t ROW = uint64_t{1} << 13;
+    static constexpr uint64_t BANK_GROUP = uint64_t{1} << 28;
+    static constexpr unsigned BANKS_PER_GROUP = 4;
+    static constexpr unsigned REQUEST_LENGTH = 64;
+
+    // Ends before the first refresh
+    static inline const sc_core::sc_time SIMULATION_TIME{2, sc_core::SC_US};
+
+    ControllerStatsTest() :
+        config(DRAMSys::Config::from_path("b_transport/configs/no_storage.json"))
+    {
+        config.simconfig.SimulationProgressBar = false;
+    }
+
+    /**
+     * Simulates the requests with the given interval and returns the updated statistics of the
+     * controller.
+     */
+    const Group& simulate(const std::vector<Request>& requests, sc_core::sc_time interval)
+    {
+        dramSys = std::make_unique<DRAMSys::DRAMSys>("DRAMSys", config);
+        issuer = std::make_unique<RequestIssuer>(
+            "issuer",
+            std::make_unique<RequestListProducer>(requests, interval),
+            memoryManager,
+            dramSys->getMemSpec().tCK,
+            std::nullopt,
+            std::nullopt,
+            []() {},
+            []() {});
+        issuer->iSocket.bind(dramSys->tSocket);
+
+        sc_core::sc_start(SIMULATION_TIME);
+
+        auto& controller =
+            dynamic_cast<StatProvider&>(*sc_core::sc_find_object("DRAMSys.controller0"));
+        controller.updateStats();
+        return controller.getStatGroup();
+    }
+
+    static const Group& findGroup(const Group& group, std::string_view name)
+    {
+        for (const Group* subGroup : group.subGroups)
+        {
+            if (subGroup->name == name)
+                return *subGroup;
+        }
+
+        ADD_FAILURE() << "Missing group " << name;
+        return group;
+    }
+
+    template <typename T> static const T& findStat(const Group& group, std::string_view name)
+    {
+        for (const auto& stat : group.stats)
+        {
+            const auto* typedStat = dynamic_cast<const T*>(stat.get());
+            if (typedStat != nullptr && typedStat->name == name)
+                return *typedStat;
+        }
+
+        ADD_FAILURE() << "Missing statistic " << name;
+        static const T missing(std::string(name), "", Quantity::Count);
+        return missing;
+    }
+
+    static double scalar(const Group& group, std::string_view name)
+    {
+        return findStat<ScalarStat>(group, name).value;
+    }
+
+    DRAMSys::Config::Configuration config;
+    DRAMSys::MemoryManager memoryManager{false};
+    std::unique_ptr<DRAMSys::DRAMSys> dramSys;
+    std::unique_ptr<RequestIssuer> issuer;
+};
+
+TEST_F(ControllerStatsTest, ClassifiesRowAccesses)
+{
+    using Command = Request::Command;
+
+    // The requests are far enough apart to be scheduled one after another
+    const std::vector<Request> requests = {
+        {Command::Read, 0, REQUEST_LENGTH},                // Bank 0 closed: miss
+        {Command::Read, COLUMN, REQUEST_LENGTH},           // Row 0 open: hit
+        {Command::Read, 2 * COLUMN, REQUEST_LENGTH},       // Row 0 open: hit
+        {Command::Read, ROW, REQUEST_LENGTH},              // Row 0 open: conflict
+        {Command::Read, ROW + COLUMN, REQUEST_LENGTH},     // Row 1 open: hit
+        {Command::Read, BANK_GROUP, REQUEST_LENGTH},       // Bank 4 closed: miss
+        {Command::Write, COLUMN, REQUEST_LENGTH},          // Row 1 open: conflict
+        {Command::Write, BANK_GROUP + ROW, REQUEST_LENGTH} // Row 0 open: conflict
+    };
+
+    const Group& stats = simulate(requests, sc_core::sc_time(100, sc_core::SC_NS));
+
+    std::vector<double> hits(16, 0);
+    std::vector<double> misses(16, 0);
+    std::vector<double> conflicts(16, 0);
+    hits[0] = 3;
+    misses[0] = 1;
+    conflicts[0] = 2;
+    misses[BANKS_PER_GROUP] = 1;
+    conflicts[BANKS_PER_GROUP] = 1;
+
+    EXPECT_EQ(findStat<VectorStat>(stats, "RowHitsPerBank").values, hits);
+    EXPECT_EQ(findStat<VectorStat>(stats, "RowMissesPerBank").values, misses);
+    EXPECT_EQ(findStat<VectorStat>(stats, "RowConflictsPerBank").values, conflicts);
+
+    const Group& rank = findGroup(stats, "ra0");
+    EXPECT_EQ(scalar(rank, "RowHits"), 3);
+    EXPECT_EQ(scalar(rank, "RowMisses"), 2);
+    EXPECT_EQ(scalar(rank, "RowConflicts"), 3);
+
+    // Every miss and conflict activates a row, only the conflicts precharge one
+    const Group& commands = findGroup(stats, "commands");
+    EXPECT_EQ(scalar(commands, "ACT"), 5);
+    EXPECT_EQ(scalar(commands, "PREPB"), 3);
+    EXPECT_EQ(scalar(commands, "RD"), 6);
+    EXPECT_EQ(scalar(commands, "WR"), 2);
+    EXPECT_EQ(scalar(commands, "REFAB"), 0);
+
+    // Only one request is pending at a time
+    EXPECT_EQ(scalar(stats, "MaximumSchedulerOccupancy"), 1);
+    EXPECT_EQ(scalar(stats, "BankLevelParallelism"), 1);
+    EXPECT_GT(scalar(stats, "AverageSchedulerOccupancy"), 0);
+    EXPECT_LT(scalar(stats, "AverageSchedulerOccupancy"), 1);
+}
+
+TEST_F(ControllerStatsTest, MeasuresBankLevelParallelism)
+{
+    // One request per bank group, issued faster than they can be served
+    std::vector<Request> requests;
+    for (unsigned bankGroup = 0; bankGroup < 4; bankGroup++)
+        requests.push_back({Request::Command::Read, bankGroup * BANK_GROUP, REQUEST_LENGTH});
+
+    const Group& stats = simulate(requests, sc_core::sc_time(1, sc_core::SC_NS));
+
+    EXPECT_EQ(scalar(findGroup(stats, "ra0"), "RowMisses"), 4);
+    EXPECT_EQ(scalar(findGroup(stats, "commands"), "ACT"), 4);
+
+    const double maximumOccupancy = scalar(stats, "MaximumSchedulerOccupancy");
+    EXPECT_GT(maximumOccupancy, 1);
+    EXPECT_LE(maximumOccupancy, 4);
+
+    const double bankLevelParallelism = scalar(stats, "BankLevelParallelism");
+    EXPECT_GT(bankLevelParallelism, 1);
+    EXPECT_LE(bankLevelParallelism, maximumOccupancy);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include "util/SystemCTest.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <DRAMSys/configuration/memspec/MemSpecDDR4.h>
+#include <DRAMSys/configuration/memspec/MemSpecLPDDR4.h>
+#include <DRAMSys/controller/McConfig.h>
+#include <DRAMSys/controller/powerdown/PowerDownManagerDummy.h>
+#include <DRAMSys/controller/refresh/RefreshManagerAllBank.h>
+#include <DRAMSys/controller/refresh/RefreshManagerPerBank.h>
+
+#include <fstream>
+
+using namespace DRAMSys;
+
+class RefreshManagerTest : public SystemCTest
+{
+protected:
+    static Config::McConfig mcConfig()
+    {
+        Config::McConfig config{};
+        config.RefreshMaxPostponed = 0;
+        config.RefreshMaxPulledin = 2;
+        return config;
+    }
+
+    MemSpecDDR4 ddr4MemSpec{
+        nlohmann::json::parse(std::ifstream("../configs/memspec/JEDEC_4Gb_DDR4-2400_8bit_A.json"))
+            .at("memspec")
+            .get<DRAMUtils::MemSpec::MemSpecDDR4>()};
+    MemSpecLPDDR4 lpddr4MemSpec{
+        nlohmann::json::parse(std::ifstream("../configs/memspec/JEDEC_8Gb_LPDDR4-3200_16bit.json"))
+            .at("memspec")
+            .get<DRAMUtils::MemSpec::MemSpecLPDDR4>()};
+
+    ControllerVector<Bank, BankMachine*> bankMachines;
+    PowerDownManagerDummy powerDownManager;
+};
+
+TEST_F(RefreshManagerTest, PulledInAllBankRefreshIsNotForced)
+{
+    McConfig config(mcConfig(), ddr4MemSpec);
+    RefreshManagerAllBank refreshManager(
+        config, ddr4MemSpec, bankMachines, powerDownManager, Rank(0));
+
+    // Without postponing, the next regular refresh is forced
+    EXPECT_TRUE(refreshManager.isRefreshForced());
+
+    // The following refreshes are pulled in until the limit is reached
+    refreshManager.update(Command::REFAB);
+    EXPECT_FALSE(refreshManager.isRefreshForced());
+    refreshManager.update(Command::REFAB);
+    EXPECT_FALSE(refreshManager.isRefreshForced());
+}
+
+TEST_F(RefreshManagerTest, AllBankRefreshAfterSelfRefreshIsNotForced)
+{
+    McConfig config(mcConfig(), ddr4MemSpec);
+    RefreshManagerAllBank refreshManager(
+        config, ddr4MemSpec, bankMachines, powerDownManager, Rank(0));
+
+    refreshManager.update(Command::SREFEN);
+    EXPECT_FALSE(refreshManager.isRefreshForced());
+
+    // The refresh after the self-refresh exit restarts the regular refreshes
+    refreshManager.update(Command::SREFEX);
+    EXPECT_FALSE(refreshManager.isRefreshForced());
+    refreshManager.update(Command::REFAB);
+    EXPECT_TRUE(refreshManager.isRefreshForced());
+}
+
+TEST_F(RefreshManagerTest, PerBankRefreshInPowerDownIsNotForced)
+{
+    McConfig config(mcConfig(), lpddr4MemSpec);
+    RefreshManagerPerBank refreshManager(
+        config, lpddr4MemSpec, bankMachines, powerDownManager, Rank(0));
+
+    EXPECT_TRUE(refreshManager.isRefreshForced());
+
+    refreshManager.update(Command::PDEA);
+    EXPECT_FALSE(refreshManager.isRefreshForced());
+
+    refreshManager.update(Command::PDXA);
+    EXPECT_TRUE(refreshManager.isRefreshForced());
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/CompressedFile.h>
+#include <DRAMSys/initiators/player/StlTraceParser.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace DRAMSys::Initiators;
+
+using LineContent = StlTraceParser::LineContent;
+
+TEST(StlTraceParser, ParseLine)
+{
+    LineContent content;
+
+    EXPECT_TRUE(StlTraceParser::parseLine("31:  read  0x400140", false, content));
+    EXPECT_EQ(content.cycle, 31);
+    EXPECT_EQ(content.command, LineContent::Command::Read);
+    EXPECT_EQ(content.address, 0x400140);
+    EXPECT_FALSE(content.dataLength.has_value());
+
+    EXPECT_TRUE(StlTraceParser::parseLine("42:\t(32) write 0x400180", false, content));
+    EXPECT_EQ(content.cycle, 42);
+    EXPECT_EQ(content.command, LineContent::Command::Write);
+    EXPECT_EQ(content.address, 0x400180);
+    EXPECT_EQ(content.dataLength, 32U);
+}
+
+TEST(StlTraceParser, ParseData)
+{
+    LineContent content;
+
+    EXPECT_TRUE(StlTraceParser::parseLine("5: write 0x0 0x01020a0b", true, content));
+    ASSERT_EQ(content.data.size(), 4);
+    EXPECT_EQ(content.data[0], 0x0b);
+    EXPECT_EQ(content.data[1], 0x0a);
+    EXPECT_EQ(content.data[2], 0x02);
+    EXPECT_EQ(content.data[3], 0x01);
+}
+
+TEST(StlTraceParser, ParseLongData)
+{
+    LineContent content;
+
+    std::string hex;
+    for (unsigned byte = 0; byte < 37; byte++)
+    {
+        static constexpr std::string_view DIGITS = "0123456789ABCDEFabcdef";
+        hex.insert(0, {DIGITS[(byte * 7) % DIGITS.size()], DIGITS[byte % DIGITS.size()]});
+    }
+
+    EXPECT_TRUE(StlTraceParser::parseLine("5: write 0x0 0x" + hex, true, content));
+    ASSERT_EQ(content.data.size(), 37);
+    for (std::size_t byte = 0; byte < content.data.size(); byte++)
+    {
+        std::size_t position = hex.size() - 2 * (byte + 1);
+        EXPECT_EQ(content.data[byte], std::stoul(hex.substr(position, 2), nullptr, 16));
+    }
+
+    // A leading odd digit is ignored
+    EXPECT_TRUE(StlTraceParser::parseLine("5: write 0x0 0xF0123456789", true, content));
+    ASSERT_EQ(content.data.size(), 5);
+    EXPECT_EQ(content.data[0], 0x89);
+    EXPECT_EQ(content.data[4], 0x01);
+}
+
+TEST(StlTraceParser, RejectsMalformedData)
+{
+    LineContent content;
+
+    EXPECT_THROW(StlTraceParser::parseLine("5: write 0x0 0x0123456g", true, content),
+                 std::runtime_error);
+    EXPECT_THROW(StlTraceParser::parseLine("5: write 0x0 0x01234567:9abcdef", true, content),
+                 std::runtime_error);
+    EXPECT_THROW(StlTraceParser::parseLine("5: write 0x0 0x0G", true, content),
+                 std::runtime_error);
+    EXPECT_THROW(StlTraceParser::parseLine("5: write 0x0", true, content), std::runtime_error);
+}
+
+TEST(StlTraceParser, SkipsCommentsAndEmptyLines)
+{
+    LineContent content;
+
+    EXPECT_FALSE(StlTraceParser::parseLine("", false, content));
+    EXPECT_FALSE(StlTraceParser::parseLine("# comment", false, content));
+}
+
+TEST(StlTraceParser, RejectsMalformedLines)
+{
+    LineContent content;
+
+    EXPECT_THROW(StlTraceParser::parseLine("31: fetch 0x0", false, content), std::runtime_error);
+    EXPECT_THROW(StlTraceParser::parseLine("31: read", false, content), std::runtime_error);
+    EXPECT_THROW(StlTraceParser::parseLine("read 0x0", false, content), std::runtime_error);
+}
+
+TEST(StlTraceParser, ParsesWholeTrace)
+{
+    std::filesystem::path trace = "test_stl_trace_parser.stl";
+    constexpr uint64_t numberOfLines = 3 * StlTraceParser::BLOCK_SIZE + 17;
+
+    {
+        std::ofstream file(trace);
+        file << "# header\n";
+        for (uint64_t line = 0; line < numberOfLines; line++)
+            file << line << ": " << (line % 2 == 0 ? "read" : "write") << " 0x" << std::hex
+                 << line * 64 << std::dec << "\n";
+    }
+
+    {
+        StlTraceParser parser(trace, false);
+
+        uint64_t line = 0;
+        while (const StlTraceParser::Block* block = parser.nextBlock())
+        {
+            for (std::size_t index = 0; index < block->size; index++, line++)
+            {
+                EXPECT_EQ(block->lines[index].cycle, line);
+                EXPECT_EQ(block->lines[index].address, line * 64);
+            }
+        }
+
+        EXPECT_EQ(line, numberOfLines);
+        EXPECT_EQ(parser.estimateNumberOfLines(), numberOfLines);
+    }
+
+    std::filesystem::remove(trace);
+}
+
+TEST(StlTraceParser, ParsesGzipTrace)
+{
+    using DRAMSys::CompressedFile;
+    if (!CompressedFile::isSupported(CompressedFile::Format::Gzip))
+        GTEST_SKIP() << "DRAMSys was built without zlib";
+
+    // Eight lines "i:\t(read|write)\t0x(i * 64)" compressed with gzip
+    const std::vector<unsigned char> compressed = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x33, 0xb0,
+    0xe2, 0x2c, 0x4a, 0x4d, 0x4c, 0xe1, 0x34, 0xa8, 0x30, 0xe0, 0x32, 0xb4,
+    0xe2, 0x2c, 0x2f, 0xca, 0x2c, 0x49, 0x05, 0x72, 0x4c, 0x0c, 0xb8, 0x8c,
+    0xe0, 0x32, 0x16, 0x06, 0x5c, 0xc6, 0x08, 0xa9, 0x64, 0x03, 0x2e, 0x13,
+    0xb8, 0x94, 0xa1, 0x81, 0x01, 0x97, 0x29, 0x42, 0xce, 0x10, 0xa8, 0xcf,
+    0x0c, 0x21, 0x09, 0xd4, 0x68, 0x8e, 0x24, 0x09, 0xd4, 0x09, 0x00, 0xff,
+    0xcd, 0xde, 0x72, 0x6f, 0x00, 0x00, 0x00,
+    };
+
+    std::filesystem::path trace = "test_stl_trace_parser.stl.gz";
+    std::ofstream(trace, std::ios::binary)
+        .write(reinterpret_cast<const char*>(compressed.data()),
+               static_cast<std::streamsize>(compressed.size()));
+
+    {
+        StlTraceParser parser(trace, false);
+
+        uint64_t line = 0;
+        while (const StlTraceParser::Block* block = parser.nextBlock())
+        {
+            for (std::size_t index = 0; index < block->size; index++, line++)
+            {
+                EXPECT_EQ(block->lines[index].cycle, line);
+                EXPECT_EQ(block->lines[index].address, line * 64);
+            }
+        }
+
+        EXPECT_EQ(line, 8);
+        EXPECT_EQ(parser.estimateNumberOfLines(), 8);
+    }
+
+    std::filesystem::remove(trace);
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/initiators/generator/AliasTable.h>
+#include <DRAMSys/initiators/generator/TrafficGenerator.h>
+#include <DRAMSys/initiators/generator/Xoshiro256.h>
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+using namespace DRAMSys::Initiators;
+using DRAMSys::Config::AddressDistribution;
+using DRAMSys::Config::TrafficGeneratorActiveState;
+using DRAMSys::Config::TrafficGeneratorIdleState;
+using DRAMSys::Config::TrafficGeneratorStateMachine;
+
+namespace
+{
+
+constexpr uint64_t MEMORY_SIZE = uint64_t{1} << 20U;
+
+TrafficGeneratorStateMachine stateMachine(uint64_t seed)
+{
+    // 0 -> {idle 1 -> 0, 2 -> {0, 3 -> stop}}
+    return {1000,
+            "generator",
+            std::nullopt,
+            std::nullopt,
+            seed,
+            std::nullopt,
+            64,
+            std::nullopt,
+            {TrafficGeneratorActiveState{
+                 0, 1000, 0.5, AddressDistribution::Random, std::nullopt, std::nullopt, {}},
+             TrafficGeneratorIdleState{1, 10},
+             TrafficGeneratorActiveState{
+                 2, 333, 1.0, AddressDistribution::Sequential, std::nullopt, std::nullopt, {}},
+             TrafficGeneratorActiveState{
+                 3, 5, 0.0, AddressDistribution::Sequential, std::nullopt, std::nullopt, {}}},
+            {{0, 1, 0.6F}, {0, 2, 0.4F}, {1, 0, 1.0F}, {2, 0, 0.7F}, {2, 3, 0.3F}}};
+}
+
+std::vector<Request> generateAll(TrafficGenerator& generator)
+{
+    std::vector<Request> requests;
+    for (Request request = generator.nextRequest(); request.command != Request::Command::Stop;
+         request = generator.nextRequest())
+        requests.push_back(request);
+
+    return requests;
+}
+
+} // namespace
+
+TEST(Xoshiro256, NextBelowStaysInRange)
+{
+    Xoshiro256 generator(42);
+
+    std::array<unsigned, 7> histogram{};
+    for (unsigned i = 0; i < 70000; i++)
+        histogram.at(generator.nextBelow(histogram.size()))++;
+
+    for (unsigned count : histogram)
+        EXPECT_NEAR(count, 10000, 500);
+}
+
+TEST(AliasTable, SamplesWeights)
+{
+    AliasTable table({1.0, 0.0, 3.0, 6.0});
+    Xoshiro256 generator(1);
+
+    std::array<unsigned, 4> histogram{};
+    for (unsigned i = 0; i < 100000; i++)
+        histogram.at(table.sample(generator))++;
+
+    EXPECT_NEAR(histogram[0], 10000, 500);
+    EXPECT_EQ(histogram[1], 0);
+    EXPECT_NEAR(histogram[2], 30000, 1000);
+    EXPECT_NEAR(histogram[3], 60000, 1000);
+
+    EXPECT_THROW(AliasTable({}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({0.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({1.0, -1.0}), std::invalid_argument);
+}
+
+TEST(TrafficGenerator, TotalRequestsMatchesGeneratedRequests)
+{
+    TrafficGenerator generator(stateMachine(7), MEMORY_SIZE);
+
+    uint64_t totalRequests = generator.totalRequests();
+    std::vector<Request> requests = generateAll(generator);
+
+    EXPECT_EQ(requests.size(), totalRequests);
+    EXPECT_GT(requests.size(), TrafficGenerator::BATCH_SIZE);
+
+    for (Request const& request : requests)
+    {
+        EXPECT_LT(request.address, MEMORY_SIZE);
+        EXPECT_EQ(request.address % 64, 0);
+        EXPECT_EQ(request.length, 64);
+    }
+}
+
+TEST(TrafficGenerator, IsDeterministicPerSeed)
+{
+    TrafficGenerator first(stateMachine(7), MEMORY_SIZE);
+    TrafficGenerator second(stateMachine(7), MEMORY_SIZE);
+    TrafficGenerator other(stateMachine(8), MEMORY_SIZE);
+
+    std::vector<Request> firstRequests = generateAll(first);
+    std::vector<Request> secondRequests = generateAll(second);
+    std::vector<Request> otherRequests = generateAll(other);
+
+    ASSERT_EQ(firstRequests.size(), secondRequests.size());
+    for (std::size_t i = 0; i < firstRequests.size(); i++)
+    {
+        EXPECT_EQ(firstRequests[i].command, secondRequests[i].command);
+        EXPECT_EQ(firstRequests[i].address, secondRequests[i].address);
+    }
+
+    bool differs = firstRequests.size() != otherRequests.size();
+    for (std::size_t i = 0; !differs && i < firstRequests.size(); i++)
+        differs = firstRequests[i].address != otherRequests[i].address;
+    EXPECT_TRUE(differs);
+}
+
+TEST(TrafficGenerator, IdleStatesDelayTheNextRequest)
+{
+    TrafficGenerator generator(stateMachine(7), MEMORY_SIZE);
+    const sc_core::sc_time period(1.0 / 1000, sc_core::SC_US);
+
+    uint64_t idleTriggers = 0;
+    for (Request request = generator.nextRequest(); request.command != Request::Command::Stop;
+         request = generator.nextRequest())
+    {
+        sc_core::sc_time trigger = generator.nextTrigger();
+        if (trigger == period * 11)
+        {
+            idleTriggers++;
+        }
+        else if (trigger != sc_core::SC_ZERO_TIME)
+        {
+            EXPECT_EQ(trigger, period);
+        }
+    }
+
+    EXPECT_GT(idleTriggers, 0);
+}
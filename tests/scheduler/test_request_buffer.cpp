@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/common/dramExtensions.h>
+#include <DRAMSys/controller/scheduler/RequestBuffer.h>
+
+#include <array>
+#include <vector>
+
+using namespace DRAMSys;
+
+class RequestBufferTest : public testing::Test
+{
+protected:
+    RequestBufferTest()
+    {
+        for (std::size_t i = 0; i < payloads.size(); i++)
+        {
+            ControllerExtension::setExtension(payloads[i],
+                                              i,
+                                              Rank(0),
+                                              Stack(0),
+                                              BankGroup(0),
+                                              Bank(0),
+                                              Row(rows[i]),
+                                              Column(0),
+                                              16);
+        }
+    }
+
+    static constexpr std::array<std::size_t, 5> rows = {3, 7, 3, 3, 7};
+    std::array<tlm::tlm_generic_payload, 5> payloads;
+    RequestBuffer buffer;
+};
+
+TEST_F(RequestBufferTest, RowHitsInAgeOrder)
+{
+    for (auto& payload : payloads)
+        buffer.push_back(payload);
+
+    EXPECT_EQ(buffer.size(), 5U);
+    EXPECT_EQ(buffer.front(), &payloads[0]);
+    EXPECT_EQ(buffer.getNumberOfRowHits(Row(3)), 3U);
+    EXPECT_EQ(buffer.getNumberOfRowHits(Row(7)), 2U);
+    EXPECT_EQ(buffer.getNumberOfRowHits(Row(5)), 0U);
+    EXPECT_EQ(buffer.getOldestRowHit(Row(7)), &payloads[1]);
+    EXPECT_EQ(buffer.getOldestRowHit(Row(5)), nullptr);
+}
+
+TEST_F(RequestBufferTest, RemoveKeepsIndexConsistent)
+{
+    for (auto& payload : payloads)
+        buffer.push_back(payload);
+
+    // Cache the lookup of row 3 before modifying it
+    EXPECT_EQ(buffer.getOldestRowHit(Row(3)), &payloads[0]);
+
+    buffer.remove(payloads[0]);
+    EXPECT_EQ(buffer.front(), &payloads[1]);
+    EXPECT_EQ(buffer.getOldestRowHit(Row(3)), &payloads[2]);
+
+    buffer.remove(payloads[2]);
+    buffer.remove(payloads[3]);
+    EXPECT_EQ(buffer.getOldestRowHit(Row(3)), nullptr);
+
+    // Row becomes pending again after it was cached as empty
+    buffer.push_back(payloads[0]);
+    EXPECT_EQ(buffer.getOldestRowHit(Row(3)), &payloads[0]);
+    EXPECT_EQ(buffer.getNumberOfRowHits(Row(7)), 2U);
+    EXPECT_EQ(buffer.size(), 3U);
+}
+
+TEST(RequestBuffer, ManyRows)
+{
+    // Enough distinct rows to grow the row index several times
+    constexpr std::size_t numberOfPayloads = 256;
+    constexpr std::size_t numberOfRows = 97;
+
+    std::vector<tlm::tlm_generic_payload> payloads(numberOfPayloads);
+    RequestBuffer buffer;
+
+    for (std::size_t i = 0; i < numberOfPayloads; i++)
+    {
+        ControllerExtension::setExtension(payloads[i],
+                                          i,
+                                          Rank(0),
+                                          Stack(0),
+                                          BankGroup(0),
+                                          Bank(0),
+                                          Row(i % numberOfRows),
+                                          Column(0),
+                                          16);
+        buffer.push_back(payloads[i]);
+    }
+
+    // Remove every other request, the remaining requests keep their age order
+    for (std::size_t i = 0; i < numberOfPayloads; i += 2)
+        buffer.remove(payloads[i]);
+
+    EXPECT_EQ(buffer.size(), numberOfPayloads / 2);
+    EXPECT_EQ(buffer.front(), &payloads[1]);
+
+    for (std::size_t row = 0; row < numberOfRows; row++)
+    {
+        std::size_t expectedRowHits = 0;
+        tlm::tlm_generic_payload* expectedOldest = nullptr;
+        for (std::size_t i = row; i < numberOfPayloads; i += numberOfRows)
+        {
+            if (i % 2 == 1)
+            {
+                expectedRowHits++;
+                if (expectedOldest == nullptr)
+                    expectedOldest = &payloads[i];
+            }
+        }
+
+        EXPECT_EQ(buffer.getNumberOfRowHits(Row(row)), expectedRowHits);
+        EXPECT_EQ(buffer.getOldestRowHit(Row(row)), expectedOldest);
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <gtest/gtest.h>
+
+#include <DRAMSys/statistics/Histogram.h>
+
+#include <cstddef>
+#include <vector>
+
+using namespace DRAMSys::Statistics;
+
+TEST(Histogram, BucketsCoverAllValues)
+{
+    for (uint64_t value : {uint64_t(0), uint64_t(31), uint64_t(63), uint64_t(64), uint64_t(1000),
+                           uint64_t(123456789), UINT64_MAX})
+    {
+        auto [lower, upper] = Histogram::getBucketBounds(Histogram::getBucketIndex(value));
+        EXPECT_LE(lower, value);
+        EXPECT_GE(upper, value);
+    }
+
+    for (std::size_t index = 1; index < Histogram::getBucketIndex(UINT64_MAX); index++)
+    {
+        EXPECT_EQ(Histogram::getBucketBounds(index).first,
+                  Histogram::getBucketBounds(index - 1).second + 1);
+    }
+}
+
+TEST(Histogram, Percentiles)
+{
+    Histogram histogram(0.5);
+    EXPECT_EQ(histogram.getPercentile(50.0), 0.0);
+
+    for (uint64_t value = 1; value <= 1000; value++)
+        histogram.record(value);
+
+    EXPECT_EQ(histogram.getCount(), 1000);
+    EXPECT_DOUBLE_EQ(histogram.getMean(), 500.5 * 0.5);
+    EXPECT_DOUBLE_EQ(histogram.getMin(), 0.5);
+    EXPECT_DOUBLE_EQ(histogram.getMax(), 500.0);
+
+    double maxError = 1.0 / static_cast<double>(Histogram::SUB_BUCKET_COUNT);
+    for (double percentile : {50.0, 95.0, 99.0, 99.9})
+    {
+        double exact = percentile * 10.0 * 0.5;
+        EXPECT_GE(histogram.getPercentile(percentile), exact);
+        EXPECT_LE(histogram.getPercentile(percentile), exact * (1.0 + maxError));
+    }
+
+    EXPECT_DOUBLE_EQ(histogram.getPercentile(100.0), 500.0);
+}
+
+TEST(Histogram, Merge)
+{
+    Histogram even;
+    Histogram odd;
+    Histogram all;
+
+    for (uint64_t value = 0; value < 5000; value++)
+    {
+        (value % 2 == 0 ? even : odd).record(value * 7);
+        all.record(value * 7);
+    }
+
+    even.merge(odd);
+    EXPECT_EQ(even.getBuckets(), all.getBuckets());
+    EXPECT_EQ(even.getCount(), all.getCount());
+    EXPECT_EQ(even.getSum(), all.getSum());
+    EXPECT_EQ(even.getRawMin(), all.getRawMin());
+    EXPECT_EQ(even.getRawMax(), all.getRawMax());
+
+    Histogram restored(all.getUnit(), all.getBuckets(), all.getSum(), all.getRawMin(),
+                       all.getRawMax());
+    EXPECT_EQ(restored.getCount(), all.getCount());
+    EXPECT_EQ(restored.getPercentile(99.0), all.getPercentile(99.0));
+
+    // Empty trailing buckets may be omitted
+    std::vector<uint64_t> trimmed(all.getBuckets().cbegin(),
+                                  all.getBuckets().cbegin() +
+                                      static_cast<std::ptrdiff_t>(
+                                          Histogram::getBucketIndex(all.getRawMax()) + 1));
+    Histogram restoredTrimmed(
+        all.getUnit(), trimmed, all.getSum(), all.getRawMin(), all.getRawMax());
+    EXPECT_EQ(restoredTrimmed.getBuckets(), all.getBuckets());
+
+    all.reset();
+    EXPECT_EQ(all.getCount(), 0);
+    EXPECT_EQ(all.getPercentile(50.0), 0.0);
+}
+
+TEST(Histogram, RecordingDoesNotAllocate)
+{
+    Histogram histogram;
+    const uint64_t* buckets = histogram.getBuckets().data();
+    EXPECT_EQ(Histogram::getBucketIndex(UINT64_MAX) + 1, Histogram::NUMBER_OF_BUCKETS);
+
+    histogram.record(UINT64_MAX);
+    histogram.reset();
+    histogram.record(1);
+
+    EXPECT_EQ(histogram.getBuckets().data(), buckets);
+    EXPECT_EQ(histogram.getBuckets().size(), Histogram::NUMBER_OF_BUCKETS);
+}
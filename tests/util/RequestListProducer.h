@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#pragma once
+
+#include <DRAMSys/initiators/request/RequestProducer.h>
+
+#include <systemc>
+#include <utility>
+#include <vector>
+
+/**
+ * Issues a fixed list of requests with a constant interval between them.
+ */
+class RequestListProducer : public DRAMSys::Initiators::RequestProducer
+{
+public:
+    using Request = DRAMSys::Initiators::Request;
+
+    RequestListProducer(std::vector<Request> requests, sc_core::sc_time interval) :
+        requests(std::move(requests)),
+        interval(interval)
+    {
+    }
+
+    Request nextRequest() override
+    {
+        if (nextIndex == requests.size())
+            return Request{Request::Command::Stop};
+
+        return requests[nextIndex++];
+    }
+
+    sc_core::sc_time nextTrigger() override { return interval; }
+    uint64_t totalRequests() override { return requests.size(); }
+
+private:
+    std::vector<Request> requests;
+    sc_core::sc_time interval;
+    std::size_t nextIndex = 0;
+};
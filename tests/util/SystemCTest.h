@@ -41,7 +41,12 @@
 class SystemCTest : public testing::Test
 {
 public:
-    ~SystemCTest() override { 
+    ~SystemCTest() override { resetSimulationContext(); }
+
+protected:
+    // Allows a test to run another simulation after sc_stop()
+    static void resetSimulationContext()
+    {
         sc_core::sc_curr_simcontext = new sc_core::sc_simcontext();
         sc_core::sc_default_global_context = sc_core::sc_curr_simcontext;
     }
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <DRAMSys/common/BinaryTraceReader.h>
+#include <DRAMSys/common/BinaryTraceWriter.h>
+#include <DRAMSys/common/CompressedFile.h>
+#include <DRAMSys/initiators/player/StlTraceParser.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace DRAMSys;
+using DRAMSys::Initiators::StlTraceParser;
+
+namespace
+{
+
+uint64_t convertToBinary(const std::filesystem::path& input,
+                         const std::filesystem::path& traceName,
+                         const std::filesystem::path& output,
+                         bool withData)
+{
+    StlTraceParser parser(input, withData);
+    BinaryTraceWriter writer(output.string(), traceName.extension() == ".rstl");
+
+    uint64_t numberOfRequests = 0;
+    while (const StlTraceParser::Block* block = parser.nextBlock())
+    {
+        for (std::size_t index = 0; index < block->size; index++)
+        {
+            const StlTraceParser::LineContent& line = block->lines[index];
+            auto command = line.command == StlTraceParser::LineContent::Command::Read
+                               ? BinaryTrace::Command::Read
+                               : BinaryTrace::Command::Write;
+
+            writer.append(line.cycle,
+                          command,
+                          line.address,
+                          line.dataLength.value_or(0),
+                          line.data.data(),
+                          static_cast<uint32_t>(line.data.size()));
+        }
+
+        numberOfRequests += block->size;
+    }
+
+    writer.close();
+    return numberOfRequests;
+}
+
+uint64_t convertToText(const std::filesystem::path& input, const std::filesystem::path& output)
+{
+    static constexpr std::string_view HEX_DIGITS = "0123456789abcdef";
+
+    BinaryTraceReader reader(input.string());
+    if (reader.isRelative() != (output.extension() == ".rstl"))
+        throw std::runtime_error("The timing of " + input.string() +
+                                 " does not match the extension of " + output.string());
+
+    std::ofstream file(output);
+    if (!file)
+        throw std::runtime_error("Cannot open " + output.string() + " for writing");
+
+    std::string data;
+    BinaryTrace::Record record;
+    while (reader.next(record))
+    {
+        file << (reader.isRelative() ? record.delta : record.cycle) << ":\t";
+
+        if (record.length != 0)
+            file << "(" << record.length << ") ";
+
+        file << (record.command == BinaryTrace::Command::Read ? "read" : "write") << "\t0x"
+             << std::hex << record.address << std::dec;
+
+        // The first byte of the data is the least significant one
+        if (record.dataSize != 0)
+        {
+            data.assign("0x");
+            for (uint32_t byte = record.dataSize; byte > 0; byte--)
+            {
+                data.push_back(HEX_DIGITS[record.data[byte - 1] >> 4U]);
+                data.push_back(HEX_DIGITS[record.data[byte - 1] & 0xFU]);
+            }
+            file << "\t" << data;
+        }
+
+        file << "\n";
+    }
+
+    if (!file)
+        throw std::runtime_error("Cannot write to " + output.string());
+
+    return reader.getNumberOfRecords();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int argument = 1;
+    bool withData = argc > argument && std::string_view(argv[argument]) == "--data";
+    if (withData)
+        argument++;
+
+    if (argc <= argument)
+    {
+        std::cerr << "Usage: btl_converter [--data] <trace> [output]\n"
+                     "Converts an STL trace (.stl, .rstl, optionally compressed with .gz or "
+                     ".zst) to a binary trace (.btl) and back.\n"
+                     "With --data the data of the write requests is converted as well.\n";
+        return -1;
+    }
+
+    std::filesystem::path input = argv[argument];
+
+    // Compressed STL traces are named like trace.stl.gz
+    std::filesystem::path traceName = input;
+    if (CompressedFile::getFormat(input).has_value())
+        traceName.replace_extension();
+    bool toBinary = traceName.extension() == ".stl" || traceName.extension() == ".rstl";
+
+    try
+    {
+        std::filesystem::path output;
+        if (argc > argument + 1)
+            output = argv[argument + 1];
+        else if (toBinary)
+            output = std::filesystem::path(traceName).replace_extension(".btl");
+        else
+            output = std::filesystem::path(input).replace_extension(
+                BinaryTraceReader(input.string()).isRelative() ? ".rstl" : ".stl");
+
+        uint64_t numberOfRequests =
+            toBinary ? convertToBinary(input, traceName, output, withData)
+                     : convertToText(input, output);
+
+        std::cout << "Converted " << numberOfRequests << " requests of " << input.string()
+                  << " to " << output.string() << "\n";
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << "\n";
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2026, RPTU Kaiserslautern-Landau
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Authors:
+ *    Derek Christ
+ */
+
+#include <DRAMSys/common/ColumnarTraceReader.h>
+#include <DRAMSys/common/TraceSummary.h>
+#include <DRAMSys/common/TraceSummaryWriter.h>
+
+#include <filesystem>
+#include <iostream>
+#include <sqlite3.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace DRAMSys;
+using namespace DRAMSys::ColumnarTrace;
+
+namespace
+{
+
+class Database
+{
+public:
+    explicit Database(const std::string& fileName)
+    {
+        std::filesystem::remove(fileName);
+
+        if (sqlite3_open(fileName.c_str(), &db) != SQLITE_OK)
+        {
+            sqlite3_close(db);
+            throw std::runtime_error("Cannot open database " + fileName);
+        }
+
+        execute("PRAGMA main.page_size = 4096");
+        execute("PRAGMA main.cache_size=10000");
+        execute("PRAGMA main.locking_mode=EXCLUSIVE");
+        execute("PRAGMA main.synchronous=OFF");
+        execute("PRAGMA journal_mode = OFF");
+    }
+
+    Database(const Database&) = delete;
+    Database(Database&&) = delete;
+    Database& operator=(const Database&) = delete;
+    Database& operator=(Database&&) = delete;
+
+    ~Database()
+    {
+        for (sqlite3_stmt* statement : statements)
+            sqlite3_finalize(statement);
+        sqlite3_close(db);
+    }
+
+    void execute(const std::string& command)
+    {
+        char* errMsg = nullptr;
+        if (sqlite3_exec(db, command.c_str(), nullptr, nullptr, &errMsg) != SQLITE_OK)
+        {
+            std::string message = errMsg != nullptr ? errMsg : "unknown error";
+            sqlite3_free(errMsg);
+            throw std::runtime_error("SQLite error: " + message);
+        }
+    }
+
+    sqlite3_stmt* prepare(const std::string& statement)
+    {
+        sqlite3_stmt* prepared = nullptr;
+        if (sqlite3_prepare_v2(db, statement.c_str(), -1, &prepared, nullptr) != SQLITE_OK)
+            throw std::runtime_error("Cannot prepare statement " + statement);
+
+        statements.push_back(prepared);
+        return prepared;
+    }
+
+    [[nodiscard]] sqlite3* get() const { return db; }
+
+    static void step(sqlite3_stmt* statement)
+    {
+        int errorCode = sqlite3_step(statement);
+        if (errorCode != SQLITE_DONE)
+            throw std::runtime_error("Could not execute statement. Error code: " +
+                                     std::to_string(errorCode));
+        sqlite3_reset(statement);
+    }
+
+private:
+    sqlite3* db = nullptr;
+    std::vector<sqlite3_stmt*> statements;
+};
+
+void bindText(sqlite3_stmt* statement, int index, const std::string& text)
+{
+    sqlite3_bind_text(statement, index, text.c_str(), static_cast<int>(text.length()), nullptr);
+}
+
+void convertMetadata(Database& database, const TraceMetadata& metadata)
+{
+    sqlite3_stmt* insertGeneralInfo =
+        database.prepare("INSERT INTO GeneralInfo VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, "
+                         "?, ?, ?)");
+    sqlite3_bind_int(insertGeneralInfo, 1, static_cast<int>(metadata.numberOfRanks));
+    sqlite3_bind_int(insertGeneralInfo, 2, static_cast<int>(metadata.numberOfBankGroups));
+    sqlite3_bind_int(insertGeneralInfo, 3, static_cast<int>(metadata.numberOfBanks));
+    sqlite3_bind_int64(insertGeneralInfo, 4, static_cast<int64_t>(metadata.clk));
+    bindText(insertGeneralInfo, 5, metadata.unitOfTime);
+    bindText(insertGeneralInfo, 6, metadata.mcConfig);
+    bindText(insertGeneralInfo, 7, metadata.memSpec);
+    bindText(insertGeneralInfo, 8, metadata.traces);
+    sqlite3_bind_int64(insertGeneralInfo, 9, static_cast<int64_t>(metadata.windowSize));
+    sqlite3_bind_int(insertGeneralInfo, 10, static_cast<int>(metadata.refreshMaxPostponed));
+    sqlite3_bind_int(insertGeneralInfo, 11, static_cast<int>(metadata.refreshMaxPulledin));
+    sqlite3_bind_int(insertGeneralInfo, 12, static_cast<int>(metadata.controllerThread));
+    sqlite3_bind_int(insertGeneralInfo, 13, static_cast<int>(metadata.maxBufferDepth));
+    sqlite3_bind_int(insertGeneralInfo, 14, static_cast<int>(metadata.per2BankOffset));
+    sqlite3_bind_int(insertGeneralInfo, 15, static_cast<int>(metadata.rowColumnCommandBus));
+    sqlite3_bind_int(insertGeneralInfo, 16, static_cast<int>(metadata.pseudoChannelMode));
+    Database::step(insertGeneralInfo);
+
+    sqlite3_stmt* insertCommandLength =
+        database.prepare("INSERT INTO CommandLengths VALUES (?, ?)");
+    for (const auto& [command, length] : metadata.commandLengths)
+    {
+        bindText(insertCommandLength, 1, command);
+        sqlite3_bind_double(insertCommandLength, 2, length);
+        Database::step(insertCommandLength);
+    }
+
+    sqlite3_stmt* insertPhaseName = database.prepare("INSERT INTO PhaseNames VALUES (?, ?)");
+    for (const auto& [id, name] : metadata.phaseNames)
+    {
+        sqlite3_bind_int(insertPhaseName, 1, id);
+        bindText(insertPhaseName, 2, name);
+        Database::step(insertPhaseName);
+    }
+}
+
+void convertRecords(Database& database, const ColumnarTraceReader& reader, TraceSummary& summary)
+{
+    sqlite3_stmt* insertTransaction =
+        database.prepare("INSERT INTO Transactions VALUES (?, ?, ?, ?, ?, ?, ?, ?)");
+    sqlite3_stmt* insertRange = database.prepare("INSERT INTO ranges VALUES (?, ?, ?)");
+    sqlite3_stmt* insertPhase = database.prepare(
+        "INSERT INTO PhaseData (PhaseNameID, PhaseBegin, PhaseEnd, DataStrobeBegin, "
+        "DataStrobeEnd, Rank, BankGroup, Bank, Row, Column, BurstLength, Transact) VALUES "
+        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+    sqlite3_stmt* insertPower = database.prepare("INSERT INTO Power VALUES (?, ?)");
+    sqlite3_stmt* insertBufferDepth = database.prepare("INSERT INTO BufferDepth VALUES (?, ?, ?)");
+    sqlite3_stmt* insertBandwidth = database.prepare("INSERT INTO Bandwidth VALUES (?, ?)");
+    sqlite3_stmt* insertDebugMessage =
+        database.prepare("INSERT INTO DebugMessages (Time, Message) VALUES (?, ?)");
+
+    // The rows are decoded chunk by chunk to bound the memory consumption
+    std::vector<TransactionRecord> transactions;
+    std::vector<PhaseRecord> phases;
+    std::vector<PowerRecord> power;
+    std::vector<BufferDepthRecord> bufferDepth;
+    std::vector<BandwidthRecord> bandwidth;
+    std::vector<DebugMessageRecord> debugMessages;
+
+    for (const ChunkInfo& chunk : reader.getChunks())
+    {
+        switch (chunk.table)
+        {
+        case Table::Transactions:
+            transactions.clear();
+            reader.read(chunk, transactions);
+            for (const TransactionRecord& transaction : transactions)
+            {
+                auto id = static_cast<int64_t>(transaction.id);
+                sqlite3_bind_int64(insertTransaction, 1, id);
+                sqlite3_bind_int64(insertTransaction, 2, id);
+                sqlite3_bind_int64(
+                    insertTransaction, 3, static_cast<int64_t>(transaction.address));
+                sqlite3_bind_int(insertTransaction, 4, static_cast<int>(transaction.dataLength));
+                sqlite3_bind_int(insertTransaction, 5, static_cast<int>(transaction.thread));
+                sqlite3_bind_int(insertTransaction, 6, static_cast<int>(transaction.channel));
+                sqlite3_bind_int64(
+                    insertTransaction, 7, static_cast<int64_t>(transaction.timeOfGeneration));
+                sqlite3_bind_text(insertTransaction, 8, &transaction.command, 1, nullptr);
+                Database::step(insertTransaction);
+                summary.addTransaction(
+                    transaction.thread, transaction.command, transaction.dataLength);
+
+                sqlite3_bind_int64(insertRange, 1, id);
+                sqlite3_bind_int64(insertRange, 2, static_cast<int64_t>(transaction.rangeBegin));
+                sqlite3_bind_int64(insertRange, 3, static_cast<int64_t>(transaction.rangeEnd));
+                Database::step(insertRange);
+            }
+            break;
+        case Table::Phases:
+            phases.clear();
+            reader.read(chunk, phases);
+            for (const PhaseRecord& phase : phases)
+            {
+                sqlite3_bind_int(insertPhase, 1, phase.phaseNameId);
+                sqlite3_bind_int64(insertPhase, 2, static_cast<int64_t>(phase.begin));
+                sqlite3_bind_int64(insertPhase, 3, static_cast<int64_t>(phase.end));
+                sqlite3_bind_int64(insertPhase, 4, static_cast<int64_t>(phase.dataStrobeBegin));
+                sqlite3_bind_int64(insertPhase, 5, static_cast<int64_t>(phase.dataStrobeEnd));
+                sqlite3_bind_int(insertPhase, 6, static_cast<int>(phase.rank));
+                sqlite3_bind_int(insertPhase, 7, static_cast<int>(phase.bankGroup));
+                sqlite3_bind_int(insertPhase, 8, static_cast<int>(phase.bank));
+                sqlite3_bind_int(insertPhase, 9, static_cast<int>(phase.row));
+                sqlite3_bind_int(insertPhase, 10, static_cast<int>(phase.column));
+                sqlite3_bind_int(insertPhase, 11, static_cast<int>(phase.burstLength));
+                sqlite3_bind_int64(insertPhase, 12, static_cast<int64_t>(phase.transaction));
+                Database::step(insertPhase);
+                summary.addPhase(phase.transaction,
+                                 phase.phaseNameId,
+                                 phase.begin,
+                                 phase.end,
+                                 phase.dataStrobeBegin,
+                                 phase.dataStrobeEnd,
+                                 phase.rank,
+                                 phase.bank);
+            }
+            break;
+        case Table::Power:
+            power.clear();
+            reader.read(chunk, power);
+            for (const PowerRecord& record : power)
+            {
+                sqlite3_bind_double(insertPower, 1, record.time);
+                sqlite3_bind_double(insertPower, 2, record.averagePower);
+                Database::step(insertPower);
+            }
+            break;
+        case Table::BufferDepth:
+            bufferDepth.clear();
+            reader.read(chunk, bufferDepth);
+            for (const BufferDepthRecord& record : bufferDepth)
+            {
+                sqlite3_bind_double(insertBufferDepth, 1, record.time);
+                sqlite3_bind_int(insertBufferDepth, 2, static_cast<int>(record.bufferNumber));
+                sqlite3_bind_double(insertBufferDepth, 3, record.averageBufferDepth);
+                Database::step(insertBufferDepth);
+            }
+            break;
+        case Table::Bandwidth:
+            bandwidth.clear();
+            reader.read(chunk, bandwidth);
+            for (const BandwidthRecord& record : bandwidth)
+            {
+                sqlite3_bind_double(insertBandwidth, 1, record.time);
+                sqlite3_bind_double(insertBandwidth, 2, record.averageBandwidth);
+                Database::step(insertBandwidth);
+            }
+            break;
+        case Table::DebugMessages:
+            debugMessages.clear();
+            reader.read(chunk, debugMessages);
+            for (const DebugMessageRecord& record : debugMessages)
+            {
+                sqlite3_bind_int64(insertDebugMessage, 1, static_cast<int64_t>(record.time));
+                bindText(insertDebugMessage, 2, record.message);
+                Database::step(insertDebugMessage);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Must specify a columnar trace (.ctr).\n";
+        return -1;
+    }
+
+    std::filesystem::path input = argv[1];
+    std::filesystem::path output =
+        argc < 3 ? std::filesystem::path(input).replace_extension(".tdb") : argv[2];
+
+    try
+    {
+        ColumnarTraceReader reader(input.string());
+        Database database(output.string());
+
+        // The ranges are inserted into a plain table first and the R*-tree is built once from
+        // the sorted ranges, like in the bulk load mode of the recorder
+        database.execute(std::string(TraceSchema::initialCommand));
+        database.execute(std::string(TraceSchema::createRangesBulkLoadCommand));
+
+        database.execute("BEGIN;");
+        convertMetadata(database, reader.getMetadata());
+        TraceSummary summary(reader.getMetadata());
+        convertRecords(database, reader, summary);
+        insertTraceSummary(database.get(), summary);
+        database.execute(std::string(TraceSchema::bulkLoadRangesCommand));
+        database.execute(std::string(TraceSchema::createIndexesCommand));
+        database.execute("COMMIT;");
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << "\n";
+        return -1;
+    }
+
+    std::cout << "Converted " << input.string() << " to " << output.string() << "\n";
+    return 0;
+}